@@ -0,0 +1,227 @@
+/**
+ * @brief It benchmarks the container library
+ *
+ * Each container is compared with the code it replaces in the engine: a
+ * vector against an array grown with realloc on every push, a hash map
+ * against a linear scan of an id array, and a ring buffer against an
+ * array of the latest entries that is shifted on every push.
+ *
+ * @file container_bench.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/container.h"
+
+#define BENCH_OPS 5000000  /*!< Operations per run */
+#define BENCH_KEYS 200     /*!< Keys of the maps (about the entities of a map) */
+#define BENCH_HISTORY 16   /*!< Entries kept by the histories */
+
+VECTOR_DECLARE(Bench_vector, long);
+VECTOR_DEFINE(Bench_vector, long);
+HMAP_DECLARE(Bench_map, Id, int);
+HMAP_DEFINE(Bench_map, Id, int, CONTAINER_HASH_INT, NO_ID);
+RING_DECLARE(Bench_ring, long);
+RING_DEFINE(Bench_ring, long);
+
+/**
+ * Private functions
+ */
+unsigned long bench_rand(unsigned long *seed);
+int bench_print(const char *name, const char *old, double t_old, const char *new, double t_new, long sum_old, long sum_new);
+int bench_vector();
+int bench_map();
+int bench_ring();
+
+/**
+ * @brief Main function of the container benchmark
+ * @author Miguel Soto
+ *
+ * @return 0 if every container agrees with the code it replaces, 1 if not
+ */
+int main()
+{
+  int st = 0;
+
+  st += bench_vector();
+  st += bench_map();
+  st += bench_ring();
+
+  return st ? 1 : 0;
+}
+
+/**
+ * @brief Pseudo random numbers, the same in every run
+ * @author Miguel Soto
+ *
+ * @param seed state of the generator
+ * @return a number from 0 to 32767
+ */
+unsigned long bench_rand(unsigned long *seed)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return (*seed >> 16) & 0x7fff;
+}
+
+/**
+ * @brief Prints the results of a scenario
+ * @author Miguel Soto
+ *
+ * @return 0 if both ways agree, 1 if not
+ */
+int bench_print(const char *name, const char *old, double t_old, const char *new, double t_new, long sum_old, long sum_new)
+{
+  printf("%s: %d operations\n", name, BENCH_OPS);
+  printf("  old (%s): %7.3f s  %6.1f Mops/s\n", old, t_old, BENCH_OPS / t_old / 1e6);
+  printf("  new (%s): %7.3f s  %6.1f Mops/s\n", new, t_new, BENCH_OPS / t_new / 1e6);
+  printf("  speedup: %.2fx\n", t_old / t_new);
+
+  if (sum_old != sum_new)
+  {
+    fprintf(stderr, "ERROR: implementations disagree (%ld != %ld)\n", sum_old, sum_new);
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Pushes to a vector against an array that is realloc'ed on every push
+ * @author Miguel Soto
+ *
+ * @return 0 if both ways agree, 1 if not
+ */
+int bench_vector()
+{
+  Bench_vector v;
+  long *old = NULL, sum_old = 0, sum_new = 0;
+  int n_old = 0, i;
+  double t_old, t_new;
+  clock_t start;
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    /* Emptied every 64 pushes, like an inventory filled again */
+    if (n_old == 64)
+    {
+      free(old);
+      old = NULL;
+      n_old = 0;
+    }
+    old = (long *)realloc(old, (n_old + 1) * sizeof(long));
+    old[n_old++] = i;
+    sum_old += old[n_old / 2];
+  }
+  free(old);
+  t_old = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  Bench_vector_init(&v, NULL);
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    if (v.size == 64)
+    {
+      Bench_vector_clear(&v);
+    }
+    Bench_vector_push(&v, i);
+    sum_new += v.data[v.size / 2];
+  }
+  t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+  Bench_vector_free(&v);
+
+  return bench_print("vector push", "realloc per push", t_old, "vector         ", t_new, sum_old, sum_new);
+}
+
+/**
+ * @brief Looks up ids in a hash map against a linear scan
+ * @author Miguel Soto
+ *
+ * @return 0 if both ways agree, 1 if not
+ */
+int bench_map()
+{
+  Bench_map m;
+  Id keys[BENCH_KEYS], id;
+  unsigned long seed = 1;
+  long sum_old = 0, sum_new = 0;
+  int *value = NULL, i, j;
+  double t_old, t_new;
+  clock_t start;
+
+  Bench_map_init(&m, NULL);
+  for (i = 0; i < BENCH_KEYS; i++)
+  {
+    keys[i] = 100 + 7 * i;
+    Bench_map_put(&m, keys[i], i);
+  }
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    id = 100 + 7 * (Id)(bench_rand(&seed) % (2 * BENCH_KEYS));
+    for (j = 0; j < BENCH_KEYS && keys[j] != id; j++)
+      ;
+    sum_old += j < BENCH_KEYS ? j : -1;
+  }
+  t_old = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  seed = 1;
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    id = 100 + 7 * (Id)(bench_rand(&seed) % (2 * BENCH_KEYS));
+    value = Bench_map_get(&m, id);
+    sum_new += value ? *value : -1;
+  }
+  t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+  Bench_map_free(&m);
+
+  return bench_print("id lookup, 200 ids", "linear scan     ", t_old, "hash map       ", t_new, sum_old, sum_new);
+}
+
+/**
+ * @brief Keeps the latest entries in a ring buffer against a shifted array
+ * @author Miguel Soto
+ *
+ * @return 0 if both ways agree, 1 if not
+ */
+int bench_ring()
+{
+  Bench_ring r;
+  long old[BENCH_HISTORY], sum_old = 0, sum_new = 0;
+  int n_old = 0, i;
+  double t_old, t_new;
+  clock_t start;
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    if (n_old == BENCH_HISTORY)
+    {
+      memmove(old, old + 1, (BENCH_HISTORY - 1) * sizeof(long));
+      n_old--;
+    }
+    old[n_old++] = i;
+    sum_old += old[0];
+  }
+  t_old = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  Bench_ring_init(&r, BENCH_HISTORY, NULL);
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    Bench_ring_push(&r, i);
+    sum_new += *Bench_ring_at(&r, 0);
+  }
+  t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+  Bench_ring_free(&r);
+
+  return bench_print("history of 16 entries", "shifted array   ", t_old, "ring buffer    ", t_new, sum_old, sum_new);
+}
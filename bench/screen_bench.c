@@ -0,0 +1,93 @@
+/**
+ * @brief It benchmarks the screen backend it is linked with
+ *
+ * The same program is linked with the in-tree backend (screen_bench) and
+ * with lib/libscreen.a (screen_bench_lib), so both can be compared. The
+ * areas are the ones of the graphic engine, filled again before each full
+ * repaint. The paints go to /dev/null, so only the cost of building and
+ * sending the output is measured.
+ *
+ * @file screen_bench.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/libscreen.h"
+
+#define BENCH_PAINTS 2000 /*!< Full repaints per run */
+#define BENCH_ROWS 44     /*!< Rows of the screen of the graphic engine */
+#define BENCH_COLUMNS 120 /*!< Columns of the screen of the graphic engine */
+#define BENCH_AREAS 7     /*!< Areas of the graphic engine */
+
+/**
+ * @brief Main function of the screen benchmark
+ * @author Miguel Soto
+ *
+ * @return 0 if everything goes well, 1 if the output can not be redirected
+ */
+int main()
+{
+  static const int areas[BENCH_AREAS][4] = {{1, 1, 80, 25}, {82, 1, 35, 34}, {30, 27, 19, 1}, {1, 28, 80, 3}, {1, 32, 80, 3}, {1, 36, 80, 7}, {82, 36, 35, 7}};
+  Area *area[BENCH_AREAS];
+  char line[128];
+  int saved, fd, i, j, k;
+  double t;
+  clock_t start;
+
+  screen_init(BENCH_ROWS, BENCH_COLUMNS);
+  for (j = 0; j < BENCH_AREAS; j++)
+  {
+    area[j] = screen_area_init(areas[j][0], areas[j][1], areas[j][2], areas[j][3]);
+  }
+
+  fflush(stdout);
+  saved = dup(STDOUT_FILENO);
+  fd = open("/dev/null", O_WRONLY);
+  if (saved < 0 || fd < 0)
+  {
+    fprintf(stderr, "ERROR: /dev/null can not be opened\n");
+    return 1;
+  }
+  dup2(fd, STDOUT_FILENO);
+  close(fd);
+
+  start = clock();
+  for (i = 0; i < BENCH_PAINTS; i++)
+  {
+    /* Every row of every area is written, like a busy turn */
+    for (j = 0; j < BENCH_AREAS; j++)
+    {
+      screen_area_clear(area[j]);
+      for (k = 0; k < areas[j][3]; k++)
+      {
+        sprintf(line, "  turn %d, area %d, row %d", i, j, k);
+        screen_area_puts(area[j], line);
+      }
+    }
+    screen_paint();
+  }
+  fflush(stdout);
+  t = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  dup2(saved, STDOUT_FILENO);
+  close(saved);
+
+  printf("screen paint: %d full repaints of %dx%d\n", BENCH_PAINTS, BENCH_ROWS, BENCH_COLUMNS);
+  printf("  %7.3f s  %8.1f paints/s  %6.3f ms/paint\n", t, BENCH_PAINTS / t, t * 1e3 / BENCH_PAINTS);
+
+  for (j = 0; j < BENCH_AREAS; j++)
+  {
+    screen_area_destroy(area[j]);
+  }
+  screen_destroy();
+
+  return 0;
+}
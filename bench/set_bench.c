@@ -0,0 +1,424 @@
+/**
+ * @brief It benchmarks the set module
+ *
+ * Add/delete/contains churn over many small sets, like the objects of the
+ * spaces and the inventories during a game, and membership checks over
+ * big sets of close or sparse ids, and the set algebra against the loops
+ * callers wrote before it existed. The realloc-per-operation, linear scan
+ * set that was used before is kept here as the reference implementation.
+ *
+ * @file set_bench.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/set.h"
+
+#define BENCH_SETS 100        /*!< Number of sets used (one per space) */
+#define BENCH_OPS 20000000    /*!< Operations per run */
+#define BENCH_FIRST_ID 300    /*!< First object id */
+
+/**
+ * @brief Set used before the capacity and membership index reworks
+ */
+typedef struct
+{
+  Id *ids;   /*!< Ids array */
+  int n_ids; /*!< Number of ids stored*/
+} Old_set;
+
+/**
+ * Private functions
+ */
+STATUS old_set_add(Old_set *s, Id id);
+STATUS old_set_del_id(Old_set *s, Id id);
+BOOL old_set_idInSet(Old_set *s, Id id);
+unsigned long bench_rand(unsigned long *seed);
+double bench_old(int n_ids, int max_size, long *checksum);
+double bench_new(int n_ids, int max_size, long *checksum);
+int bench_run(const char *name, int n_ids, int max_size);
+int bench_lookup(const char *name, Id step);
+int bench_algebra(const char *name, int n_a, Id first_b, int n_b, int n_iter);
+
+/**
+ * @brief Main function of the set benchmark
+ * @author Miguel Soto
+ *
+ * @return 0 if both implementations agree, 1 if not
+ */
+int main()
+{
+  int st = 0;
+
+  /* Spaces and inventories: 0-4 objects each */
+  st += bench_run("small sets (0-4 ids)", 6, 4);
+  /* A big inventory being filled and emptied */
+  st += bench_run("large sets (up to 64 ids)", 96, 64);
+  /* Membership in a set with every object (bitset) or sparse ids (hash) */
+  st += bench_lookup("100 close ids", 1);
+  st += bench_lookup("100 sparse ids", 7919);
+  /* Room objects against the inventory, and every object against a half */
+  st += bench_algebra("4 ids and 4 ids", 4, BENCH_FIRST_ID + 2, 4, BENCH_OPS / 10);
+  st += bench_algebra("100 ids and 50 ids", 100, BENCH_FIRST_ID + 50, 50, BENCH_OPS / 100);
+
+  return st ? 1 : 0;
+}
+
+/**
+ * @brief Runs one scenario with both implementations and prints the results
+ * @author Miguel Soto
+ *
+ * @param name name of the scenario
+ * @param n_ids different ids used per set
+ * @param max_size maximun number of ids in a set
+ * @return 0 if both implementations agree, 1 if not
+ */
+int bench_run(const char *name, int n_ids, int max_size)
+{
+  double t_old, t_new;
+  long sum_old = 0, sum_new = 0;
+
+  t_old = bench_old(n_ids, max_size, &sum_old);
+  t_new = bench_new(n_ids, max_size, &sum_new);
+
+  printf("set churn, %s: %d sets, %d operations\n", name, BENCH_SETS, BENCH_OPS);
+  printf("  old (realloc per op):  %7.3f s  %6.1f Mops/s\n", t_old, BENCH_OPS / t_old / 1e6);
+  printf("  new (set module):      %7.3f s  %6.1f Mops/s\n", t_new, BENCH_OPS / t_new / 1e6);
+  printf("  speedup: %.2fx\n", t_old / t_new);
+
+  if (sum_old != sum_new)
+  {
+    fprintf(stderr, "ERROR: implementations disagree (%ld != %ld)\n", sum_old, sum_new);
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Compares membership checks in a set of 100 ids
+ * @author Miguel Soto
+ *
+ * @param name name of the scenario
+ * @param step distance between the ids of the set
+ * @return 0 if both implementations agree, 1 if not
+ */
+int bench_lookup(const char *name, Id step)
+{
+  Old_set old;
+  Set *new_set = NULL;
+  unsigned long seed = 1;
+  long hits_old = 0, hits_new = 0;
+  double t_old, t_new;
+  clock_t start;
+  Id id;
+  int i;
+
+  old.ids = NULL;
+  old.n_ids = 0;
+  new_set = set_create();
+  for (i = 0; i < 100; i++)
+  {
+    old_set_add(&old, BENCH_FIRST_ID + i * step);
+    set_add(new_set, BENCH_FIRST_ID + i * step);
+  }
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    id = BENCH_FIRST_ID + (bench_rand(&seed) % 200) * step;
+    hits_old += old_set_idInSet(&old, id);
+  }
+  t_old = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  seed = 1;
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    id = BENCH_FIRST_ID + (bench_rand(&seed) % 200) * step;
+    hits_new += set_idInSet(new_set, id);
+  }
+  t_new = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  free(old.ids);
+  set_destroy(new_set);
+
+  printf("set_idInSet, %s: %d checks\n", name, BENCH_OPS);
+  printf("  old (linear scan):     %7.3f s  %6.1f Mops/s\n", t_old, BENCH_OPS / t_old / 1e6);
+  printf("  new (indexed):         %7.3f s  %6.1f Mops/s\n", t_new, BENCH_OPS / t_new / 1e6);
+  printf("  speedup: %.2fx\n", t_old / t_new);
+
+  if (hits_old != hits_new)
+  {
+    fprintf(stderr, "ERROR: implementations disagree (%ld != %ld)\n", hits_old, hits_new);
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Compares set_intersect with a loop of set_idInSet and set_add
+ * @author Miguel Soto
+ *
+ * @param name name of the scenario
+ * @param n_a number of ids of the first set (from BENCH_FIRST_ID)
+ * @param first_b first id of the second set
+ * @param n_b number of ids of the second set
+ * @param n_iter number of intersections
+ * @return 0 if both ways agree, 1 if not
+ */
+int bench_algebra(const char *name, int n_a, Id first_b, int n_b, int n_iter)
+{
+  Set *a = NULL, *b = NULL, *dest = NULL, *naive = NULL;
+  long sum_naive = 0, sum_kernel = 0;
+  double t_naive, t_kernel;
+  clock_t start;
+  Id id;
+  int i, j;
+
+  a = set_create();
+  b = set_create();
+  dest = set_create();
+  for (i = 0; i < n_a; i++)
+  {
+    set_add(a, BENCH_FIRST_ID + i);
+  }
+  for (i = 0; i < n_b; i++)
+  {
+    set_add(b, first_b + i);
+  }
+
+  /* What callers did: walk one set by position and ask the other one */
+  start = clock();
+  for (i = 0; i < n_iter; i++)
+  {
+    naive = set_create();
+    for (j = 0; j < set_get_nids(a); j++)
+    {
+      id = set_get_ids_by_number(a, j);
+      if (set_idInSet(b, id) == TRUE)
+      {
+        set_add(naive, id);
+      }
+    }
+    sum_naive += set_get_nids(naive);
+    set_destroy(naive);
+  }
+  t_naive = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  for (i = 0; i < n_iter; i++)
+  {
+    set_intersect(dest, a, b);
+    sum_kernel += set_get_nids(dest);
+  }
+  t_kernel = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  set_destroy(a);
+  set_destroy(b);
+  set_destroy(dest);
+
+  printf("intersection, %s: %d times\n", name, n_iter);
+  printf("  naive loop:            %7.3f s  %6.2f Mops/s\n", t_naive, n_iter / t_naive / 1e6);
+  printf("  set_intersect:         %7.3f s  %6.2f Mops/s\n", t_kernel, n_iter / t_kernel / 1e6);
+  printf("  speedup: %.2fx\n", t_naive / t_kernel);
+
+  if (sum_naive != sum_kernel)
+  {
+    fprintf(stderr, "ERROR: implementations disagree (%ld != %ld)\n", sum_naive, sum_kernel);
+    return 1;
+  }
+
+  return 0;
+}
+
+/**
+ * @brief Small deterministic random generator, the same for both runs
+ * @author Miguel Soto
+ *
+ * @param seed state of the generator
+ * @return next random number
+ */
+unsigned long bench_rand(unsigned long *seed)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return (*seed >> 16) & 0x7fff;
+}
+
+/**
+ * @brief Runs the churn with the old set
+ * @author Miguel Soto
+ *
+ * @param n_ids different ids used per set
+ * @param max_size maximun number of ids in a set
+ * @param checksum number of successful operations
+ * @return seconds spent
+ */
+double bench_old(int n_ids, int max_size, long *checksum)
+{
+  Old_set sets[BENCH_SETS];
+  unsigned long seed = 1, r;
+  clock_t start;
+  Id id;
+  int i, k;
+
+  for (i = 0; i < BENCH_SETS; i++)
+  {
+    sets[i].ids = NULL;
+    sets[i].n_ids = 0;
+  }
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    r = bench_rand(&seed);
+    k = r % BENCH_SETS;
+    id = BENCH_FIRST_ID + (r / BENCH_SETS) % n_ids;
+    if (old_set_idInSet(&sets[k], id) == TRUE)
+    {
+      /* Taken from a space, or dropped from the inventory */
+      *checksum += old_set_del_id(&sets[k], id) == OK;
+    }
+    else if (sets[k].n_ids < max_size)
+    {
+      *checksum += old_set_add(&sets[k], id) == OK;
+    }
+  }
+
+  for (i = 0; i < BENCH_SETS; i++)
+  {
+    free(sets[i].ids);
+  }
+
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Runs the churn with the set module
+ * @author Miguel Soto
+ *
+ * @param n_ids different ids used per set
+ * @param max_size maximun number of ids in a set
+ * @param checksum number of successful operations
+ * @return seconds spent
+ */
+double bench_new(int n_ids, int max_size, long *checksum)
+{
+  Set *sets[BENCH_SETS];
+  unsigned long seed = 1, r;
+  clock_t start;
+  Id id;
+  int i, k;
+
+  for (i = 0; i < BENCH_SETS; i++)
+  {
+    sets[i] = set_create();
+  }
+
+  start = clock();
+  for (i = 0; i < BENCH_OPS; i++)
+  {
+    r = bench_rand(&seed);
+    k = r % BENCH_SETS;
+    id = BENCH_FIRST_ID + (r / BENCH_SETS) % n_ids;
+    if (set_idInSet(sets[k], id) == TRUE)
+    {
+      *checksum += set_del_id(sets[k], id) == OK;
+    }
+    else if (set_get_nids(sets[k]) < max_size)
+    {
+      *checksum += set_add(sets[k], id) == OK;
+    }
+  }
+
+  for (i = 0; i < BENCH_SETS; i++)
+  {
+    set_destroy(sets[i]);
+  }
+
+  return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+/**
+ * @brief Old set_add, one realloc per id
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS old_set_add(Old_set *s, Id id)
+{
+  Id *aux = NULL;
+
+  aux = (Id *)realloc(s->ids, (s->n_ids + 1) * sizeof(Id));
+  if (!aux)
+  {
+    return ERROR;
+  }
+  s->ids = aux;
+  s->ids[s->n_ids++] = id;
+
+  return OK;
+}
+
+/**
+ * @brief Old set_del_id, one realloc per id
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS old_set_del_id(Old_set *s, Id id)
+{
+  Id *aux = NULL;
+  int i;
+
+  for (i = 0; i < s->n_ids; i++)
+  {
+    if (s->ids[i] == id)
+    {
+      s->ids[i] = s->ids[s->n_ids - 1];
+      aux = (Id *)realloc(s->ids, s->n_ids * sizeof(Id));
+      if (!aux)
+      {
+        return ERROR;
+      }
+      s->ids = aux;
+      s->n_ids--;
+      return OK;
+    }
+  }
+
+  return ERROR;
+}
+
+/**
+ * @brief Old set_idInSet, linear scan
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return TRUE if the set contains the id, FALSE in opposite case
+ */
+BOOL old_set_idInSet(Old_set *s, Id id)
+{
+  int i;
+
+  for (i = 0; i < s->n_ids; i++)
+  {
+    if (s->ids[i] == id)
+    {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+}
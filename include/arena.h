@@ -0,0 +1,107 @@
+/**
+ * @brief It defines the arena (region) allocator
+ *
+ * An arena hands out memory from big blocks. Nothing allocated from it is
+ * freed on its own: resetting the arena releases everything at once and
+ * keeps the blocks to be used again.
+ *
+ * @file arena.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "types.h"
+
+#define ARENA_BLOCK_SIZE 65536 /*!< Default size of the blocks of an arena */
+
+typedef struct _Arena Arena; /*!< It defines the arena structure */
+
+/**
+ * @brief Creates an empty arena
+ * @author Miguel Soto
+ *
+ * No block is allocated until the first arena_alloc.
+ *
+ * @param block_size size of each block (0 for ARENA_BLOCK_SIZE)
+ * @return a pointer to the new arena or NULL if anything went wrong
+ */
+Arena *arena_create(size_t block_size);
+
+/**
+ * @brief Frees an arena and all the memory allocated from it
+ * @author Miguel Soto
+ *
+ * @param arena a pointer to the arena
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS arena_destroy(Arena *arena);
+
+/**
+ * @brief Allocates memory from an arena
+ * @author Miguel Soto
+ *
+ * The memory is suitably aligned for any type and lasts until the arena is
+ * reset or destroyed. Requests bigger than a block get a block of their own.
+ *
+ * @param arena a pointer to the arena
+ * @param size number of bytes
+ * @return a pointer to the memory or NULL if anything went wrong
+ */
+void *arena_alloc(Arena *arena, size_t size);
+
+/**
+ * @brief Releases everything allocated from an arena at once
+ * @author Miguel Soto
+ *
+ * It takes constant time. The blocks are kept, so filling the arena again
+ * up to the same size does not allocate.
+ *
+ * @param arena a pointer to the arena
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS arena_reset(Arena *arena);
+
+/**
+ * @brief Gets the bytes allocated from an arena since it was last reset
+ * @author Miguel Soto
+ *
+ * @param arena a pointer to the arena
+ * @return bytes in use (alignment included), 0 if arena is NULL
+ */
+size_t arena_get_used(Arena *arena);
+
+/**
+ * @brief Gets the highest number of bytes an arena has had in use
+ * @author Miguel Soto
+ *
+ * @param arena a pointer to the arena
+ * @return high-water mark in bytes, 0 if arena is NULL
+ */
+size_t arena_get_high_water(Arena *arena);
+
+/**
+ * @brief Gets the bytes of all the blocks of an arena
+ * @author Miguel Soto
+ *
+ * @param arena a pointer to the arena
+ * @return bytes reserved from the system, 0 if arena is NULL
+ */
+size_t arena_get_reserved(Arena *arena);
+
+/**
+ * @brief Prints the usage of an arena
+ *
+ * @param file stream where the usage is printed
+ * @param arena a pointer to the arena
+ * @return number of printed characters
+ */
+int arena_print(FILE *file, Arena *arena);
+
+#endif
@@ -0,0 +1,67 @@
+/**
+ * @brief It defines the glyph atlas of the graphic descriptions
+ *
+ * The graphic descriptions (gdesc) of spaces, players and enemies are
+ * stored as tiles packed in blocks. Each different drawing is stored once:
+ * entities with the same art share its tile and only keep a pointer to it.
+ * Each game has its own atlas in the arena of its world.
+ *
+ * @file atlas.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ATLAS_H
+#define ATLAS_H
+
+#include "types.h"
+#include "arena.h"
+
+#define ATLAS_TILE_Y 5    /*!< Rows of a tile (the biggest gdesc, the one of the spaces) */
+#define ATLAS_TILE_X 10   /*!< Bytes of a row of a tile (9 characters and '\0') */
+
+typedef char Atlas_row[ATLAS_TILE_X]; /*!< Row of a tile, always ended by '\0' */
+
+typedef struct _Atlas Atlas;
+
+/**
+ * @brief Creates an empty atlas
+ * @author Miguel Soto
+ *
+ * The atlas and its tiles take their memory from the arena, so there is
+ * no destroy: everything goes away with the arena.
+ *
+ * @param arena arena of the atlas
+ * @return a new atlas, or NULL if there was no memory
+ */
+Atlas *atlas_create(Arena *arena);
+
+/**
+ * @brief Adds a drawing to the atlas
+ * @author Miguel Soto
+ *
+ * The rows are copied (at most row_len characters each, missing rows are
+ * left empty). If the same drawing was already in the atlas its tile is
+ * returned and nothing is copied. Tiles never move nor change, so the
+ * pointer is valid as long as the arena of the atlas.
+ *
+ * @param atlas the atlas
+ * @param rows the rows of the drawing (a NULL row is an empty one)
+ * @param n_rows number of rows (at most ATLAS_TILE_Y)
+ * @param row_len maximun characters of each row (at most ATLAS_TILE_X - 1)
+ * @return the ATLAS_TILE_Y rows of the tile, or NULL if anything goes wrong
+ */
+const Atlas_row *atlas_add(Atlas *atlas, const char **rows, int n_rows, int row_len);
+
+/**
+ * @brief Gets the number of different tiles of the atlas
+ * @author Miguel Soto
+ *
+ * @param atlas the atlas
+ * @return number of tiles
+ */
+int atlas_get_count(Atlas *atlas);
+
+#endif
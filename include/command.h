@@ -14,7 +14,7 @@
 #include "types.h"
 
 #define N_CMDT 2 /*!< It defines the number of ways each command can be call (the long and the short name). */
-#define N_CMD 14 /*!< It defines the number of arguments. */
+#define N_CMD 15 /*!< It defines the number of arguments. */
 
 /**
  * @brief It defines the two ways to call a command, by its short name (CMDS) or by its long name (CMDL).
@@ -45,7 +45,8 @@ typedef enum enum_Command
   TURNON,       /*!< Command type is to turn on an object to iluminate space. */
   TURNOFF,      /*!< Command type is to turn off an object so it stops lighting a space. */
   OPEN,         /*!< Command type is to open a link with an object */
-  USE           /*!< Command type is to use an object with the given id */
+  USE,          /*!< Command type is to use an object with the given id */
+  SCROLL        /*!< Command type is to show the next page of a list of the panel (i for the inventory, e for the enemies). It is not a turn. */
 } T_Command;
 
 /**
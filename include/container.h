@@ -0,0 +1,461 @@
+/**
+ * @brief It defines the type-specialized containers of the engine
+ *
+ * Vectors, open-addressed hash maps and ring buffers are generated by
+ * macros for each element type, so there are no void pointers nor
+ * callbacks when they are used. Each instance is declared with
+ * X_DECLARE (in a header or at the top of a .c) and its functions are
+ * generated once with X_DEFINE in one .c. The fields of the structures
+ * are public: elements can be read directly (v.data[i], v.size).
+ *
+ * Like the rest of the engine, a container made in an arena takes all
+ * its memory from it and never frees anything.
+ *
+ * Bitsets are arrays of unsigned long handled with the BITSET_ macros.
+ *
+ * @file container.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef CONTAINER_H
+#define CONTAINER_H
+
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include "types.h"
+#include "arena.h"
+
+#define CONTAINER_MIN 8 /*!< Elements that fit in a container the first time it grows */
+
+/** Hash of an integer key (Id, int, long) */
+#define CONTAINER_HASH_INT(k) ((((unsigned long)(k)) * 2654435761UL) >> 7)
+
+/*
+ * Bitsets
+ */
+
+#define BITSET_WORD_BITS (sizeof(unsigned long) * CHAR_BIT)                      /*!< Bits of a word of a bitset */
+#define BITSET_WORDS(n) (((n) + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS)         /*!< Words of a bitset of n bits */
+#define BITSET_TEST(w, i) (((w)[(i) / BITSET_WORD_BITS] >> ((i) % BITSET_WORD_BITS)) & 1UL) /*!< Value of bit i */
+#define BITSET_SET(w, i) ((w)[(i) / BITSET_WORD_BITS] |= 1UL << ((i) % BITSET_WORD_BITS))    /*!< Sets bit i */
+#define BITSET_CLEAR(w, i) ((w)[(i) / BITSET_WORD_BITS] &= ~(1UL << ((i) % BITSET_WORD_BITS))) /*!< Clears bit i */
+#define BITSET_ZERO(w, n) memset((w), 0, BITSET_WORDS(n) * sizeof(unsigned long)) /*!< Clears the n bits */
+
+/*
+ * Vectors
+ *
+ * Name_init(v, arena)          empty vector (arena may be NULL)
+ * Name_free(v)                 frees the elements, the vector is empty again
+ * Name_reserve(v, n)           makes room for n elements
+ * Name_push(v, x)              appends x
+ * Name_insert(v, pos, x)       inserts x at pos, moving the rest
+ * Name_remove(v, pos)          removes the element at pos, keeping the order
+ * Name_remove_swap(v, pos)     removes the element at pos, the last one takes its place
+ * Name_clear(v)                removes every element
+ */
+
+/** Declares the vector Name of elements of type T */
+#define VECTOR_DECLARE(Name, T)                                                \
+  typedef struct                                                               \
+  {                                                                            \
+    T *data;                                                                   \
+    int size;                                                                  \
+    int capacity;                                                              \
+    Arena *arena;                                                              \
+  } Name;                                                                      \
+  STATUS Name##_init(Name *v, Arena *arena);                                   \
+  void Name##_free(Name *v);                                                   \
+  STATUS Name##_reserve(Name *v, int n);                                       \
+  STATUS Name##_push(Name *v, T x);                                            \
+  STATUS Name##_insert(Name *v, int pos, T x);                                 \
+  STATUS Name##_remove(Name *v, int pos);                                      \
+  STATUS Name##_remove_swap(Name *v, int pos);                                 \
+  void Name##_clear(Name *v)
+
+/** Defines the functions of the vector Name of elements of type T */
+#define VECTOR_DEFINE(Name, T)                                                 \
+  STATUS Name##_init(Name *v, Arena *arena)                                    \
+  {                                                                            \
+    if (!v)                                                                    \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    v->data = NULL;                                                            \
+    v->size = 0;                                                               \
+    v->capacity = 0;                                                           \
+    v->arena = arena;                                                          \
+    return OK;                                                                 \
+  }                                                                            \
+  void Name##_free(Name *v)                                                    \
+  {                                                                            \
+    if (!v->arena)                                                             \
+    {                                                                          \
+      free(v->data);                                                           \
+    }                                                                          \
+    v->data = NULL;                                                            \
+    v->size = 0;                                                               \
+    v->capacity = 0;                                                           \
+  }                                                                            \
+  STATUS Name##_reserve(Name *v, int n)                                        \
+  {                                                                            \
+    T *data = NULL;                                                            \
+    int capacity = v->capacity ? v->capacity : CONTAINER_MIN;                  \
+    if (n <= v->capacity)                                                      \
+    {                                                                          \
+      return OK;                                                               \
+    }                                                                          \
+    while (capacity < n)                                                       \
+    {                                                                          \
+      capacity *= 2;                                                           \
+    }                                                                          \
+    if (v->arena)                                                              \
+    {                                                                          \
+      data = (T *)arena_alloc(v->arena, capacity * sizeof(T));                 \
+      if (data && v->size)                                                     \
+      {                                                                        \
+        memcpy(data, v->data, v->size * sizeof(T));                            \
+      }                                                                        \
+    }                                                                          \
+    else                                                                       \
+    {                                                                          \
+      data = (T *)realloc(v->data, capacity * sizeof(T));                      \
+    }                                                                          \
+    if (!data)                                                                 \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    v->data = data;                                                            \
+    v->capacity = capacity;                                                    \
+    return OK;                                                                 \
+  }                                                                            \
+  STATUS Name##_push(Name *v, T x)                                             \
+  {                                                                            \
+    if (v->size == v->capacity && Name##_reserve(v, v->size + 1) == ERROR)     \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    v->data[v->size++] = x;                                                    \
+    return OK;                                                                 \
+  }                                                                            \
+  STATUS Name##_insert(Name *v, int pos, T x)                                  \
+  {                                                                            \
+    if (pos < 0 || pos > v->size)                                              \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    if (v->size == v->capacity && Name##_reserve(v, v->size + 1) == ERROR)     \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    memmove(v->data + pos + 1, v->data + pos, (v->size - pos) * sizeof(T));   \
+    v->data[pos] = x;                                                          \
+    v->size++;                                                                 \
+    return OK;                                                                 \
+  }                                                                            \
+  STATUS Name##_remove(Name *v, int pos)                                       \
+  {                                                                            \
+    if (pos < 0 || pos >= v->size)                                             \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    v->size--;                                                                 \
+    memmove(v->data + pos, v->data + pos + 1, (v->size - pos) * sizeof(T));   \
+    return OK;                                                                 \
+  }                                                                            \
+  STATUS Name##_remove_swap(Name *v, int pos)                                  \
+  {                                                                            \
+    if (pos < 0 || pos >= v->size)                                             \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    v->data[pos] = v->data[--v->size];                                         \
+    return OK;                                                                 \
+  }                                                                            \
+  void Name##_clear(Name *v)                                                   \
+  {                                                                            \
+    v->size = 0;                                                               \
+  }                                                                            \
+  void Name##_free(Name *v)
+
+/*
+ * Hash maps
+ *
+ * Open addressing with linear probing, kept at most half full. A key equal
+ * to the EMPTY key given to HMAP_DEFINE marks a free entry, so it cannot
+ * be stored. Removing moves back the keys probed after the removed one,
+ * so there are no tombstones.
+ *
+ * Name_init(m, arena)          empty map (arena may be NULL)
+ * Name_free(m)                 frees the entries, the map is empty again
+ * Name_put(m, k, x)            stores x with key k (replacing the old value)
+ * Name_get(m, k)               pointer to the value of k, or NULL
+ * Name_remove(m, k)            removes k
+ * Name_clear(m)                removes every key, keeping the entries
+ */
+
+/** Declares the hash map Name from keys of type K to values of type V */
+#define HMAP_DECLARE(Name, K, V)                                               \
+  typedef struct                                                               \
+  {                                                                            \
+    K key;                                                                     \
+    V value;                                                                   \
+  } Name##_entry;                                                              \
+  typedef struct                                                               \
+  {                                                                            \
+    Name##_entry *entries;                                                     \
+    int n_entries;                                                             \
+    int count;                                                                 \
+    Arena *arena;                                                              \
+  } Name;                                                                      \
+  STATUS Name##_init(Name *m, Arena *arena);                                   \
+  void Name##_free(Name *m);                                                   \
+  STATUS Name##_put(Name *m, K k, V x);                                        \
+  V *Name##_get(Name *m, K k);                                                 \
+  STATUS Name##_remove(Name *m, K k);                                          \
+  void Name##_clear(Name *m)
+
+/** Defines the functions of the hash map Name, HASH(k) gives an unsigned long and EMPTY is the free key */
+#define HMAP_DEFINE(Name, K, V, HASH, EMPTY)                                   \
+  int Name##_probe(Name *m, K k)                                               \
+  {                                                                            \
+    int mask = m->n_entries - 1;                                               \
+    int e = (int)(HASH(k) & (unsigned long)mask);                              \
+    while (m->entries[e].key != (EMPTY) && m->entries[e].key != k)             \
+    {                                                                          \
+      e = (e + 1) & mask;                                                      \
+    }                                                                          \
+    return e;                                                                  \
+  }                                                                            \
+  STATUS Name##_grow(Name *m)                                                  \
+  {                                                                            \
+    Name##_entry *old = m->entries;                                            \
+    int n_old = m->n_entries, i;                                               \
+    int n = n_old ? 2 * n_old : 2 * CONTAINER_MIN;                             \
+    Name##_entry *entries = m->arena ?                                         \
+      (Name##_entry *)arena_alloc(m->arena, n * sizeof(Name##_entry)) :        \
+      (Name##_entry *)malloc(n * sizeof(Name##_entry));                        \
+    if (!entries)                                                              \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    for (i = 0; i < n; i++)                                                    \
+    {                                                                          \
+      entries[i].key = (EMPTY);                                                \
+    }                                                                          \
+    m->entries = entries;                                                      \
+    m->n_entries = n;                                                          \
+    for (i = 0; i < n_old; i++)                                                \
+    {                                                                          \
+      if (old[i].key != (EMPTY))                                               \
+      {                                                                        \
+        m->entries[Name##_probe(m, old[i].key)] = old[i];                      \
+      }                                                                        \
+    }                                                                          \
+    if (!m->arena)                                                             \
+    {                                                                          \
+      free(old);                                                               \
+    }                                                                          \
+    return OK;                                                                 \
+  }                                                                            \
+  STATUS Name##_init(Name *m, Arena *arena)                                    \
+  {                                                                            \
+    if (!m)                                                                    \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    m->entries = NULL;                                                         \
+    m->n_entries = 0;                                                          \
+    m->count = 0;                                                              \
+    m->arena = arena;                                                          \
+    return OK;                                                                 \
+  }                                                                            \
+  void Name##_free(Name *m)                                                    \
+  {                                                                            \
+    if (!m->arena)                                                             \
+    {                                                                          \
+      free(m->entries);                                                        \
+    }                                                                          \
+    m->entries = NULL;                                                         \
+    m->n_entries = 0;                                                          \
+    m->count = 0;                                                              \
+  }                                                                            \
+  STATUS Name##_put(Name *m, K k, V x)                                         \
+  {                                                                            \
+    int e;                                                                     \
+    if (k == (EMPTY))                                                          \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    if (2 * (m->count + 1) > m->n_entries && Name##_grow(m) == ERROR)          \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    e = Name##_probe(m, k);                                                    \
+    if (m->entries[e].key == (EMPTY))                                          \
+    {                                                                          \
+      m->entries[e].key = k;                                                   \
+      m->count++;                                                              \
+    }                                                                          \
+    m->entries[e].value = x;                                                   \
+    return OK;                                                                 \
+  }                                                                            \
+  V *Name##_get(Name *m, K k)                                                  \
+  {                                                                            \
+    int e;                                                                     \
+    if (!m->count || k == (EMPTY))                                             \
+    {                                                                          \
+      return NULL;                                                             \
+    }                                                                          \
+    e = Name##_probe(m, k);                                                    \
+    return m->entries[e].key == (EMPTY) ? NULL : &m->entries[e].value;        \
+  }                                                                            \
+  STATUS Name##_remove(Name *m, K k)                                           \
+  {                                                                            \
+    int mask = m->n_entries - 1, e, next, home;                                \
+    if (!m->count || k == (EMPTY))                                             \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    e = Name##_probe(m, k);                                                    \
+    if (m->entries[e].key == (EMPTY))                                          \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    for (next = (e + 1) & mask; m->entries[next].key != (EMPTY);               \
+         next = (next + 1) & mask)                                             \
+    {                                                                          \
+      home = (int)(HASH(m->entries[next].key) & (unsigned long)mask);          \
+      if ((e <= next) ? (home <= e || home > next) : (home <= e && home > next)) \
+      {                                                                        \
+        m->entries[e] = m->entries[next];                                      \
+        e = next;                                                              \
+      }                                                                        \
+    }                                                                          \
+    m->entries[e].key = (EMPTY);                                               \
+    m->count--;                                                                \
+    return OK;                                                                 \
+  }                                                                            \
+  void Name##_clear(Name *m)                                                   \
+  {                                                                            \
+    int i;                                                                     \
+    for (i = 0; i < m->n_entries; i++)                                         \
+    {                                                                          \
+      m->entries[i].key = (EMPTY);                                             \
+    }                                                                          \
+    m->count = 0;                                                              \
+  }                                                                            \
+  void Name##_free(Name *m)
+
+/*
+ * Ring buffers
+ *
+ * A fixed number of elements (rounded up to a power of 2). When it is
+ * full, pushing drops the oldest element, so it keeps the latest ones.
+ *
+ * Name_init(r, n, arena)       empty ring for n elements (arena may be NULL)
+ * Name_free(r)                 frees the elements
+ * Name_push(r, x)              appends x, dropping the oldest one if full
+ * Name_pop(r, x)               takes out the oldest element into *x
+ * Name_at(r, i)                pointer to the i-th oldest element, or NULL
+ * Name_clear(r)                removes every element
+ */
+
+/** Declares the ring buffer Name of elements of type T */
+#define RING_DECLARE(Name, T)                                                  \
+  typedef struct                                                               \
+  {                                                                            \
+    T *data;                                                                   \
+    int capacity;                                                              \
+    int head;                                                                  \
+    int count;                                                                 \
+    Arena *arena;                                                              \
+  } Name;                                                                      \
+  STATUS Name##_init(Name *r, int n, Arena *arena);                            \
+  void Name##_free(Name *r);                                                   \
+  BOOL Name##_push(Name *r, T x);                                              \
+  STATUS Name##_pop(Name *r, T *x);                                            \
+  T *Name##_at(Name *r, int i);                                                \
+  void Name##_clear(Name *r)
+
+/** Defines the functions of the ring buffer Name of elements of type T */
+#define RING_DEFINE(Name, T)                                                   \
+  STATUS Name##_init(Name *r, int n, Arena *arena)                             \
+  {                                                                            \
+    int capacity = 1;                                                          \
+    if (!r || n <= 0)                                                          \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    while (capacity < n)                                                       \
+    {                                                                          \
+      capacity *= 2;                                                           \
+    }                                                                          \
+    r->data = arena ? (T *)arena_alloc(arena, capacity * sizeof(T)) :          \
+                      (T *)malloc(capacity * sizeof(T));                       \
+    if (!r->data)                                                              \
+    {                                                                          \
+      r->capacity = 0;                                                         \
+      return ERROR;                                                            \
+    }                                                                          \
+    r->capacity = capacity;                                                    \
+    r->head = 0;                                                               \
+    r->count = 0;                                                              \
+    r->arena = arena;                                                          \
+    return OK;                                                                 \
+  }                                                                            \
+  void Name##_free(Name *r)                                                    \
+  {                                                                            \
+    if (!r->arena)                                                             \
+    {                                                                          \
+      free(r->data);                                                           \
+    }                                                                          \
+    r->data = NULL;                                                            \
+    r->capacity = 0;                                                           \
+    r->head = 0;                                                               \
+    r->count = 0;                                                              \
+  }                                                                            \
+  BOOL Name##_push(Name *r, T x)                                               \
+  {                                                                            \
+    r->data[(r->head + r->count) & (r->capacity - 1)] = x;                     \
+    if (r->count == r->capacity)                                               \
+    {                                                                          \
+      r->head = (r->head + 1) & (r->capacity - 1);                             \
+      return TRUE;                                                             \
+    }                                                                          \
+    r->count++;                                                                \
+    return FALSE;                                                              \
+  }                                                                            \
+  STATUS Name##_pop(Name *r, T *x)                                             \
+  {                                                                            \
+    if (!r->count)                                                             \
+    {                                                                          \
+      return ERROR;                                                            \
+    }                                                                          \
+    if (x)                                                                     \
+    {                                                                          \
+      *x = r->data[r->head];                                                   \
+    }                                                                          \
+    r->head = (r->head + 1) & (r->capacity - 1);                               \
+    r->count--;                                                                \
+    return OK;                                                                 \
+  }                                                                            \
+  T *Name##_at(Name *r, int i)                                                 \
+  {                                                                            \
+    if (i < 0 || i >= r->count)                                                \
+    {                                                                          \
+      return NULL;                                                             \
+    }                                                                          \
+    return &r->data[(r->head + i) & (r->capacity - 1)];                        \
+  }                                                                            \
+  void Name##_clear(Name *r)                                                   \
+  {                                                                            \
+    r->head = 0;                                                               \
+    r->count = 0;                                                              \
+  }                                                                            \
+  void Name##_free(Name *r)
+
+#endif
@@ -11,6 +11,7 @@
 #ifndef DIALOGUE_H
 #define DIALOGUE_H
 
+#include <stdio.h>
 #include "types.h"
 #include "object.h"
 #include "space.h"
@@ -174,5 +175,19 @@ char *dialogue_get_error(Dialogue *dialogue);
  */
 STATUS dialogue_set_error(Dialogue *dialogue, E_Enum condition, Space *current_loc, Object *obj, Enemy *enemy);
 
+/**
+ * @brief Writes the dialogue of the last command and its events
+ * @author Miguel Soto
+ *
+ * One line for each text (the error if there was one, the command if not,
+ * then the events), nothing for a text left empty. It is all a game shows
+ * of a turn when nothing is painted.
+ *
+ * @param dialogue pointer to the dialogue
+ * @param file where it is written
+ * @return ERROR if something went wrong
+ */
+STATUS dialogue_print(Dialogue *dialogue, FILE *file);
+
 
 #endif
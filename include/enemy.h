@@ -12,6 +12,8 @@
 #define ENEMY_H
 
 #include "types.h"
+#include "arena.h"
+#include "atlas.h"
 
 #define ENEMY_LEN_NAME 60  /*!< Enemy's name length */
 #define ENEMY_GDESC_Y 3 /*!< Establish the maximun number of litednes ENEMY's graphic description (gdesc) will have  */
@@ -35,6 +37,17 @@ typedef struct _Enemy Enemy;
  */
 Enemy *enemy_create(Id id);
 
+/**
+ * @brief Creates a new enemy whose memory comes from an arena.
+ * @author Miguel Soto
+ *
+ * enemy_destroy does nothing with it, it goes away with the arena.
+ * @param id new enemy's identification number.
+ * @param arena a pointer to the arena (NULL works like enemy_create)
+ * @return a new enemy, initialized, or NULL in case of error.
+ */
+Enemy *enemy_create_in(Id id, Arena *arena);
+
 /**
  * @brief It destroys an enemy
  * @author Antonio Van-Oers 
@@ -179,6 +192,20 @@ int enemy_get_baseDmg(Enemy *enemy);
  */
 STATUS enemy_set_baseDmg(Enemy *enemy, int base_dmg); 
 
+/**
+ * @brief Turns an enemy into a copy of another one
+ * @author Miguel Soto
+ *
+ * Everything but the memory where the enemy lives is copied, and the copy
+ * gets a new id. It lets a record of the pool be used again.
+ *
+ * @param dest a pointer to the enemy that is overwritten
+ * @param src a pointer to the enemy that is copied
+ * @param id id of the copy
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS enemy_copy(Enemy *dest, Enemy *src, Id id);
+
 /**
  * @brief It alloc memory for the enemy_gdesc
  * @author Miguel Soto
@@ -200,19 +227,23 @@ STATUS enemy_destroy_gdesc(char **gdesc);
  * @brief It sets the graphic description of a enemy
  * @author Miguel Soto
  *
+ * The drawing is copied into the atlas (equal drawings share a tile), so
+ * newgdesc still belongs to the caller.
+ *
  * @param s a pointer to enemy
+ * @param atlas the atlas of the world
  * @param newgdesc a double char array with the graphical description
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS enemy_set_gdesc(Enemy *s, char **newgdesc);
+STATUS enemy_set_gdesc(Enemy *s, Atlas *atlas, char **newgdesc);
 
 /**
  * @brief It gets the graphic description from a enemy
  * @author Miguel Soto
  *
  * @param s a pointer to enemy
- * @return a double char array with the graphical description, or NULL if there was some error.
+ * @return the rows of the graphical description (in the atlas), or NULL if there was some error.
  */
-char **enemy_get_gdesc(Enemy *s);
+const Atlas_row *enemy_get_gdesc(Enemy *s);
 
 #endif
@@ -0,0 +1,89 @@
+/**
+ * @brief It defines the single-slot exchange between two threads
+ *
+ * A writer and a reader share EXCHANGE_BUFFERS buffers, given by their
+ * index. Each one owns a buffer and the third is in the slot. The writer
+ * fills its buffer and publishes it: it goes into the slot and the writer
+ * gets the one that was there. The reader takes the slot only if something
+ * new was published since its last take, so it always gets the newest
+ * buffer; the ones published in between are dropped. Neither side waits
+ * for the other, every operation is a single atomic exchange.
+ *
+ * @file exchange.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef EXCHANGE_H
+#define EXCHANGE_H
+
+#include "types.h"
+
+#define EXCHANGE_BUFFERS 3 /*!< Buffers shared through an exchange */
+#define EXCHANGE_WRITER 0  /*!< Buffer owned by the writer when the exchange is created */
+#define EXCHANGE_READER 1  /*!< Buffer owned by the reader when the exchange is created */
+
+typedef struct _Exchange Exchange; /*!< It defines the exchange structure */
+
+/**
+ * @brief Creates an exchange with nothing published
+ * @author Miguel Soto
+ *
+ * @return a pointer to the new exchange or NULL if anything went wrong
+ */
+Exchange *exchange_create();
+
+/**
+ * @brief Frees an exchange
+ * @author Miguel Soto
+ *
+ * @param ex a pointer to the exchange
+ */
+void exchange_destroy(Exchange *ex);
+
+/**
+ * @brief Publishes the buffer of the writer
+ * @author Miguel Soto
+ *
+ * Only the writer may call it. The buffer must not be touched after it.
+ *
+ * @param ex a pointer to the exchange
+ * @param back buffer filled by the writer
+ * @return the buffer the writer owns now, or -1 on error
+ */
+int exchange_publish(Exchange *ex, int back);
+
+/**
+ * @brief Takes the newest buffer published
+ * @author Miguel Soto
+ *
+ * Only the reader may call it.
+ *
+ * @param ex a pointer to the exchange
+ * @param front buffer owned by the reader, given back if a new one is taken
+ * @return the buffer the reader owns now if a new one was published, or -1
+ * if there is nothing new (the reader keeps front)
+ */
+int exchange_take(Exchange *ex, int front);
+
+/**
+ * @brief Gets the number of buffers published
+ * @author Miguel Soto
+ *
+ * @param ex a pointer to the exchange
+ * @return buffers published, or -1 on error
+ */
+long exchange_get_published(Exchange *ex);
+
+/**
+ * @brief Gets the number of buffers published and never taken
+ * @author Miguel Soto
+ *
+ * @param ex a pointer to the exchange
+ * @return buffers dropped, or -1 on error
+ */
+long exchange_get_dropped(Exchange *ex);
+
+#endif
@@ -0,0 +1,124 @@
+/**
+ * @brief It defines the double-buffered frame of the terminal
+ *
+ * A frame keeps the screen that is on the terminal and the one that is being
+ * composed. Painting only sends the cells that changed between both, with
+ * ANSI cursor moves, and the whole frame goes out in a single write().
+ *
+ * @file frame.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stdlib.h>
+#include "types.h"
+
+#define FRAME_BG_CHAR '~' /*!< Background cell, painted blue on blue like libscreen does */
+#define FRAME_GAP 6       /*!< Unchanged cells that are sent anyway to save a cursor move */
+
+typedef struct _Frame Frame; /*!< It defines the frame structure */
+
+/**
+ * @brief Creates a frame
+ * @author Miguel Soto
+ *
+ * Nothing is on the terminal yet, so the first paint sends every cell.
+ *
+ * @param rows rows of the screen
+ * @param columns columns of the screen
+ * @return a pointer to the new frame or NULL if anything went wrong
+ */
+Frame *frame_create(int rows, int columns);
+
+/**
+ * @brief Frees a frame
+ * @author Miguel Soto
+ *
+ * @param frame a pointer to the frame
+ */
+void frame_destroy(Frame *frame);
+
+/**
+ * @brief Copies a composed screen into the frame
+ * @author Miguel Soto
+ *
+ * @param frame a pointer to the frame
+ * @param cells rows * columns characters, row after row
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS frame_load(Frame *frame, const char *cells);
+
+/**
+ * @brief Gets the cells that are being composed
+ * @author Miguel Soto
+ *
+ * @param frame a pointer to the frame
+ * @return rows * columns characters, row after row, or NULL on error
+ */
+char *frame_get_cells(Frame *frame);
+
+/**
+ * @brief Forgets what is on the terminal
+ * @author Miguel Soto
+ *
+ * The next paint clears the terminal and sends every cell, for example
+ * after something else has written over the screen.
+ *
+ * @param frame a pointer to the frame
+ */
+void frame_invalidate(Frame *frame);
+
+/**
+ * @brief Builds the output that takes the terminal to the composed screen
+ * @author Miguel Soto
+ *
+ * After it, the composed screen is taken as the one on the terminal. The
+ * output always ends with the cursor in the line below the screen, which
+ * is cleared, so the prompt is written there.
+ *
+ * @param frame a pointer to the frame
+ * @param len where the bytes of the output are returned
+ * @return the output (valid until the next call) or NULL on error
+ */
+const char *frame_render(Frame *frame, size_t *len);
+
+/**
+ * @brief Paints the composed screen on a file descriptor
+ * @author Miguel Soto
+ *
+ * The output of frame_render is sent with a single write(). The standard
+ * output is flushed before, so it is not mixed with what was printed.
+ *
+ * @param frame a pointer to the frame
+ * @param fd file descriptor of the terminal
+ * @return the bytes written, or -1 if anything went wrong
+ */
+long frame_paint(Frame *frame, int fd);
+
+/**
+ * @brief Gets the bytes sent by the last paint
+ * @author Miguel Soto
+ *
+ * @param frame a pointer to the frame
+ * @return bytes of the last frame_render, or 0 on error
+ */
+size_t frame_get_last_bytes(Frame *frame);
+
+/**
+ * @brief Gets the output of the last paint
+ * @author Miguel Soto
+ *
+ * It is the output of the last frame_render, frame_get_last_bytes long,
+ * so it can be sent somewhere else too.
+ *
+ * @param frame a pointer to the frame
+ * @return the output (valid until the next render), or NULL on error
+ */
+const char *frame_get_last_output(Frame *frame);
+
+#endif
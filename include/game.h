@@ -21,12 +21,12 @@
 #include "inventory.h"
 #include "game_rules.h"
 #include "dialogue.h"
+#include "handle.h"
+#include "obj_type.h"
 
-#define MAX_LINKS 200  /*!< It established the maximun of links that can be in a game */
-#define MAX_SPACES 100  /*!< It established the maximun of spaces that can be in a game */
-#define MAX_ENEMYS 10   /*!< It established the maximun of enemies that can be in a game */
-#define MAX_OBJS 100   /*!< It established the maximun of objects that can be in a game */
+#define MAX_ENEMYS 64   /*!< It established the maximun of live enemies that can be in a game */
 #define MAX_PLAYERS 1  /*!< It established the maximun of players that can be in a game */
+#define GAME_BOSS 45   /*!< Enemy whose death ends the game */
 
 /**
  * @brief Game's structucture
@@ -84,7 +84,8 @@ int game_update(Game *game, T_Command cmd, char *arg1, char *arg2);
   * @author Ignacio Nunez
   *
   * game_destroy frees/destroys all of game's spaces  
-  * calling space_destroy for each one of them
+  * calling space_destroy for each one of them. The registry of object
+  * types, the string pool and the atlas go away with the arena.
   * @param game a pointer to game
   * @return OK if everything goes well or ERROR if there was any mistake
   */
@@ -101,6 +102,18 @@ STATUS game_destroy(Game *game);
   */
 BOOL game_is_over(Game *game);
 
+/**
+  * @brief Checks if the boss of the game (GAME_BOSS) is dead
+  * @author Miguel Soto
+  *
+  * A dead enemy is despawned by game_update_enemy, so a boss that is not
+  * in the game any more is as dead as one without health.
+  *
+  * @param game a pointer to game
+  * @return TRUE if the boss has no health or is not in the game
+  */
+BOOL game_is_boss_dead(Game *game);
+
 /**
   * @brief  Prints all game related relevant data
   * @author Nicolas Victorino
@@ -267,6 +280,9 @@ Id game_get_object_id(Game *game, int num);
  * @brief Function that saves memory for the game in game_loop
  * @author Nicolas Victorino
  * 
+ * It also creates the arena of the world (see game_get_arena), with the
+ * string pool, the atlas and the registry of types of the game in it.
+ * 
  * @return A pointer to the game
  */
 Game* game_alloc2();
@@ -336,6 +352,39 @@ STATUS game_add_player(Game *game, Player *p);
  */
 STATUS game_add_enemy(Game *game, Enemy *e);
 
+/**
+ * @brief Spawns an enemy copied from a model
+ * @author Miguel Soto
+ *
+ * The record comes from the free list of the pool when there is one, so
+ * spawning does not allocate nor look for a free slot. The model can be
+ * any enemy, for example one parked out of the map.
+ *
+ * No command nor event spawns enemies yet, the pool is the groundwork for
+ * them: for now only the dead enemies go through it (game_update_enemy).
+ *
+ * @param game pointer to game
+ * @param model pointer to the enemy that is copied
+ * @param id id of the new enemy (it must not be in use)
+ * @param location space where the enemy appears
+ * @return the new enemy, or NULL if there was any mistake or the game is full
+ */
+Enemy *game_spawn_enemy(Game *game, Enemy *model, Id id, Id location);
+
+/**
+ * @brief Despawns an enemy
+ * @author Miguel Soto
+ *
+ * Its record goes back to the free list of the pool and its handle becomes
+ * stale. The last live enemy takes its slot. game_update_enemy does it
+ * with the dead enemies.
+ *
+ * @param game pointer to game
+ * @param id id of the enemy
+ * @return OK if everything worked correctly and ERROR if there was any mistake
+ */
+STATUS game_despawn_enemy(Game *game, Id id);
+
 /**
  * @brief Adds all game's links
  * @author Miguel Soto
@@ -354,7 +403,7 @@ STATUS game_add_link(Game *game, Link *l);
  * whenever it is located outside this range or its id if it belongs to the game
  * @param game pointer to game
  * @param position integer that marks the position of the space to check
- * @return space_get_id(game->spaces[position]) output will be No_ID
+ * @return space_get_id(game->spaces.data[position]) output will be No_ID
  * whenever it is located outside this range or its id if it belongs to the game.
  */
 Id game_get_space_id_at(Game *game, int position);
@@ -449,6 +498,8 @@ STATUS game_update_object(Game *game);
  * @brief Checks whether an enemy has 0 health and then changes its location to -1
  * @author Nicolas Victorino
  * 
+ * Dead enemies are despawned, so their records go back to the pool.
+ *
  * @param game pointer to game
  * @return ERROR if something went wrong
  */
@@ -458,11 +509,78 @@ STATUS game_update_enemy(Game *game);
  * @brief Frees all the memory allocated in the game structure
  * @author Nicolas Victorino
  * 
+ * Everything loaded in the game arena is released at once, the arena
+ * keeps its blocks for the next load. The registry of object types, the
+ * string pool and the atlas were there too, empty ones are made for the
+ * next load.
+ * 
  * @param game pointer to the game 
  * @return ERROR if something went wrong 
  */
 STATUS game_destroy_load(Game *game);
 
+/**
+ * @brief Gets the arena where the world is loaded
+ * @author Miguel Soto
+ *
+ * Spaces, objects, players, enemies and links created by the loaders come
+ * from this arena, so destroying or reloading the world does not free
+ * them one by one.
+ *
+ * @param game pointer to the game
+ * @return the arena of the game, or NULL if there was an error
+ */
+Arena *game_get_arena(Game *game);
+
+/**
+ * @brief Gets the pool of the texts of the world
+ * @author Miguel Soto
+ *
+ * The loaders intern the names and descriptions there. It is in the arena
+ * of the game, so each game has its own and it is emptied with the world.
+ *
+ * @param game pointer to the game
+ * @return the pool of the game, or NULL if there was an error
+ */
+Strpool *game_get_strpool(Game *game);
+
+/**
+ * @brief Gets the atlas of the drawings of the world
+ * @author Miguel Soto
+ *
+ * The loaders add the gdesc of spaces, players and enemies there. It is in
+ * the arena of the game, so each game has its own.
+ *
+ * @param game pointer to the game
+ * @return the atlas of the game, or NULL if there was an error
+ */
+Atlas *game_get_atlas(Game *game);
+
+/**
+ * @brief Gets the registry of object types of the world
+ * @author Miguel Soto
+ *
+ * The #t: lines of the map are loaded there. It is in the arena of the
+ * game, so each game has its own.
+ *
+ * @param game pointer to the game
+ * @return the registry of the game, or NULL if there was an error
+ */
+Obj_types *game_get_types(Game *game);
+
+/**
+ * @brief Gets the handle of the entity with an id
+ * @author Miguel Soto
+ *
+ * The ids of the map are translated when the entities are added to the
+ * game; the kind of the entity is HANDLE_KIND of the handle.
+ *
+ * @param game pointer to the game
+ * @param id id of the entity in the map
+ * @return the handle, or NO_HANDLE if no entity of the world has that id
+ */
+Handle game_get_handle(Game *game, Id id);
+
 
 /**
  * @brief Gets the enemy that is in space location
@@ -473,6 +591,29 @@ STATUS game_destroy_load(Game *game);
  */
 Enemy *game_get_enemy_in_space(Game *game, Id space);
 
+/**
+ * @brief Counts the live enemies in a space
+ * @author Miguel Soto
+ *
+ * The game keeps the enemies of each space, so nothing is walked.
+ *
+ * @param game pointer to game
+ * @param space space id
+ * @return number of enemies in the space, 0 in case of error
+ */
+int game_count_enemies_in_space(Game *game, Id space);
+
+/**
+ * @brief Gets an enemy of a space by its order of arrival
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param space space id
+ * @param position position of the enemy among the ones in the space (0 is the first one that got there)
+ * @return pointer to the enemy, or NULL if there is no enemy in that position or in case of error
+ */
+Enemy *game_get_enemy_in_space_at(Game *game, Id space, int position);
+
 /**
  * @brief Function to check if player is alive
  * @author Nicolas Victorino
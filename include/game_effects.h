@@ -0,0 +1,76 @@
+/**
+ * @brief It defines the effects of the objects
+ *
+ * Every object type of the registry (obj_type) points to one effect of a
+ * table. An effect has a handler for the use command and/or one for the
+ * take command, so using or taking an object is a single indexed call and
+ * new types only need a #t: line in the map.
+ *
+ * @file game_effects.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef GAME_EFFECTS_H
+#define GAME_EFFECTS_H
+
+#include "game.h"
+#include "obj_type.h"
+
+/**
+ * @brief Finds an effect by its name
+ * @author Miguel Soto
+ *
+ * @param name name of the effect as written in the map file
+ * @return its index in the table, or -1 if there is no effect with that name
+ */
+int game_effects_find(const char *name);
+
+/**
+ * @brief Gets the name of an effect
+ * @author Miguel Soto
+ *
+ * @param effect index of the effect
+ * @return its name, or NULL if the index is not valid
+ */
+const char *game_effects_get_name(int effect);
+
+/**
+ * @brief Uses an object
+ * @author Miguel Soto
+ *
+ * The player has to carry the object, or be in the same space for the
+ * effects that are used where the object is (like the beds). The handler
+ * sets the dialogue when it succeeds.
+ *
+ * @param game pointer to game
+ * @param player the player that uses the object
+ * @param obj the object
+ * @return OK if the object was used, or ERROR if it can't be used
+ */
+STATUS game_effects_use(Game *game, Player *player, Object *obj);
+
+/**
+ * @brief Applies the effect an object has when it is taken
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param player the player that took the object
+ * @param obj the object
+ * @return TRUE if the object had an effect (and set the dialogue), or FALSE if not
+ */
+BOOL game_effects_take(Game *game, Player *player, Object *obj);
+
+/**
+ * @brief Prints the registry of object types in the save file
+ * @author Miguel Soto
+ *
+ * @param types the registry of types of the game
+ * @param filename name of the save file
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS game_effects_print_save(Obj_types *types, char *filename);
+
+#endif
@@ -15,6 +15,7 @@
 #include "space.h" 
 #include "types.h"
 #include "game.h"
+#include "map_data.h"
 
 /**
  * @brief It is used to classify ids as a game element which could be any type from a space or player, to an object or enemy
@@ -38,6 +39,20 @@ typedef enum
   */
 STATUS game_create_from_file(Game *game, char *filename);
 
+/**
+  * @brief Creates and initializes a game from a precompiled map
+  * @author Miguel Soto
+  *
+  * game_create_from_map initializes all of game's members from the tables
+  * generated by map_compiler, so no file is opened nor parsed.
+  * The names and descriptions of spaces and the descriptions of objects
+  * are not copied, the entities point at the tables (see map_data.h).
+  * @param game pointer to game
+  * @param map pointer to the precompiled map
+  * @return OK, if everything goes well or ERROR if something didn't
+  */
+STATUS game_create_from_map(Game *game, const Map_data *map);
+
 /**
  * @brief Saves the information of the actual game in the save file
  * @author Nicolas Victorino
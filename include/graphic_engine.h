@@ -34,6 +34,17 @@ typedef struct _Graphic_engine Graphic_engine;
   */
 Graphic_engine *graphic_engine_create();
 
+/**
+  * @brief Creates a graphic engine that paints nothing
+  * @author Miguel Soto
+  *
+  * Used to run command files in batch: no screen or area is created and
+  * libscreen is never called. Painting a game only writes its dialogue
+  * and events, one line each, to the standard output.
+  * @return the engine if everything goes well or NULL if something went wrong
+  */
+Graphic_engine *graphic_engine_create_headless();
+
 /**
   * @brief Destroys every member of the graphic engine
   * @author Profesores PPROG
@@ -57,6 +68,69 @@ void graphic_engine_destroy(Graphic_engine *ge);
   */
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st);
 
+/**
+  * @brief Paints in a thread of its own
+  * @author Miguel Soto
+  *
+  * From now on graphic_engine_paint_game only takes the snapshot of the
+  * game and hands it to the render thread, which paints the newest one it
+  * has (see exchange.h). The game never waits for the terminal; turns
+  * taken while a frame is being painted are not painted.
+  * @param ge pointer to the graphic engine, not headless
+  * @return OK if the thread is running, ERROR if the engine keeps painting by itself
+  */
+STATUS graphic_engine_start_thread(Graphic_engine *ge);
+
+/**
+  * @brief Ends the render thread
+  * @author Miguel Soto
+  *
+  * The last snapshot handed to the thread is painted before it ends. It does
+  * nothing if there is no thread.
+  * @param ge pointer to the graphic engine
+  */
+void graphic_engine_stop_thread(Graphic_engine *ge);
+
+/**
+  * @brief Sends every frame painted to spectators
+  * @author Miguel Soto
+  *
+  * It listens on a Unix domain socket, see stream.h. A viewer only needs
+  * to connect to it (nc -U <socket>); it gets the whole screen with the
+  * next frame painted and its changes from then on. The frames are sent
+  * by whoever paints them, so it must be started before the render thread.
+  * @param ge pointer to the graphic engine, not headless
+  * @param path path of the socket
+  * @return OK if the socket is listening, ERROR if not (or if there is a stream or a render thread already)
+  */
+STATUS graphic_engine_start_stream(Graphic_engine *ge, const char *path);
+
+/**
+  * @brief Records every frame painted in a file
+  * @author Miguel Soto
+  *
+  * See record.h; the record is closed with the engine and can be played
+  * with record_player. Like the stream, it must be started before the
+  * render thread.
+  * @param ge pointer to the graphic engine, not headless
+  * @param path file of the record
+  * @return OK if the file was created, ERROR if not (or if there is a record or a render thread already)
+  */
+STATUS graphic_engine_start_record(Graphic_engine *ge, const char *path);
+
+/**
+  * @brief Shows the next page of a list of the description panel
+  * @author Miguel Soto
+  *
+  * Only a page of the inventory and of the enemies of the room is shown;
+  * after the last page comes the first one again. It is shown the next
+  * time the game is painted.
+  * @param ge pointer to the graphic engine
+  * @param list "i" (or "inventory") or "e" (or "enemies")
+  * @return OK if the list exists, ERROR if not
+  */
+STATUS graphic_engine_scroll(Graphic_engine *ge, const char *list);
+
 /**
   * @brief Writes down the last inputted command
   * @author Profesores PPROG
@@ -0,0 +1,136 @@
+/**
+ * @brief It defines the tagged handles of the entities of the game
+ *
+ * A handle is a 32 bit value: the kind of the entity in the high bits, a
+ * generation in the middle ones and the index of the entity in its game
+ * array in the low ones. Checking the kind or finding the entity only takes
+ * bit operations and an array index, and a handle kept after its entity
+ * was released (or the world reloaded) is detected by its generation.
+ *
+ * Maps keep using the numeric ids; the handle table translates them when
+ * the entities are loaded. Handles are bookkeeping of the game only (its
+ * lookups by id): links, sets, inventories and saved games still refer to
+ * the entities by their ids.
+ *
+ * @file handle.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef HANDLE_H
+#define HANDLE_H
+
+#include "types.h"
+
+typedef unsigned long Handle; /*!< Handle of an entity (only the low 32 bits are used) */
+
+#define NO_HANDLE 0UL            /*!< Handle that refers to no entity */
+#define HANDLE_KIND_SHIFT 28     /*!< First bit of the kind */
+#define HANDLE_GEN_SHIFT 16      /*!< First bit of the generation */
+#define HANDLE_KIND_MASK 0xFUL   /*!< Bits of the kind (once shifted) */
+#define HANDLE_GEN_MASK 0xFFFUL  /*!< Bits of the generation (once shifted) */
+#define HANDLE_INDEX_MASK 0xFFFFUL /*!< Bits of the index */
+
+/** Builds a handle from its kind, generation and index */
+#define HANDLE_MAKE(kind, gen, index) \
+  ((((unsigned long)(kind) & HANDLE_KIND_MASK) << HANDLE_KIND_SHIFT) | \
+   (((unsigned long)(gen) & HANDLE_GEN_MASK) << HANDLE_GEN_SHIFT) | \
+   ((unsigned long)(index) & HANDLE_INDEX_MASK))
+#define HANDLE_KIND(h) ((Handle_kind)(((h) >> HANDLE_KIND_SHIFT) & HANDLE_KIND_MASK)) /*!< Kind of a handle */
+#define HANDLE_GEN(h) ((unsigned int)(((h) >> HANDLE_GEN_SHIFT) & HANDLE_GEN_MASK))   /*!< Generation of a handle */
+#define HANDLE_INDEX(h) ((int)((h) & HANDLE_INDEX_MASK))                               /*!< Index of a handle */
+
+/**
+ * @brief Kinds of entities (the same numbers as the first digit of their ids)
+ */
+typedef enum
+{
+  HANDLE_NONE = 0,               /*!< No entity */
+  HANDLE_SPACE = FD_ID_SPACE,    /*!< Space */
+  HANDLE_PLAYER = FD_ID_PLAYER,  /*!< Player */
+  HANDLE_OBJECT = FD_ID_OBJ,     /*!< Object */
+  HANDLE_ENEMY = FD_ID_ENEMY,    /*!< Enemy */
+  HANDLE_LINK = FD_ID_LINK,      /*!< Link */
+  HANDLE_KINDS                   /*!< Number of kinds */
+} Handle_kind;
+
+typedef struct _Handle_table Handle_table; /*!< It defines the handle table structure */
+
+/**
+ * @brief Creates an empty handle table
+ * @author Miguel Soto
+ *
+ * @return a pointer to the new table or NULL if there was no memory
+ */
+Handle_table *handle_table_create();
+
+/**
+ * @brief Frees a handle table
+ * @author Miguel Soto
+ *
+ * @param table a pointer to the table
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS handle_table_destroy(Handle_table *table);
+
+/**
+ * @brief Gives a handle to an entity and keeps the translation of its id
+ * @author Miguel Soto
+ *
+ * If the id already had a handle it is replaced.
+ *
+ * @param table a pointer to the table
+ * @param id id of the entity in the map
+ * @param kind kind of the entity
+ * @param index index of the entity in its game array
+ * @return the handle, or NO_HANDLE if anything goes wrong
+ */
+Handle handle_table_add(Handle_table *table, Id id, Handle_kind kind, int index);
+
+/**
+ * @brief Translates an id to the handle of its entity
+ * @author Miguel Soto
+ *
+ * @param table a pointer to the table
+ * @param id id of the entity
+ * @return the handle, or NO_HANDLE if the id has none or it was released
+ */
+Handle handle_table_find(Handle_table *table, Id id);
+
+/**
+ * @brief Checks that a handle still refers to its entity
+ * @author Miguel Soto
+ *
+ * @param table a pointer to the table
+ * @param handle handle to check
+ * @return TRUE if the handle is valid, FALSE if it is stale or wrong
+ */
+BOOL handle_table_is_valid(Handle_table *table, Handle handle);
+
+/**
+ * @brief Releases the slot of a handle
+ * @author Miguel Soto
+ *
+ * The generation of the slot changes, so every copy of the handle becomes
+ * stale and the next entity given that slot gets a new handle.
+ *
+ * @param table a pointer to the table
+ * @param handle handle to release
+ * @return OK if everything goes well, or ERROR if the handle was not valid
+ */
+STATUS handle_table_release(Handle_table *table, Handle handle);
+
+/**
+ * @brief Forgets every id and releases every handle
+ * @author Miguel Soto
+ *
+ * It is done when the world is loaded again.
+ *
+ * @param table a pointer to the table
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS handle_table_reset(Handle_table *table);
+
+#endif
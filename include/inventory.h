@@ -15,6 +15,8 @@
 #include "set.h"
 #include "object.h"
 
+#define INVENTORY_TYPES (MAX_OBJ_TYPES + 1) /*!< Buckets of an inventory, one per Obj_type (UNKNOWN_TYPE included) */
+
 typedef struct _Inventory Inventory; /*!< It defines the inventory structure, used by the player to store the items */
 
 /**
@@ -27,6 +29,16 @@ typedef struct _Inventory Inventory; /*!< It defines the inventory structure, us
   */
 Inventory* inventory_create();
 
+/**
+  * @brief It creates a new inventory whose memory comes from an arena
+  * @author Miguel Soto
+  *
+  * inventory_destroy does nothing with it, it goes away with the arena.
+  * @param arena a pointer to the arena (NULL works like inventory_create)
+  * @return a new inventory, initialized
+  */
+Inventory* inventory_create_in(Arena *arena);
+
 /**
   * @brief It destroys an inventory
   * @author Ignacio Nunnez
@@ -51,6 +63,8 @@ Set *inventory_get_objects(Inventory* inventory);
   * @brief It sets the objects of an inventory
   * @author Ignacio Nunnez
   * 
+  * Only the ids come with the set, so the buckets and the equipment
+  * summary are left empty.
   * @param inventory a pointer to the inventory
   * @param set a pointer to the set for the inventory
   * @return OK, if everything goes well or ERROR if there was some mistake 
@@ -80,12 +94,14 @@ int inventory_get_maxObjs(Inventory *inventory);
   * @brief It adds an objects to the inventory
   * @author Ignacio Nunnez
   * 
+  * The object goes to the bucket of its type and the equipment
+  * summary is updated.
   * @param inventory a pointer to the inventory
-  * @param object the id of a the new object
+  * @param object a pointer to the new object
   * @return OK, if everything goes well or ERROR if there was some mistake
   * it can return ERROR if the inventory is full
   */
-STATUS inventory_add_object(Inventory* inventory, Id object);
+STATUS inventory_add_object(Inventory* inventory, Object *object);
 
 /**
   * @brief It removes an objects of the inventory
@@ -107,6 +123,75 @@ STATUS inventory_remove_object(Inventory* inventory, Id object);
   */
 BOOL inventory_has_id(Inventory* inventory, Id object);
 
+/**
+  * @brief It tells if an inventory is full
+  * @author Miguel Soto
+  * 
+  * @param inventory a pointer to the inventory
+  * @return TRUE, if no more objects fit (or inventory is NULL) or FALSE if not
+  */
+BOOL inventory_is_full(Inventory *inventory);
+
+/**
+  * @brief It gets the number of objects of a type in an inventory
+  * @author Miguel Soto
+  * 
+  * @param inventory a pointer to the inventory
+  * @param type the type of the objects
+  * @return the number of objects of that type, or -1 if there was some mistake
+  */
+int inventory_count_type(Inventory *inventory, Obj_type type);
+
+/**
+  * @brief It gets an object of the bucket of a type
+  * @author Miguel Soto
+  * 
+  * @param inventory a pointer to the inventory
+  * @param type the type of the object
+  * @param n position of the object in the bucket (from 0)
+  * @return the object, or NULL if there is no such object
+  */
+Object *inventory_get_type_object(Inventory *inventory, Obj_type type, int n);
+
+/**
+  * @brief It gets the weapon in hand of an inventory
+  * @author Miguel Soto
+  *
+  * It is the sword with the lowest id, used until it breaks.
+  * @param inventory a pointer to the inventory
+  * @return the weapon, or NULL if there is no sword in the inventory
+  */
+Object *inventory_get_weapon(Inventory *inventory);
+
+/**
+  * @brief It gets the durability left of the weapon in hand
+  * @author Miguel Soto
+  * 
+  * @param inventory a pointer to the inventory
+  * @return the durability, or 0 if there is no weapon
+  */
+int inventory_get_weapon_durability(Inventory *inventory);
+
+/**
+  * @brief It gets the crit chance given by the objects of an inventory
+  * @author Miguel Soto
+  * 
+  * @param inventory a pointer to the inventory
+  * @return the highest crit chance of the objects carried (0 if none)
+  */
+int inventory_get_crit_bonus(Inventory *inventory);
+
+/**
+  * @brief It removes one durability point from the weapon in hand
+  * @author Miguel Soto
+  *
+  * The object is updated too. A weapon with 0 durability is not removed,
+  * that is up to the caller.
+  * @param inventory a pointer to the inventory
+  * @return the durability left, or -1 if there is no weapon
+  */
+int inventory_wear_weapon(Inventory *inventory);
+
 /**
   * @brief It prints the inventory information
   * @author Ignacio Nunnez
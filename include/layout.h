@@ -0,0 +1,80 @@
+/**
+ * @brief It defines the cache of the texts laid out in the areas
+ *
+ * An area wraps a line every width characters (see screen_area_puts), so
+ * the rows of a text only depend on the text and the width of the area.
+ * The cache keeps the rows of the texts painted last, found by their
+ * content (a hash and the length, then the text itself), so a text may
+ * come from any buffer, even one rewritten every turn. Painting a text that
+ * was laid out before is then a copy of its rows.
+ *
+ * @file layout.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+#include "types.h"
+
+#define LAYOUT_ENTRIES 16 /*!< Texts kept laid out, the one used the longest ago is replaced */
+
+typedef struct _Layout_cache Layout_cache; /*!< It defines the layout cache structure */
+
+/**
+ * @brief Creates an empty layout cache
+ * @author Miguel Soto
+ *
+ * @return a pointer to the new cache or NULL if anything went wrong
+ */
+Layout_cache *layout_cache_create();
+
+/**
+ * @brief Frees a layout cache and all its rows
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ */
+void layout_cache_destroy(Layout_cache *cache);
+
+/**
+ * @brief Gets the rows of a text, laying it out only if it is not cached
+ * @author Miguel Soto
+ *
+ * The rows are the text after indent spaces, cut every width characters,
+ * the last one filled with spaces. They go one after another in a single
+ * string, so screen_area_puts writes them as the same rows it would write
+ * for the text. It may replace their special characters, which does not
+ * move them. The rows are valid until the text is laid out again.
+ *
+ * @param cache a pointer to the cache
+ * @param text the text
+ * @param indent spaces before the text
+ * @param width columns of the area
+ * @param n_rows if not NULL, it gets the number of rows
+ * @return the rows, or NULL on error
+ */
+char *layout_cache_get(Layout_cache *cache, const char *text, int indent, int width, int *n_rows);
+
+/**
+ * @brief Gets the number of texts laid out since the cache was created
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ * @return texts laid out (not taken from the cache), or -1 on error
+ */
+long layout_cache_get_layouts(Layout_cache *cache);
+
+/**
+ * @brief Gets the number of texts taken from the cache
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ * @return texts whose rows were already cached, or -1 on error
+ */
+long layout_cache_get_hits(Layout_cache *cache);
+
+#endif
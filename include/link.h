@@ -13,6 +13,7 @@
 #define LINK_H
 
 #include "types.h"
+#include "arena.h"
 
 #define LINK_NAME_LEN 40    /*!< Establish link's name length*/
 
@@ -40,6 +41,18 @@ typedef struct _Link Link; /*!< It defines the link structure that determines wh
  */
 Link *link_create(Id id);
 
+/**
+ * @brief It creates a new link whose memory comes from an arena.
+ * @author Miguel Soto
+ * 
+ * link_destroy does nothing with it, it goes away with the arena.
+ * 
+ * @param id The id of the new link.
+ * @param arena a pointer to the arena (NULL works like link_create)
+ * @return a pointer to link, or NULL if there was some error.
+ */
+Link *link_create_in(Id id, Arena *arena);
+
 /**
  * @brief It frees the memory of a link's struct.
  * @author Miguel Soto
@@ -0,0 +1,153 @@
+/**
+ * @brief It defines the precompiled map tables
+ *
+ * A map file (map.dat) can be turned into a C source of constant tables
+ * with the map_compiler tool. The engine can then boot from those tables
+ * directly, without opening or parsing any file. The names and descriptions
+ * of spaces and the descriptions of objects are not copied either: they
+ * point at the literals of these tables. Drawings still go to the atlas,
+ * which shares equal tiles, and the short names of objects, players and
+ * enemies are copied into their fixed buffers.
+ *
+ * @file map_data.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef MAP_DATA_H
+#define MAP_DATA_H
+
+#include "types.h"
+#include "space.h"
+#include "player.h"
+#include "enemy.h"
+#include "link.h"
+
+/**
+ * @brief Space row of a precompiled map (#s: line)
+ */
+typedef struct
+{
+  Id id;                              /*!< Space's id */
+  const char *name;                   /*!< Space's name */
+  const char *brief_description;      /*!< Space's brief description */
+  const char *long_description;       /*!< Space's long description */
+  Light ls;                           /*!< Initial light status */
+  const char *gdesc[TAM_GDESC_Y];     /*!< Graphic description rows */
+  Floor floor;                        /*!< Floor of the space */
+  BOOL fire;                          /*!< If there is fire in the space */
+} Map_space;
+
+/**
+ * @brief Object row of a precompiled map (#o: line)
+ */
+typedef struct
+{
+  Id id;                 /*!< Object's id */
+  const char *name;      /*!< Object's name */
+  const char *description; /*!< Object's description */
+  Id location;           /*!< Initial location of the object */
+  BOOL movable;          /*!< Movable condition */
+  Id dependency;         /*!< Dependency condition */
+  Id open;               /*!< Link that the object opens */
+  BOOL illuminate;       /*!< Illuminate condition */
+  BOOL turnedon;         /*!< Turned on condition */
+  Light light_visible;   /*!< Light in which the object is visible */
+  int crit;              /*!< Critical chance it gives */
+  int durability;        /*!< Durability points */
+} Map_object;
+
+/**
+ * @brief Player row of a precompiled map (#p: line)
+ */
+typedef struct
+{
+  Id id;                                /*!< Player's id */
+  const char *name;                     /*!< Player's name */
+  Id location;                          /*!< Initial location */
+  int health;                           /*!< Initial health */
+  int max_objs;                         /*!< Inventory capacity */
+  int crit;                             /*!< Critical chance */
+  int base_dmg;                         /*!< Base damage */
+  const char *gdesc[PLAYER_GDESC_Y];    /*!< Graphic description rows */
+} Map_player;
+
+/**
+ * @brief Enemy row of a precompiled map (#e: line)
+ */
+typedef struct
+{
+  Id id;                                /*!< Enemy's id */
+  const char *name;                     /*!< Enemy's name */
+  Id location;                          /*!< Initial location */
+  int health;                           /*!< Initial health */
+  int crit;                             /*!< Critical chance */
+  int base_dmg;                         /*!< Base damage */
+  const char *gdesc[ENEMY_GDESC_Y];     /*!< Graphic description rows */
+} Map_enemy;
+
+/**
+ * @brief Link row of a precompiled map (#l: line)
+ */
+typedef struct
+{
+  Id id;                 /*!< Link's id */
+  const char *name;      /*!< Link's name */
+  Id start;              /*!< Origin space */
+  Id destination;        /*!< Destination space */
+  DIRECTION direction;   /*!< Direction of the link */
+  LINK_STATUS status;    /*!< Initial status */
+} Map_link;
+
+/**
+ * @brief Object type row of a precompiled map (#t: line)
+ */
+typedef struct
+{
+  Obj_type type;         /*!< Number of the type */
+  const char *name;      /*!< Type's name */
+  Id first;              /*!< Lowest object id of the type */
+  Id last;               /*!< Highest object id of the type */
+  const char *effect;    /*!< Name of its effect */
+  int param1;            /*!< First parameter of the effect */
+  int param2;            /*!< Second parameter of the effect */
+} Map_type;
+
+/**
+ * @brief Inventory row of a precompiled map (#i: line)
+ */
+typedef struct
+{
+  Id object;             /*!< Object carried */
+  Id player;             /*!< Player that carries it */
+} Map_inventory;
+
+/**
+ * @brief A whole precompiled map
+ */
+typedef struct
+{
+  const Map_space *spaces;          /*!< Spaces table */
+  int n_spaces;                     /*!< Number of spaces */
+  const Map_object *objects;        /*!< Objects table */
+  int n_objects;                    /*!< Number of objects */
+  const Map_player *players;        /*!< Players table */
+  int n_players;                    /*!< Number of players */
+  const Map_enemy *enemies;         /*!< Enemies table */
+  int n_enemies;                    /*!< Number of enemies */
+  const Map_link *links;            /*!< Links table */
+  int n_links;                      /*!< Number of links */
+  const Map_inventory *inventory;   /*!< Inventory table */
+  int n_inventory;                  /*!< Number of inventory rows */
+  const Map_type *types;            /*!< Object types table */
+  int n_types;                      /*!< Number of object types */
+} Map_data;
+
+/**
+ * @brief Map compiled into the binary (only in embedded builds)
+ */
+extern const Map_data embedded_map;
+
+#endif
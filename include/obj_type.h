@@ -0,0 +1,122 @@
+/**
+ * @brief It defines the registry of object types
+ *
+ * The types of the objects are loaded from the map file (#t: lines). Each
+ * type covers a range of object ids and carries the effect it has when it
+ * is used or taken, with the parameters of that effect. The effects
+ * themselves are in the table of the game_effects module. Each game has
+ * its own registry in the arena of its world.
+ *
+ * @file obj_type.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef OBJ_TYPE_H
+#define OBJ_TYPE_H
+
+#include "types.h"
+#include "arena.h"
+#include "strpool.h"
+
+#define OBJ_TYPE_NO_EFFECT 0 /*!< Effect of the types that do nothing (the first one of the table) */
+
+typedef struct _Obj_types Obj_types;
+
+/**
+ * @brief Creates an empty registry
+ * @author Miguel Soto
+ *
+ * The registry takes its memory from the arena, so there is no destroy:
+ * it goes away with the arena. The names of the types are interned in
+ * the pool.
+ *
+ * @param arena arena of the registry
+ * @param pool pool for the names of the types
+ * @return a new registry, or NULL if anything goes wrong
+ */
+Obj_types *obj_type_create(Arena *arena, Strpool *pool);
+
+/**
+ * @brief Adds a type to the registry
+ * @author Miguel Soto
+ *
+ * If the type was already registered it is replaced, so loading the
+ * same map (or a saved game) again is harmless.
+ *
+ * @param types the registry
+ * @param type number of the type (0 to MAX_OBJ_TYPES - 1)
+ * @param name name of the type
+ * @param first lowest object id of the type
+ * @param last highest object id of the type
+ * @param effect index of its effect in the table of game_effects
+ * @param param1 first parameter of the effect
+ * @param param2 second parameter of the effect
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS obj_type_add(Obj_types *types, Obj_type type, const char *name, Id first, Id last, int effect, int param1, int param2);
+
+/**
+ * @brief Gets the type of an object
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param id id of the object
+ * @return the type whose range has the id, or UNKNOWN_TYPE if there is none
+ */
+Obj_type obj_type_of(Obj_types *types, Id id);
+
+/**
+ * @brief Gets the name of a type
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param type the type
+ * @return its name, or NULL if it is not registered
+ */
+const char *obj_type_get_name(Obj_types *types, Obj_type type);
+
+/**
+ * @brief Gets the effect of a type
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param type the type
+ * @return index of its effect, OBJ_TYPE_NO_EFFECT if it is not registered
+ */
+int obj_type_get_effect(Obj_types *types, Obj_type type);
+
+/**
+ * @brief Gets a parameter of the effect of a type
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param type the type
+ * @param n number of the parameter (1 or 2)
+ * @return the parameter, or -1 if there is no such parameter
+ */
+int obj_type_get_param(Obj_types *types, Obj_type type, int n);
+
+/**
+ * @brief Gets the first object id of a type
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param type the type
+ * @return lowest id of its range, or NO_ID if it is not registered
+ */
+Id obj_type_get_first(Obj_types *types, Obj_type type);
+
+/**
+ * @brief Gets the last object id of a type
+ * @author Miguel Soto
+ *
+ * @param types the registry
+ * @param type the type
+ * @return highest id of its range, or NO_ID if it is not registered
+ */
+Id obj_type_get_last(Obj_types *types, Obj_type type);
+
+#endif
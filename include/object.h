@@ -12,6 +12,8 @@
 #define OBJECT_H
 
 #include "types.h"
+#include "strpool.h"
+#include "arena.h"
 
 #define OBJ_NAME_LEN 40   /*!< Establish maximun length of object's name */
 
@@ -28,6 +30,17 @@ typedef struct _Object Object;  /*!< It defines the object structure, which can
  */
 Object *obj_create(Id id);
 
+/**
+ * @brief Creates a new object whose memory comes from an arena
+ * @author Miguel Soto
+ *
+ * obj_destroy does nothing with it, it goes away with the arena.
+ * @param id is the target object's id
+ * @param arena a pointer to the arena (NULL works like obj_create)
+ * @return a new object (type Object) initialized, or NULL if anything goes wrong.
+ */
+Object *obj_create_in(Id id, Arena *arena);
+
 /**
  * @brief Destroys an object
  * @author Miguel Soto
@@ -90,11 +103,26 @@ const char *obj_get_description(Object *obj);
  * @author Miguel Soto
  * 
  * obj_set_descripcion sets the description of the object (obj).
+ * The object keeps the copy of the string pool, so objects with the same
+ * description share it.
  * @param obj pointer to given object
+ * @param pool the pool of the texts of the world
  * @param description string with the new description of the object
  * @return OK, if everything is right ERROR, if there was a mistake
  */
-STATUS obj_set_description(Object *obj, char *descripcion);
+STATUS obj_set_description(Object *obj, Strpool *pool, char *descripcion);
+
+/**
+ * @brief Makes an object point at a description that is never freed nor changed
+ * @author Miguel Soto
+ *
+ * Nothing is copied: the description must last longer than the object, as
+ * the literals of a map compiled into the program do (see map_data.h).
+ * @param obj pointer to given object
+ * @param description the description
+ * @return OK, if everything is right ERROR, if there was a mistake
+ */
+STATUS obj_borrow_description(Object *obj, const char *description);
 
 /**
  * @brief Gets an object's position
@@ -253,11 +281,22 @@ BOOL obj_is_visible(Object *obj, Light ls);
 /**
  * @brief Gets the type of an object (apple, bed...)
  * 
+ * It is the one the registry of types (obj_type) of its world gave it.
  * @author Nicolas Victorino
- * @param id 
+ * @param obj pointer to given object
  * @return Object type or UNKOWN_TYPE if error
  */
-Obj_type obj_get_type(Id id);
+Obj_type obj_get_type(Object *obj);
+
+/**
+ * @brief Sets the type of an object
+ * @author Miguel Soto
+ *
+ * @param obj pointer to given object
+ * @param type its type in the registry of types of its world
+ * @return OK, if everything is right ERROR, if there was a mistake
+ */
+STATUS obj_set_type(Object *obj, Obj_type type);
 
 /**
  * @brief Gets the crit_damage of an object
@@ -14,6 +14,7 @@
 #include "types.h"
 #include "object.h"
 #include "inventory.h"
+#include "atlas.h"
 
 #define PLAYER_NAME_LEN 60   /*!< Establish player's name length */
 #define PLAYER_GDESC_Y 3 /*!< Establish the maximun number of litednes player's graphic description (gdesc) will have  */
@@ -32,6 +33,17 @@ typedef struct _Player Player; /*!< It defines the player structure, it can move
  */
 Player *player_create(Id id);
 
+/**
+ * @brief Creates a new player whose memory comes from an arena.
+ * @author Miguel Soto
+ *
+ * Its inventory is also in the arena. player_destroy does nothing with it.
+ * @param id is the target player's id
+ * @param arena a pointer to the arena (NULL works like player_create)
+ * @return a new, initialized player, or NULL if anything goes wrong.
+ */
+Player *player_create_in(Id id, Arena *arena);
+
 /**
  * @brief Frees all of a player's allocated memory
  * @author Antonio Van-Oers 
@@ -266,19 +278,23 @@ STATUS player_destroy_gdesc(char **gdesc);
  * @brief It sets the graphic description of a player
  * @author Miguel Soto
  *
+ * The drawing is copied into the atlas (equal drawings share a tile), so
+ * newgdesc still belongs to the caller.
+ *
  * @param s a pointer to player
+ * @param atlas the atlas of the world
  * @param newgdesc a double char array with the graphical description
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS player_set_gdesc(Player *p, char **newgdesc);
+STATUS player_set_gdesc(Player *p, Atlas *atlas, char **newgdesc);
 
 /**
  * @brief It gets the graphic description from a player
  * @author Miguel Soto
  *
  * @param s a pointer to player
- * @return a double char array with the graphical description, or NULL if there was some error.
+ * @return the rows of the graphical description (in the atlas), or NULL if there was some error.
  */
-char **player_get_gdesc(Player *p);
+const Atlas_row *player_get_gdesc(Player *p);
 
 #endif
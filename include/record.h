@@ -0,0 +1,151 @@
+/**
+ * @brief It defines the recording of the frames of a session
+ *
+ * A record is a binary file with every frame painted. Most frames are kept
+ * as the cells that changed from the frame before; one in RECORD_KEY_EVERY
+ * is a keyframe, kept as the cells that differ from an empty screen, so it
+ * does not depend on any other frame. Both are a list of spans:
+ *
+ *   skip, count (unsigned varints), then count characters
+ *
+ * where skip is the number of cells since the end of the span before. A
+ * record is written with record_create and record_frame, and read with
+ * record_open and record_seek. Seeking to a frame decodes from the last
+ * keyframe before it, or goes on from the frame already decoded if that
+ * one is closer, so it never costs more than RECORD_KEY_EVERY frames.
+ *
+ * The keyframes are listed at the end of the file when it is closed. A
+ * record that was not closed (the game crashed) can still be read: its
+ * frames are scanned, without decoding them, when it is opened.
+ *
+ * @file record.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RECORD_H
+#define RECORD_H
+
+#include "types.h"
+
+#define RECORD_KEY_EVERY 32   /*!< Frames from a keyframe to the next one */
+#define RECORD_BG_CHAR '~'    /*!< Cell of an empty screen */
+
+typedef struct _Record Record; /*!< It defines the record structure */
+
+/**
+ * @brief Creates a record to write frames in
+ * @author Miguel Soto
+ *
+ * @param path file of the record, written over if it exists
+ * @param rows rows of the screen
+ * @param columns columns of the screen
+ * @return a pointer to the new record or NULL if anything went wrong
+ */
+Record *record_create(const char *path, int rows, int columns);
+
+/**
+ * @brief Opens a record to read its frames
+ * @author Miguel Soto
+ *
+ * @param path file of the record
+ * @return a pointer to the record or NULL if it can not be read
+ */
+Record *record_open(const char *path);
+
+/**
+ * @brief Closes a record and frees it
+ * @author Miguel Soto
+ *
+ * A record being written gets its list of keyframes.
+ *
+ * @param record a pointer to the record
+ */
+void record_close(Record *record);
+
+/**
+ * @brief Adds a frame to a record being written
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @param cells the screen (rows * columns characters, row after row)
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS record_frame(Record *record, const char *cells);
+
+/**
+ * @brief Decodes a frame of a record being read
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @param frame the frame, from 0
+ * @return OK if everything goes well, or ERROR if there is no such frame or the file is damaged
+ */
+STATUS record_seek(Record *record, long frame);
+
+/**
+ * @brief Gets the cells of the last frame decoded, or written
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return rows * columns characters, row after row, or NULL on error
+ */
+const char *record_get_cells(Record *record);
+
+/**
+ * @brief Gets the frames of a record
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return the number of frames, or -1 on error
+ */
+long record_get_frames(Record *record);
+
+/**
+ * @brief Gets the frames decoded by the last seek
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return the number of frames, or -1 on error
+ */
+long record_get_decoded(Record *record);
+
+/**
+ * @brief Gets the rows of the screen of a record
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return the rows, or -1 on error
+ */
+int record_get_rows(Record *record);
+
+/**
+ * @brief Gets the columns of the screen of a record
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return the columns, or -1 on error
+ */
+int record_get_columns(Record *record);
+
+/**
+ * @brief Gets the bytes of the frames written
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return the bytes, or -1 on error
+ */
+long record_get_bytes(Record *record);
+
+/**
+ * @brief Gets the time spent writing frames
+ * @author Miguel Soto
+ *
+ * @param record a pointer to the record
+ * @return processor seconds spent in record_frame, or -1 on error
+ */
+double record_get_time(Record *record);
+
+#endif
@@ -0,0 +1,56 @@
+/**
+ * @brief It defines the counters of the in-tree screen backend
+ *
+ * src/screen.c implements libscreen.h with the same cells and the same
+ * output as lib/libscreen.a, so either one can be linked (see SCREEN in
+ * the Makefile). The screen is a single block of rows * columns cells, row
+ * after row, and screen_paint builds the whole repaint in one buffer that
+ * goes out with a single write().
+ *
+ * These counters only exist in the in-tree backend.
+ *
+ * @file screen.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SCREEN_H
+#define SCREEN_H
+
+#include "libscreen.h"
+
+#define SCREEN_BG_CHAR '~' /*!< Background cell, painted blue on blue */
+
+/**
+ * @brief Gets the number of paints
+ * @author Miguel Soto
+ *
+ * @return screen_paint calls that painted something since the last reset
+ */
+long screen_get_paints();
+
+/**
+ * @brief Gets the bytes painted
+ * @author Miguel Soto
+ *
+ * @return bytes written by screen_paint since the last reset
+ */
+long screen_get_bytes();
+
+/**
+ * @brief Gets the time spent painting
+ * @author Miguel Soto
+ *
+ * @return processor seconds spent in screen_paint since the last reset
+ */
+double screen_get_paint_time();
+
+/**
+ * @brief Sets every counter back to 0
+ * @author Miguel Soto
+ */
+void screen_reset_stats();
+
+#endif
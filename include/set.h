@@ -14,9 +14,14 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include "types.h"
+#include "arena.h"
 
 typedef struct _Set Set;  /*!< It defines the set structure, making it easier to manage any kind of data sets */
 
+typedef long Set_handle; /*!< Handle of an id in a set (slot and generation) */
+
+#define SET_NO_HANDLE -1 /*!< Handle that refers to no id */
+
 /**
  * @brief Allocates memory for a new set
  * @author Miguel Soto
@@ -28,6 +33,18 @@ typedef struct _Set Set;  /*!< It defines the set structure, making it easier to
  */
 Set *set_create();
 
+/**
+ * @brief Creates a new set whose memory comes from an arena
+ * @author Miguel Soto
+ *
+ * The set never frees anything: set_destroy does nothing and its memory
+ * is released when the arena is reset or destroyed.
+ *
+ * @param arena a pointer to the arena (NULL works like set_create)
+ * @return a pointer to an initialized set or NULL if anything went wrong
+ */
+Set *set_create_in(Arena *arena);
+
 /**
  * @brief Frees the previously allocated memory for a set
  * @author Miguel Soto
@@ -49,16 +66,63 @@ STATUS set_destroy(Set *s);
  * 
  * @param s a pointer to target set
  * @param id target id to be assigned to a set
- * @return OK if everything goes well, or ERROR if anything doesn't.
+ * @return OK if everything goes well, or ERROR if anything doesn't
+ * (also if the id was already in the set).
  */
 STATUS set_add(Set *s, Id id);
 
+/**
+ * @brief It adds a new id to a set and gets its handle
+ * @author Miguel Soto
+ *
+ * Same as set_add. The handle reaches the id in constant time until it is
+ * deleted; after that the handle is stale and is rejected, even if the
+ * same id is added again.
+ *
+ * @param s a pointer to target set
+ * @param id target id to be assigned to a set
+ * @return the handle of the id, or SET_NO_HANDLE if anything goes wrong
+ */
+Set_handle set_add_handle(Set *s, Id id);
+
+/**
+ * @brief Gets the handle of an id of a set
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return the handle of the id, or SET_NO_HANDLE if it is not in the set
+ */
+Set_handle set_get_handle(Set *s, Id id);
+
+/**
+ * @brief Gets the id that a handle refers to
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param h handle
+ * @return the id, or NO_ID if the handle is stale or not valid
+ */
+Id set_get_id_by_handle(Set *s, Set_handle h);
+
+/**
+ * @brief Removes the id that a handle refers to
+ * @author Miguel Soto
+ *
+ * It takes constant time and keeps the order of the other ids.
+ *
+ * @param s a pointer to target set
+ * @param h handle
+ * @return OK if everything goes well, or ERROR if the handle is stale or not valid.
+ */
+STATUS set_del_handle(Set *s, Set_handle h);
+
 /**
  * @brief Removes a certain id from the set
  * @author Miguel Soto
  * 
  * set_del_id searches for the indicated id on a set
- * and has it removed
+ * and has it removed. The other ids keep their order.
  * 
  * @param s a pointer to target set
  * @param id target id to be removed from a set
@@ -92,6 +156,9 @@ int set_get_nids(Set *s);
  * @brief gets the array containing all ids from a set
  * @author Miguel Soto
  * 
+ * The ids are in the order they were added. The array belongs to the set
+ * and is only valid until the set is modified.
+ * 
  * @param s a pointer to target set
  * @return a pointer to the array containing all ids from a set
  */
@@ -101,6 +168,9 @@ Id *set_get_ids(Set *s);
   * @brief Finds if a id is in a set or not
   * @author Nicolas Victorino
   *
+  * Small sets are scanned. Bigger ones use a bitset (close ids) or a
+  * hash table (sparse ids), so the check takes constant time.
+  *
   * @param set a pointer to the given set
   * @param id the id we want to find
   * @return TRUE if the set contains the id, FALSE in opposite case
@@ -141,4 +211,56 @@ int set_print(Set *s);
  */
 Id set_get_ids_by_number(Set* set, int n);
 
+/**
+ * @brief Stores in dest the ids that are in a or in b
+ * @author Miguel Soto
+ *
+ * dest is overwritten. When both sets keep a bitset the union is computed
+ * a whole word of ids at a time. dest only allocates memory if it has
+ * never held as many ids as the result.
+ *
+ * @param dest a pointer to the set where the result is stored (not a nor b)
+ * @param a a pointer to the first set
+ * @param b a pointer to the second set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_union(Set *dest, Set *a, Set *b);
+
+/**
+ * @brief Stores in dest the ids that are in a and in b
+ * @author Miguel Soto
+ *
+ * Same rules as set_union.
+ *
+ * @param dest a pointer to the set where the result is stored (not a nor b)
+ * @param a a pointer to the first set
+ * @param b a pointer to the second set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_intersect(Set *dest, Set *a, Set *b);
+
+/**
+ * @brief Stores in dest the ids that are in a but not in b
+ * @author Miguel Soto
+ *
+ * Same rules as set_union.
+ *
+ * @param dest a pointer to the set where the result is stored (not a nor b)
+ * @param a a pointer to the first set
+ * @param b a pointer to the second set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_difference(Set *dest, Set *a, Set *b);
+
+/**
+ * @brief Counts the ids of a set that satisfy a condition
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param pred condition, it gets each id and data
+ * @param data extra argument for pred (may be NULL)
+ * @return number of ids for which pred is TRUE, -1 if there was an error
+ */
+int set_count_if(Set *s, BOOL (*pred)(Id id, void *data), void *data);
+
 #endif
@@ -0,0 +1,156 @@
+/**
+ * @brief It defines the snapshot of a game that is painted
+ *
+ * A snapshot is everything the screen shows of a turn, taken from the game
+ * in one pass. Painting only reads the snapshot, so it never asks the game
+ * and any front-end can paint the same snapshot its own way.
+ *
+ * Everything is copied, names and texts included, so a snapshot can be
+ * painted while the game goes on (even from another thread).
+ *
+ * @file snapshot.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "game.h"
+#include "tile_cache.h"
+#include "viewport.h"
+
+#define SNAPSHOT_LIST 32   /*!< Objects of the room a snapshot keeps */
+#define SNAPSHOT_INVENTORY_PAGE 5 /*!< Objects carried shown at the same time */
+#define SNAPSHOT_ENEMIES_PAGE 3   /*!< Enemies of the room shown at the same time */
+#define SNAPSHOT_TEXT 248  /*!< Bytes of each text of a snapshot, the longer ones are cut */
+#define SNAPSHOT_NAME 64   /*!< Bytes of each name of a snapshot (the longest name is an enemy's) */
+#define SNAPSHOT_LINKS 6   /*!< Closed links a snapshot keeps (one for each direction) */
+#define SNAPSHOT_FEEDBACK 3 /*!< Lines of the feedback area */
+#define SNAPSHOT_LINE 96   /*!< Bytes of a line of the feedback area */
+#define SNAPSHOT_MAP_W 7   /*!< Rooms across the minimap */
+#define SNAPSHOT_MAP_H 13  /*!< Rooms down the minimap */
+#define SNAPSHOT_MAP_X (2 * SNAPSHOT_MAP_W - 1) /*!< Columns of the minimap, a link between two rooms */
+#define SNAPSHOT_MAP_Y (2 * SNAPSHOT_MAP_H - 1) /*!< Rows of the minimap, a link between two rooms */
+
+typedef char Snapshot_name[SNAPSHOT_NAME]; /*!< Name of something in a snapshot, ended by '\0' */
+
+/**
+ * @brief Rooms of the map area
+ */
+typedef enum
+{
+  SNAP_HERE,  /*!< Room of the player */
+  SNAP_NORTH, /*!< Room to the north */
+  SNAP_SOUTH, /*!< Room to the south */
+  SNAP_WEST,  /*!< Room to the west */
+  SNAP_EAST,  /*!< Room to the east */
+  SNAP_ROOMS  /*!< Number of rooms */
+} Snapshot_place;
+
+/**
+ * @brief Room of the map area
+ */
+typedef struct
+{
+  Id id;                 /*!< Space of the room, NO_ID if there is no room there */
+  char link;             /*!< Arrow of the link from the room of the player, ' ' if it is closed */
+  Tile_row tile[TILE_Y]; /*!< Tile of the room */
+} Snapshot_room;
+
+/**
+ * @brief Enemy in the room of the player
+ */
+typedef struct
+{
+  Snapshot_name name; /*!< Name of the enemy */
+  int health;         /*!< Health of the enemy */
+} Snapshot_enemy;
+
+/**
+ * @brief First of each list shown in a page
+ *
+ * It is kept by the front-end and moved a page at a time; snapshot_take
+ * takes it back to the first page when it goes past the end of a list.
+ */
+typedef struct
+{
+  int inventory; /*!< First object carried shown */
+  int enemies;   /*!< First enemy of the room shown */
+} Snapshot_scroll;
+
+/**
+ * @brief Closed link of the room of the player
+ */
+typedef struct
+{
+  Snapshot_name name; /*!< Name of the link */
+  DIRECTION dir;      /*!< Direction of the link */
+} Snapshot_link;
+
+/**
+ * @brief Snapshot of a game
+ */
+typedef struct
+{
+  Id location;                            /*!< Room of the player, NO_ID if it has none */
+  Snapshot_room rooms[SNAP_ROOMS];        /*!< Rooms of the map area */
+  BOOL panel;                             /*!< TRUE if the description panel is shown */
+  Snapshot_name objects[SNAPSHOT_LIST];   /*!< Objects that can be seen in the room */
+  int n_objects;                          /*!< Number of objects */
+  Atlas_row player_gdesc[PLAYER_GDESC_Y]; /*!< Graphic description of the player */
+  int player_health;                      /*!< Health of the player */
+  Snapshot_name inventory[SNAPSHOT_INVENTORY_PAGE]; /*!< Objects carried by the player in the page shown */
+  int n_inventory;                        /*!< Number of objects in the page */
+  int inventory_first;                    /*!< Position of the first one in the inventory */
+  int inventory_total;                    /*!< Number of objects carried */
+  Snapshot_enemy enemies[SNAPSHOT_ENEMIES_PAGE]; /*!< Enemies in the room in the page shown */
+  int n_enemies;                          /*!< Number of enemies in the page */
+  int enemies_first;                      /*!< Position of the first one among the enemies of the room */
+  int enemies_total;                      /*!< Number of enemies in the room */
+  char description[SNAPSHOT_TEXT];        /*!< Brief description of the room */
+  BOOL has_inspection;                    /*!< TRUE if something was inspected */
+  char inspection[SNAPSHOT_TEXT];         /*!< What was inspected */
+  Snapshot_link closed[SNAPSHOT_LINKS];   /*!< Closed links of the room */
+  int n_closed;                           /*!< Number of closed links */
+  Time time;                              /*!< Day or night */
+  BOOL game_over;                         /*!< TRUE if the game is over */
+  T_Command last_cmd;                     /*!< Last command */
+  int st;                                 /*!< Status of the last command (0 error, 1 ok, other none) */
+  BOOL has_dialogue;                      /*!< TRUE if the last command has a dialogue */
+  char dialogue[SNAPSHOT_TEXT];           /*!< Dialogue of the last command */
+  BOOL has_events;                        /*!< TRUE if the last command has events */
+  char events[SNAPSHOT_TEXT];             /*!< Events of the last command */
+  char minimap[SNAPSHOT_MAP_Y][SNAPSHOT_MAP_X + 1]; /*!< Rooms around the player, see snapshot_take */
+  char feedback[SNAPSHOT_FEEDBACK][SNAPSHOT_LINE]; /*!< Last commands, the newest last (kept by the front-end, not taken) */
+  int n_feedback;                         /*!< Number of feedback lines */
+} Snapshot;
+
+/**
+ * @brief Takes the snapshot of a game
+ * @author Miguel Soto
+ *
+ * Only the room of the player, its neighbours and what can be seen in it
+ * are looked up. Objects of the room past SNAPSHOT_LIST are cut. Only one
+ * page of the inventory and of the enemies of the room is copied, the one
+ * the scroll asks for: the rest are counted, not copied, so the cost of a
+ * snapshot does not grow with them.
+ *
+ * The minimap is laid out by the viewport, which must be SNAPSHOT_MAP_W by
+ * SNAPSHOT_MAP_H rooms. The player is '@', a room with a visible object
+ * '*', a room hidden by the fog '?' and any other room 'o'; open links are
+ * '-' and '|' and closed ones 'x'.
+ *
+ * @param snap where the snapshot is taken
+ * @param game pointer to the game
+ * @param tiles cache of the tiles of the rooms
+ * @param vp viewport of the minimap, or NULL to leave it blank
+ * @param scroll pages of the lists, taken back to the first one past the end, or NULL for the first ones
+ * @param st status of the last command
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS snapshot_take(Snapshot *snap, Game *game, Tile_cache *tiles, Viewport *vp, Snapshot_scroll *scroll, int st);
+
+#endif
@@ -15,6 +15,8 @@
 #include "types.h"
 #include "object.h"
 #include "link.h"
+#include "strpool.h"
+#include "atlas.h"
 
 typedef struct _Space Space; /*!< The space structure, contains everything related to the game's spaces */
 
@@ -36,6 +38,19 @@ typedef struct _Space Space; /*!< The space structure, contains everything relat
  */
 Space *space_create(Id id);
 
+/**
+ * @brief It creates a new space whose memory comes from an arena
+ * @author Miguel Soto
+ *
+ * Its objects set is also in the arena, so space_destroy does nothing
+ * and everything goes away with the arena.
+ *
+ * @param id the identification number for the new space
+ * @param arena a pointer to the arena (NULL works like space_create)
+ * @return a new space, initialized
+ */
+Space *space_create_in(Id id, Arena *arena);
+
 /**
  * @brief It destroys a space
  * @author Profesores PPROG
@@ -69,18 +84,22 @@ STATUS space_test_id(Id id);
  * @brief It sets the name of a space
  * @author Profesores PPROG
  *
+ * The space keeps the copy of the string pool (see strpool.h), so spaces
+ * with the same text share it.
+ *
  * @param space a pointer to the space
+ * @param pool the pool of the texts of the world
  * @param name a string with the name to store
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS space_set_name(Space *space, char *name);
+STATUS space_set_name(Space *space, Strpool *pool, char *name);
 
 /**
  * @brief It gets the name of a space
  * @author Profesores PPROG
  *
  * @param space a pointer to the space
- * @return  a string with the name of the space
+ * @return  a string with the name of the space (pooled, it must not be modified)
  */
 const char *space_get_name(Space *space);
 
@@ -89,10 +108,11 @@ const char *space_get_name(Space *space);
  * @author Ignacio Nunnez
  *
  * @param space a pointer to the space
+ * @param pool the pool of the texts of the world
  * @param description a string with the description to store
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS space_set_brief_description(Space *space, char *brief_description);
+STATUS space_set_brief_description(Space *space, Strpool *pool, char *brief_description);
 
 /**
  * @brief It gets the brief description of a space
@@ -108,10 +128,26 @@ const char *space_get_brief_description(Space *space);
  * @author Ignacio Nunnez
  *
  * @param space a pointer to the space
+ * @param pool the pool of the texts of the world
  * @param long_description a string with the description to store
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS space_set_long_description(Space *space, char *long_description);
+STATUS space_set_long_description(Space *space, Strpool *pool, char *long_description);
+
+/**
+ * @brief It makes a space point at texts that are never freed nor changed
+ * @author Miguel Soto
+ *
+ * Nothing is copied: the texts must last longer than the space, as the
+ * literals of a map compiled into the program do (see map_data.h).
+ *
+ * @param space a pointer to the space
+ * @param name the name
+ * @param brief_description the brief description
+ * @param long_description the detailed description
+ * @return OK, if everything goes well or ERROR if there was some mistake
+ */
+STATUS space_borrow_texts(Space *space, const char *name, const char *brief_description, const char *long_description);
 
 /**
  * @brief It gets the detailed description of a space
@@ -212,20 +248,24 @@ STATUS space_destroy_gdesc(char **gdesc);
  * @brief It sets the graphic description of a space
  * @author Miguel Soto
  *
+ * The drawing is copied into the atlas (equal drawings share a tile), so
+ * newgdesc still belongs to the caller.
+ *
  * @param s a pointer to space
+ * @param atlas the atlas of the world
  * @param newgdesc a double char array with the graphical description
  * @return OK, if everything goes well or ERROR if there was some mistake
  */
-STATUS space_set_gdesc(Space *s, char **newgdesc);
+STATUS space_set_gdesc(Space *s, Atlas *atlas, char **newgdesc);
 
 /**
  * @brief It gets the graphic description from a space
  * @author Miguel Soto
  *
  * @param s a pointer to space
- * @return a double char array with the graphical description, or NULL if there was some error.
+ * @return the rows of the graphical description (in the atlas), or NULL if there was some error.
  */
-char **space_get_gdesc(Space *s);
+const Atlas_row *space_get_gdesc(Space *s);
 
 /**
  * @brief It prints the space information
@@ -308,4 +348,17 @@ STATUS space_set_fire(Space *s, BOOL fire);
  */
 BOOL space_get_fire(Space *s);
 
+/**
+ * @brief It gets the stamp of the last change of a space
+ * @author Miguel Soto
+ *
+ * Every change of the name, links, objects, graphic description, light or
+ * fire of any space takes a new stamp, so a drawing of a space made with
+ * one stamp is still good while the space keeps it.
+ *
+ * @param s pointer to space
+ * @return the stamp, or 0 on error
+ */
+unsigned long space_get_revision(Space *s);
+
 #endif
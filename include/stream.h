@@ -0,0 +1,98 @@
+/**
+ * @brief It defines the stream of painted frames to spectators
+ *
+ * A stream listens on a Unix domain socket. Each frame painted is sent to
+ * every viewer connected as the ANSI changes from the frame before (the
+ * output of frame_render), so a viewer only needs a terminal and a client
+ * of the socket, for example: nc -U <socket>
+ *
+ * Nothing ever waits for a viewer. Each one has a ring buffer of its own
+ * where the frames are queued and sent as fast as the socket takes them;
+ * a frame that does not fit is dropped for that viewer. Changes are only
+ * right on top of the frame before, so a viewer that joins, or that missed
+ * a frame, gets a keyframe (the whole screen) before the next changes.
+ *
+ * @file stream.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STREAM_H
+#define STREAM_H
+
+#include <stdlib.h>
+#include "types.h"
+
+#define STREAM_VIEWERS 16          /*!< Viewers connected at the same time */
+#define STREAM_RING (256 * 1024)   /*!< Bytes queued for each viewer */
+
+typedef struct _Stream Stream; /*!< It defines the stream structure */
+
+/**
+ * @brief Creates a stream listening on a socket
+ * @author Miguel Soto
+ *
+ * A socket already at the path is removed first; if there is any other
+ * kind of file there, it is left untouched and the stream is not created.
+ *
+ * @param path path of the socket
+ * @param rows rows of the screen
+ * @param columns columns of the screen
+ * @return a pointer to the new stream or NULL if anything went wrong
+ */
+Stream *stream_create(const char *path, int rows, int columns);
+
+/**
+ * @brief Closes every viewer and the socket, and frees the stream
+ * @author Miguel Soto
+ *
+ * @param stream a pointer to the stream
+ */
+void stream_destroy(Stream *stream);
+
+/**
+ * @brief Sends a painted frame to the viewers
+ * @author Miguel Soto
+ *
+ * Viewers waiting to connect are let in first. Then the frame is queued
+ * for each viewer, as a keyframe for the ones that need it, and every
+ * queue is sent as far as its socket takes it without blocking.
+ *
+ * @param stream a pointer to the stream
+ * @param cells the screen painted (rows * columns characters, row after row)
+ * @param changes output that takes the screen before to this one
+ * @param len bytes of the changes
+ * @return number of viewers connected, or -1 on error
+ */
+int stream_publish(Stream *stream, const char *cells, const char *changes, size_t len);
+
+/**
+ * @brief Gets the viewers connected
+ * @author Miguel Soto
+ *
+ * @param stream a pointer to the stream
+ * @return the number of viewers, or -1 on error
+ */
+int stream_get_viewers(Stream *stream);
+
+/**
+ * @brief Gets the frames dropped
+ * @author Miguel Soto
+ *
+ * @param stream a pointer to the stream
+ * @return frames that did not fit in the queue of a viewer, added for every viewer, or -1 on error
+ */
+long stream_get_dropped(Stream *stream);
+
+/**
+ * @brief Gets the keyframes queued
+ * @author Miguel Soto
+ *
+ * @param stream a pointer to the stream
+ * @return keyframes queued for every viewer, or -1 on error
+ */
+long stream_get_keyframes(Stream *stream);
+
+#endif
@@ -0,0 +1,69 @@
+/**
+ * @brief It defines the interned string pool
+ *
+ * Names and descriptions of the entities are stored once in a pool:
+ * interning the same text twice gives back the same pointer, so entities
+ * only keep a pointer and equal texts share their memory. Each game has its
+ * own pool in the arena of its world, so it goes away with that world.
+ *
+ * @file strpool.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STRPOOL_H
+#define STRPOOL_H
+
+#include <stdlib.h>
+#include "types.h"
+#include "arena.h"
+
+typedef struct _Strpool Strpool;
+
+/**
+ * @brief Creates an empty pool
+ * @author Miguel Soto
+ *
+ * The pool, its table and its texts take their memory from the arena, so
+ * there is no destroy: everything goes away with the arena.
+ *
+ * @param arena arena of the pool
+ * @return a new pool, or NULL if there was no memory
+ */
+Strpool *strpool_create(Arena *arena);
+
+/**
+ * @brief Gets the pooled copy of a string
+ * @author Miguel Soto
+ *
+ * The first time a text is interned it is copied into the pool, after that
+ * the same copy is returned. Pooled strings must not be modified and last
+ * as long as the arena of the pool.
+ *
+ * @param pool the pool
+ * @param str string to be interned
+ * @return the pooled string, or NULL if str is NULL or there was no memory
+ */
+const char *strpool_intern(Strpool *pool, const char *str);
+
+/**
+ * @brief Gets the number of different strings in the pool
+ * @author Miguel Soto
+ *
+ * @param pool the pool
+ * @return number of strings
+ */
+int strpool_get_count(Strpool *pool);
+
+/**
+ * @brief Gets the bytes used by the texts of the pool
+ * @author Miguel Soto
+ *
+ * @param pool the pool
+ * @return bytes used
+ */
+size_t strpool_get_bytes(Strpool *pool);
+
+#endif
@@ -0,0 +1,89 @@
+/**
+ * @brief It defines the cache of the drawn room tiles
+ *
+ * The map area draws every room as the same box: its name, its graphic
+ * description (with the enemy in it, if asked) and a mark if there is a
+ * visible object. The box of each space is kept and only drawn again when
+ * the space changes (see space_get_revision) or its enemy does.
+ *
+ * @file tile_cache.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TILE_CACHE_H
+#define TILE_CACHE_H
+
+#include "game.h"
+
+#define TILE_Y 12        /*!< Rows of a room tile, borders included */
+#define TILE_X 19        /*!< Columns of a room tile, borders included */
+#define TILE_ROW_MAX 48  /*!< Bytes of a row (the fog is written with 2-byte characters) */
+#define TILE_PLAYER_ROW 2 /*!< Row where the player is drawn */
+#define TILE_LINK_ROW 7  /*!< Row of the arrows to the rooms at the sides */
+#define TILE_OBJECT_ROW 10 /*!< Row of the mark of a visible object */
+
+typedef char Tile_row[TILE_ROW_MAX]; /*!< Row of a tile, ended by '\0' */
+
+typedef struct _Tile_cache Tile_cache; /*!< It defines the tile cache structure */
+
+/**
+ * @brief Creates an empty tile cache
+ * @author Miguel Soto
+ *
+ * @return a pointer to the new cache or NULL if anything went wrong
+ */
+Tile_cache *tile_cache_create();
+
+/**
+ * @brief Frees a tile cache and all its tiles
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ */
+void tile_cache_destroy(Tile_cache *cache);
+
+/**
+ * @brief Gets the tile of a space, drawing it only if it is out of date
+ * @author Miguel Soto
+ *
+ * The rows are valid until the next call for the same space.
+ *
+ * @param cache a pointer to the cache
+ * @param game pointer to the game
+ * @param space id of the space
+ * @param occupant TRUE to draw the enemy of the space
+ * @param fog TRUE to hide the space behind the fog
+ * @return the TILE_Y rows of the tile, or NULL if the space does not exist
+ */
+const Tile_row *tile_cache_get(Tile_cache *cache, Game *game, Id space, BOOL occupant, BOOL fog);
+
+/**
+ * @brief Forgets every tile
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ */
+void tile_cache_clear(Tile_cache *cache);
+
+/**
+ * @brief Gets the number of tiles drawn since the cache was created
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ * @return tiles drawn (not taken from the cache), or -1 on error
+ */
+long tile_cache_get_draws(Tile_cache *cache);
+
+/**
+ * @brief Gets the number of tiles taken from the cache
+ * @author Miguel Soto
+ *
+ * @param cache a pointer to the cache
+ * @return tiles taken as they were, or -1 on error
+ */
+long tile_cache_get_hits(Tile_cache *cache);
+
+#endif
@@ -13,6 +13,7 @@
 
 #define WORD_SIZE 1000    /*!< Establish the length for some strings */
 #define NO_ID -1          /*!< Establish a non-defined id and its value is -1*/
+#define MAX_OBJ_TYPES 16  /*!< Establish the maximun number of object types of the registry */
 #define MAX_ARG 20        /*!< Establish a length of command input arguments */
 #define NUM_ARG 2         /*!< Establish the number or arguments in an input command */
 
@@ -20,6 +21,7 @@
 #define FD_ID_PLAYER 2 /*!< First digit of a player. */
 #define FD_ID_OBJ 3    /*!< First digit of an object. */
 #define FD_ID_ENEMY 4  /*!< First digit of an enemy. */
+#define FD_ID_LINK 5   /*!< First digit of a link. */
 
 /**
  * @brief Ids
@@ -79,6 +81,9 @@ typedef enum
 
 /**
  * @brief Type of an object
+ *
+ * Types are numbers of the registry loaded from the map (#t: lines), the
+ * map has to give these numbers to the types the code refers to.
  */
 typedef enum
 {
@@ -88,7 +93,8 @@ typedef enum
   ARMOR,              /*!< Armor object type*/
   HOOK,               /*!< Hook object type*/
   BED,                /*!< Bed object type*/
-  BREAD_CRUMBS        /*!< Bread_crumbs object type*/
+  BREAD_CRUMBS,       /*!< Bread_crumbs object type*/
+  SWORD               /*!< Sword object type*/
 } Obj_type;
 
 /**
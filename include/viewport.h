@@ -0,0 +1,116 @@
+/**
+ * @brief It defines the viewport over the rooms of a floor
+ *
+ * A viewport is a grid of rooms centred on one of them. The rooms are laid
+ * out by walking the north, south, east and west links from the centre
+ * (breadth first), each one a cell away from the room it was reached from.
+ * The walk stops at a given number of links from the centre (the radius) or
+ * at the border of the grid, whichever comes first, so its cost is bounded
+ * by the size of the grid and not by the size of the map.
+ *
+ * @file viewport.h
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef VIEWPORT_H
+#define VIEWPORT_H
+
+#include "game.h"
+
+#define VIEWPORT_FLOOR -1 /*!< Radius of a viewport that shows the whole floor it fits */
+
+/**
+ * @brief Link between two cells of a viewport
+ */
+typedef enum
+{
+  VIEWPORT_NONE,   /*!< No link between both rooms */
+  VIEWPORT_OPEN,   /*!< Open link */
+  VIEWPORT_CLOSED  /*!< Closed link */
+} Viewport_link;
+
+typedef struct _Viewport Viewport; /*!< It defines the viewport structure */
+
+/**
+ * @brief Creates an empty viewport
+ * @author Miguel Soto
+ *
+ * The centre of the grid is the cell (width / 2, height / 2).
+ *
+ * @param width rooms across the grid
+ * @param height rooms down the grid
+ * @param radius links walked from the centre, or VIEWPORT_FLOOR to fill the grid
+ * @return a pointer to the new viewport or NULL if anything went wrong
+ */
+Viewport *viewport_create(int width, int height, int radius);
+
+/**
+ * @brief Frees a viewport
+ * @author Miguel Soto
+ *
+ * @param vp a pointer to the viewport
+ */
+void viewport_destroy(Viewport *vp);
+
+/**
+ * @brief Lays out the rooms around a space
+ * @author Miguel Soto
+ *
+ * A room reached by two ways is placed by the first one; a room whose cell
+ * is already taken by another one is left out of that way.
+ *
+ * @param vp a pointer to the viewport
+ * @param game pointer to the game
+ * @param center space at the centre of the grid
+ * @return number of rooms placed (0 if the space does not exist), or -1 on error
+ */
+int viewport_layout(Viewport *vp, Game *game, Id center);
+
+/**
+ * @brief Gets the room of a cell
+ * @author Miguel Soto
+ *
+ * @param vp a pointer to the viewport
+ * @param x column of the cell, from 0
+ * @param y row of the cell, from 0
+ * @return id of the space in the cell, or NO_ID if it is empty or out of the grid
+ */
+Id viewport_get_room(Viewport *vp, int x, int y);
+
+/**
+ * @brief Gets the link from a cell to the next one
+ * @author Miguel Soto
+ *
+ * Each room has its own link to the other one; if either is closed, so is
+ * the link between the cells.
+ *
+ * @param vp a pointer to the viewport
+ * @param x column of the cell, from 0
+ * @param y row of the cell, from 0
+ * @param dir N, S, E or W
+ * @return the link between both cells, VIEWPORT_NONE if there is none
+ */
+Viewport_link viewport_get_link(Viewport *vp, int x, int y, DIRECTION dir);
+
+/**
+ * @brief Gets the rooms across the grid
+ * @author Miguel Soto
+ *
+ * @param vp a pointer to the viewport
+ * @return the width, or -1 on error
+ */
+int viewport_get_width(Viewport *vp);
+
+/**
+ * @brief Gets the rooms down the grid
+ * @author Miguel Soto
+ *
+ * @param vp a pointer to the viewport
+ * @return the height, or -1 on error
+ */
+int viewport_get_height(Viewport *vp);
+
+#endif
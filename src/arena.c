@@ -0,0 +1,278 @@
+/**
+ * @brief It implements the arena (region) allocator
+ *
+ * @file arena.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include "../include/arena.h"
+
+/**
+ * @brief Type with the strictest alignment the arena has to respect
+ */
+typedef union
+{
+  long l;        /*!< Integers */
+  double d;      /*!< Floating point */
+  void *p;       /*!< Pointers */
+} Arena_align;
+
+#define ARENA_ALIGN sizeof(Arena_align) /*!< Alignment of every allocation */
+#define ARENA_ROUND(n) (((n) + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN) /*!< Rounds n up to the alignment */
+
+/**
+ * @brief Block of an arena
+ *
+ * The memory handed out follows the header in the same malloc.
+ */
+typedef struct _Arena_block
+{
+  struct _Arena_block *next; /*!< Next block of the chain */
+  size_t size;               /*!< Bytes of memory of the block */
+  size_t used;               /*!< Bytes already handed out */
+} Arena_block;
+
+#define ARENA_HEADER ARENA_ROUND(sizeof(Arena_block)) /*!< Bytes before the memory of a block */
+
+/**
+ * @brief Arena
+ *
+ * Blocks are chained and filled in order. Resetting goes back to the first
+ * block; the rest are reused as the arena fills again.
+ */
+struct _Arena
+{
+  Arena_block *first;   /*!< First block (NULL until something is allocated) */
+  Arena_block *current; /*!< Block being filled */
+  size_t block_size;    /*!< Size of new blocks */
+  size_t used;          /*!< Bytes handed out since the last reset */
+  size_t high_water;    /*!< Highest value of used */
+  size_t reserved;      /*!< Bytes of all the blocks */
+};
+
+/**
+ * Private functions
+ */
+Arena_block *arena_new_block(Arena *arena, size_t size);
+
+/**
+ * arena_create creates an empty arena
+ */
+Arena *arena_create(size_t block_size)
+{
+  Arena *arena = NULL;
+
+  arena = (Arena *)malloc(sizeof(Arena));
+  /* Error control */
+  if (!arena)
+  {
+    return NULL;
+  }
+
+  arena->first = NULL;
+  arena->current = NULL;
+  arena->block_size = block_size ? ARENA_ROUND(block_size) : ARENA_BLOCK_SIZE;
+  arena->used = 0;
+  arena->high_water = 0;
+  arena->reserved = 0;
+
+  return arena;
+}
+
+/**
+ * arena_destroy frees an arena and all its blocks
+ */
+STATUS arena_destroy(Arena *arena)
+{
+  Arena_block *block = NULL, *next = NULL;
+
+  /* Error control */
+  if (!arena)
+  {
+    return ERROR;
+  }
+
+  for (block = arena->first; block; block = next)
+  {
+    next = block->next;
+    free(block);
+  }
+
+  free(arena);
+  arena = NULL;
+
+  return OK;
+}
+
+/**
+ * @brief Allocates a new block and puts it after the current one
+ * @author Miguel Soto
+ *
+ * @param arena a pointer to the arena
+ * @param size minimun bytes of memory of the block
+ * @return the new block or NULL if there was no memory
+ */
+Arena_block *arena_new_block(Arena *arena, size_t size)
+{
+  Arena_block *block = NULL;
+
+  if (size < arena->block_size)
+  {
+    size = arena->block_size;
+  }
+
+  block = (Arena_block *)malloc(ARENA_HEADER + size);
+  if (!block)
+  {
+    return NULL;
+  }
+  block->size = size;
+  block->used = 0;
+
+  if (arena->current)
+  {
+    block->next = arena->current->next;
+    arena->current->next = block;
+  }
+  else
+  {
+    block->next = arena->first;
+    arena->first = block;
+  }
+  arena->reserved += size;
+
+  return block;
+}
+
+/**
+ * arena_alloc hands out memory from the current block
+ */
+void *arena_alloc(Arena *arena, size_t size)
+{
+  Arena_block *block = NULL;
+  void *mem = NULL;
+
+  /* Error control */
+  if (!arena || size == 0)
+  {
+    return NULL;
+  }
+
+  size = ARENA_ROUND(size);
+
+  if (!arena->current)
+  {
+    /* First allocation since the arena was created or reset */
+    arena->current = arena->first;
+    if (arena->current)
+    {
+      arena->current->used = 0;
+    }
+  }
+
+  /* Blocks kept from before a reset are used again */
+  while (arena->current && arena->current->size - arena->current->used < size && arena->current->next)
+  {
+    arena->current = arena->current->next;
+    arena->current->used = 0;
+  }
+
+  block = arena->current;
+  if (!block || block->size - block->used < size)
+  {
+    block = arena_new_block(arena, size);
+    if (!block)
+    {
+      return NULL;
+    }
+    arena->current = block;
+  }
+
+  mem = (char *)block + ARENA_HEADER + block->used;
+  block->used += size;
+  arena->used += size;
+  if (arena->used > arena->high_water)
+  {
+    arena->high_water = arena->used;
+  }
+
+  return mem;
+}
+
+/**
+ * arena_reset releases everything allocated from an arena
+ */
+STATUS arena_reset(Arena *arena)
+{
+  /* Error control */
+  if (!arena)
+  {
+    return ERROR;
+  }
+
+  /* The first block is rewound on the next allocation */
+  arena->current = NULL;
+  arena->used = 0;
+
+  return OK;
+}
+
+/**
+ * It gets the bytes in use of an arena
+ */
+size_t arena_get_used(Arena *arena)
+{
+  /* Error control */
+  if (!arena)
+  {
+    return 0;
+  }
+
+  return arena->used;
+}
+
+/**
+ * It gets the high-water mark of an arena
+ */
+size_t arena_get_high_water(Arena *arena)
+{
+  /* Error control */
+  if (!arena)
+  {
+    return 0;
+  }
+
+  return arena->high_water;
+}
+
+/**
+ * It gets the bytes reserved by an arena
+ */
+size_t arena_get_reserved(Arena *arena)
+{
+  /* Error control */
+  if (!arena)
+  {
+    return 0;
+  }
+
+  return arena->reserved;
+}
+
+/**
+ * It prints the usage of an arena
+ */
+int arena_print(FILE *file, Arena *arena)
+{
+  /* Error control */
+  if (!file || !arena)
+  {
+    return 0;
+  }
+
+  return fprintf(file, "arena: %lu bytes in use, high water %lu bytes, %lu bytes reserved\n",
+                 (unsigned long)arena->used, (unsigned long)arena->high_water, (unsigned long)arena->reserved);
+}
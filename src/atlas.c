@@ -0,0 +1,226 @@
+/**
+ * @brief It implements the glyph atlas of the graphic descriptions
+ *
+ * @file atlas.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/atlas.h"
+
+#define ATLAS_BLOCK_TILES 32 /*!< Tiles of each block taken from the arena */
+#define ATLAS_TABLE_MIN 64   /*!< Minimun entries of the hash table */
+
+/**
+ * @brief Tile of the atlas
+ */
+typedef struct
+{
+  Atlas_row rows[ATLAS_TILE_Y]; /*!< Rows of the drawing */
+} Atlas_tile;
+
+/**
+ * @brief Atlas
+ *
+ * The tiles are packed in blocks of ATLAS_BLOCK_TILES taken from the arena,
+ * a tile is never moved. An open-addressed hash table, kept at most half
+ * full, finds the tile of a drawing by its content.
+ */
+struct _Atlas
+{
+  Arena *arena;              /*!< Memory of the atlas */
+  Atlas_tile *block;         /*!< Block where the next tiles go */
+  int n_free;                /*!< Tiles left in block */
+  int n_tiles;               /*!< Number of tiles */
+  const Atlas_tile **table;  /*!< Hash table, a tile or NULL */
+  int n_table;               /*!< Entries of the hash table (power of 2) */
+};
+
+/**
+ * Private functions
+ */
+unsigned long atlas_hash(const Atlas_tile *tile);
+int atlas_probe(const Atlas_tile **table, int n_table, const Atlas_tile *tile, unsigned long hash);
+STATUS atlas_grow(Atlas *atlas);
+
+/**
+ * atlas_create creates an empty atlas in an arena
+ */
+Atlas *atlas_create(Arena *arena)
+{
+  Atlas *atlas = NULL;
+
+  /* Error control */
+  if (!arena)
+  {
+    return NULL;
+  }
+
+  atlas = (Atlas *)arena_alloc(arena, sizeof(Atlas));
+  if (!atlas)
+  {
+    return NULL;
+  }
+
+  atlas->arena = arena;
+  atlas->block = NULL;
+  atlas->n_free = 0;
+  atlas->n_tiles = 0;
+  atlas->table = NULL;
+  atlas->n_table = 0;
+
+  return atlas;
+}
+
+/**
+ * @brief Hashes the content of a tile (FNV-1a)
+ * @author Miguel Soto
+ *
+ * @param tile a pointer to the tile
+ * @return the hash
+ */
+unsigned long atlas_hash(const Atlas_tile *tile)
+{
+  const unsigned char *byte = (const unsigned char *)tile;
+  unsigned long hash = 2166136261UL;
+  size_t i;
+
+  for (i = 0; i < sizeof(Atlas_tile); i++)
+  {
+    hash = (hash ^ byte[i]) * 16777619UL;
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Gets the hash entry of a drawing
+ * @author Miguel Soto
+ *
+ * @param table hash table
+ * @param n_table entries of the table
+ * @param tile a pointer to the drawing
+ * @param hash hash of the drawing
+ * @return the entry that holds the drawing, or the empty entry where it would go
+ */
+int atlas_probe(const Atlas_tile **table, int n_table, const Atlas_tile *tile, unsigned long hash)
+{
+  int entry = (int)(hash & (unsigned long)(n_table - 1));
+
+  while (table[entry] && memcmp(table[entry], tile, sizeof(Atlas_tile)) != 0)
+  {
+    entry = (entry + 1) & (n_table - 1);
+  }
+
+  return entry;
+}
+
+/**
+ * @brief Doubles the hash table (or creates it)
+ * @author Miguel Soto
+ *
+ * The old table stays in the arena, like everything else of the atlas.
+ *
+ * @param atlas the atlas
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS atlas_grow(Atlas *atlas)
+{
+  const Atlas_tile **table = NULL;
+  int n_table = atlas->n_table ? 2 * atlas->n_table : ATLAS_TABLE_MIN;
+  int i;
+
+  table = (const Atlas_tile **)arena_alloc(atlas->arena, n_table * sizeof(const Atlas_tile *));
+  if (!table)
+  {
+    return ERROR;
+  }
+  memset(table, 0, n_table * sizeof(const Atlas_tile *));
+
+  for (i = 0; i < atlas->n_table; i++)
+  {
+    if (atlas->table[i])
+    {
+      table[atlas_probe(table, n_table, atlas->table[i], atlas_hash(atlas->table[i]))] = atlas->table[i];
+    }
+  }
+
+  atlas->table = table;
+  atlas->n_table = n_table;
+
+  return OK;
+}
+
+/**
+ * atlas_add adds a drawing to the atlas
+ */
+const Atlas_row *atlas_add(Atlas *atlas, const char **rows, int n_rows, int row_len)
+{
+  Atlas_tile tile;
+  unsigned long hash;
+  int i, entry;
+
+  /* Error control */
+  if (!atlas || !rows || n_rows < 0 || n_rows > ATLAS_TILE_Y || row_len < 0 || row_len >= ATLAS_TILE_X)
+  {
+    return NULL;
+  }
+
+  /* Unused bytes are '\0', so equal drawings are equal tiles */
+  memset(&tile, 0, sizeof(Atlas_tile));
+  for (i = 0; i < n_rows; i++)
+  {
+    if (rows[i])
+    {
+      strncpy(tile.rows[i], rows[i], row_len);
+    }
+  }
+
+  if (2 * (atlas->n_tiles + 1) > atlas->n_table && atlas_grow(atlas) == ERROR)
+  {
+    return NULL;
+  }
+
+  hash = atlas_hash(&tile);
+  entry = atlas_probe(atlas->table, atlas->n_table, &tile, hash);
+  if (atlas->table[entry])
+  {
+    return (const Atlas_row *)atlas->table[entry]->rows;
+  }
+
+  /* New drawing, it goes after the last tile of the block */
+  if (atlas->n_free == 0)
+  {
+    atlas->block = (Atlas_tile *)arena_alloc(atlas->arena, ATLAS_BLOCK_TILES * sizeof(Atlas_tile));
+    if (!atlas->block)
+    {
+      return NULL;
+    }
+    atlas->n_free = ATLAS_BLOCK_TILES;
+  }
+  *atlas->block = tile;
+  atlas->table[entry] = atlas->block;
+  atlas->block++;
+  atlas->n_free--;
+  atlas->n_tiles++;
+
+  return (const Atlas_row *)atlas->table[entry]->rows;
+}
+
+/**
+ * It gets the number of tiles of the atlas
+ */
+int atlas_get_count(Atlas *atlas)
+{
+  /* Error control */
+  if (!atlas)
+  {
+    return -1;
+  }
+
+  return atlas->n_tiles;
+}
@@ -15,6 +15,7 @@
 #include <string.h>
 #include <strings.h>
 #include <stdlib.h>
+#include <ctype.h>
 #include "../include/command.h"
 
 #define CMD_LENGHT 30 /*!< It defines the maximun lenght from an input command */
@@ -36,13 +37,15 @@ char *cmd_to_str[N_CMD]
       {"ton", "Turnon"},           /*!< If a "ton" or "Turnon" is received, it is interpreted as Turnon */
       {"toff", "Turnoff"},         /*!< If a "toff" or "Turnoff" is received, it is interpreted as Turnoff */
       {"o", "Open"},               /*!< If an "o" or "Open" is received, it is interpreted as Open */
-      {"u", "Use"}                 /*!< If an "u" or "Use" is received, it is interpreted as Use */
+      {"u", "Use"},                /*!< If an "u" or "Use" is received, it is interpreted as Use */
+      {"sc", "Scroll"}             /*!< If a "sc" or "Scroll" is received, it is interpreted as Scroll */
       };
 
 /**
  * Funciones privadas
  */
 void print_syntax_command(T_Command cmd);
+int command_read_word(const char *src, char *dest, int size);
 
 /**It scans the cmd searching for key words introduced by the user 
   *in order to interpret and clasify the info
@@ -59,7 +62,13 @@ T_Command command_get_user_input(char *arg1, char *arg2)
     return NO_CMD;
   }
   
-  if (scanf("%s", input) > 0)
+  /* Nothing more will be typed, it is as if the user left the game */
+  if (scanf("%s", input) == EOF)
+  {
+    return EXIT;
+  }
+
+  if (input[0] != '\0')
   {
     cmd = UNKNOWN;
     while (cmd == UNKNOWN && i < N_CMD)     /*!< Condition to continue reading */
@@ -67,7 +76,7 @@ T_Command command_get_user_input(char *arg1, char *arg2)
       if (!strcasecmp(input, cmd_to_str[i][CMDS]) || !strcasecmp(input, cmd_to_str[i][CMDL]))
       {
         cmd = i + NO_CMD;                   /*!< If any differences are detected between CMDS, CMDL and the input, cmd is modified */
-        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == LOAD || cmd == TURNON || cmd == TURNOFF || cmd == USE)
+        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == LOAD || cmd == TURNON || cmd == TURNOFF || cmd == USE || cmd == SCROLL)
         {
           if (scanf("%s", arg1) < 0)
           {
@@ -103,7 +112,7 @@ T_Command command_get_file_input(char *command, char *arg)
 {
   T_Command cmd = NO_CMD; 
   char input[CMD_LENGHT] = "";
-  int i = UNKNOWN - NO_CMD + 1, j = 0, z = 0;
+  int i = UNKNOWN - NO_CMD + 1, j = 0;
   
   /* Error control*/
   if (!arg)
@@ -114,21 +123,19 @@ T_Command command_get_file_input(char *command, char *arg)
   if (command != NULL)
   {
     cmd = UNKNOWN;
-    for (j = 0; command[j] != ' '; j++) { /*Reads first part of command*/
-      input[j] = command[j];
-    }
-    input[j] = '\0';
+    j = command_read_word(command, input, CMD_LENGHT); /*Reads first part of command*/
     while (cmd == UNKNOWN && i < N_CMD)     /*!< Condition to continue reading */
     {
       if (!strcasecmp(input, cmd_to_str[i][CMDS]) || !strcasecmp(input, cmd_to_str[i][CMDL]))
       {
         cmd = i + NO_CMD;                   /*!< If any differences are detected between CMDS, CMDL and the input, cmd is modified */
-        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT)
+        if (cmd == TAKE || cmd == DROP || cmd == MOVE || cmd == INSPECT || cmd == SCROLL)
         {
-          for (j++, z = 0; command[j] != ' '; j++, z++) { /*Reads the second argument of command and saves it in arg*/ 
-            arg[z] = command[j];
-          } 
-          arg[z] = '\0';
+          arg[0] = '\0';
+          if (command[j] == ' ')
+          {
+            command_read_word(command + j + 1, arg, MAX_ARG); /*Reads the second argument of command and saves it in arg*/
+          }
           if (arg == NULL)
           {
             fprintf(stdout, "Comando incorrecto. Los comandos TAKE DROP INSPECT MOVE USE OPEN necesitan un argumento mas como el nombre del objeto .\n");
@@ -159,6 +166,35 @@ T_Command command_get_file_input(char *command, char *arg)
   return cmd;
 }
 
+/**
+ * @brief Copies a word of a command line
+ * @author Miguel Soto
+ *
+ * The word ends at a space, the end of the line or the end of the string;
+ * the characters that do not fit in dest are skipped.
+ *
+ * @param src where the word starts
+ * @param dest where the word is copied, ended by '\0'
+ * @param size bytes of dest
+ * @return characters of src read
+ */
+int command_read_word(const char *src, char *dest, int size)
+{
+  int n = 0;
+
+  while (src[n] != '\0' && !isspace((unsigned char)src[n]))
+  {
+    if (n < size - 1)
+    {
+      dest[n] = src[n];
+    }
+    n++;
+  }
+  dest[n < size - 1 ? n : size - 1] = '\0';
+
+  return n;
+}
+
 /**
  * @brief Print syntax information of a given command
  * @author Miguel Soto
@@ -206,6 +242,10 @@ void print_syntax_command(T_Command cmd)
     fprintf(stdout, "ERROR: Incorrect command syntax. Command open needs 2 arguments: one with the link name you want to open and one with the object name with which player opens link.\n");
     fprintf(stdout, "Command OPEN syntax: o <link_name> with <obj> or open <link_name> with <obj>\n");
     break;
+  case SCROLL:
+    fprintf(stdout, "ERROR: Incorrect command syntax. Command scroll needs an argument with the list of the panel you want to see the next page of.\n");
+    fprintf(stdout, "Command SCROLL syntax: sc <list> or scroll <list>, <list> can be i (inventory) or e (enemies)\n");
+    break;
   default:
     break;
   }
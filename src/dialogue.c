@@ -332,3 +332,30 @@ STATUS dialogue_set_error(Dialogue *dialogue, E_Enum condition, Space *current_l
 
     return OK;
 }
+
+/** Writes the dialogue of the last command and its events
+*/
+STATUS dialogue_print(Dialogue *dialogue, FILE *file)
+{
+    char *text = NULL;
+
+    /*Error control*/
+    if(dialogue == NULL || file == NULL){
+        return ERROR;
+    }
+
+    text = dialogue->error;
+    if(text && strcmp(text, " ") == 0){
+        text = dialogue->command;
+    }
+    if(text && text[0] != '\0' && strcmp(text, " ") != 0){
+        fprintf(file, "%s\n", text);
+    }
+
+    text = dialogue->event;
+    if(text && text[0] != '\0' && strcmp(text, " ") != 0){
+        fprintf(file, "%s\n", text);
+    }
+
+    return OK;
+}
@@ -28,12 +28,20 @@ struct _Enemy
   int health;   /*!< Enemy's health */
   int Crit_dmg;               /*!< Enemy's crit chance (scale 0 to 10) */
   int base_dmg;               /*!< Enemy's base damage */
-  char **gdesc;   /*!< Graphic visualization enemy */
+  const Atlas_row *gdesc; /*!< Tile of the graphic visualization in the atlas (NULL if none) */
+  Arena *arena;   /*!< Arena where the enemy lives (NULL for the heap) */
 } ;
 
 /**enemy_create allocates memory for a new enemy and initializes all its members .
  */
 Enemy *enemy_create(Id id)
+{
+  return enemy_create_in(id, NULL);
+}
+
+/**enemy_create_in creates an enemy whose memory comes from an arena.
+ */
+Enemy *enemy_create_in(Id id, Arena *arena)
 {
   Enemy *new_enemy = NULL;
 
@@ -43,7 +51,7 @@ Enemy *enemy_create(Id id)
       return NULL;
   }
 
-  new_enemy = (Enemy *) malloc(sizeof(Enemy));
+  new_enemy = arena ? (Enemy *) arena_alloc(arena, sizeof(Enemy)) : (Enemy *) malloc(sizeof(Enemy));
 	/* Error control */
   if (new_enemy == NULL)
   {
@@ -56,6 +64,7 @@ Enemy *enemy_create(Id id)
   new_enemy->name[0] = '\0';
   new_enemy->location = NO_ID;
   new_enemy->gdesc = NULL;
+  new_enemy->arena = arena;
 
   return new_enemy;
 }
@@ -69,10 +78,11 @@ STATUS enemy_destroy(Enemy *enemy)
   {
     return ERROR;
   }
-  
-  if (enemy->gdesc)
+
+  /* It goes away with its arena */
+  if (enemy->arena)
   {
-    enemy_destroy_gdesc(enemy->gdesc);
+    return OK;
   }
 
   free(enemy);
@@ -242,6 +252,7 @@ STATUS enemy_print_save(char *filename, Enemy *enemy)
 {
   int i, j;
   FILE *file = NULL;
+  const Atlas_row *gdesc = NULL;
 
   file = fopen(filename, "a");
 
@@ -253,11 +264,12 @@ STATUS enemy_print_save(char *filename, Enemy *enemy)
 
   fprintf(file, "#e:%ld|%s|%ld|%d|%d|%d|", enemy->id, enemy->name, enemy->location, enemy->health, enemy->Crit_dmg, enemy->base_dmg);
 
-  for (i = 0; i < ENEMY_GDESC_Y && enemy->gdesc[i]; i++)
+  gdesc = enemy->gdesc;
+  for (i = 0; i < ENEMY_GDESC_Y && gdesc; i++)
   {
-    for (j = 0; j < ENEMY_GDESC_X && enemy->gdesc[i][j]; j++)
+    for (j = 0; j < ENEMY_GDESC_X && gdesc[i][j]; j++)
     {
-      fprintf(file, "%c", enemy->gdesc[i][j]);
+      fprintf(file, "%c", gdesc[i][j]);
     }
     fprintf(file, "|");
   }
@@ -301,6 +313,28 @@ STATUS enemy_set_baseDmg(Enemy *enemy, int base_dmg){
  return OK;
 } 
 
+/**
+ * enemy_copy turns an enemy into a copy of another one
+ */
+STATUS enemy_copy(Enemy *dest, Enemy *src, Id id)
+{
+  Arena *arena = NULL;
+
+  /* Error control */
+  if (!dest || !src || id == NO_ID)
+  {
+    return ERROR;
+  }
+
+  /* The copy stays in its own memory */
+  arena = dest->arena;
+  *dest = *src;
+  dest->id = id;
+  dest->arena = arena;
+
+  return OK;
+}
+
 char **enemy_create_gdesc()
 {
   char **newgdesc = NULL;
@@ -360,20 +394,25 @@ STATUS enemy_destroy_gdesc(char **gdesc)
 /**
  * It gets the graphic description from a enemy.
  */
-STATUS enemy_set_gdesc(Enemy *e, char **newgdesc)
+STATUS enemy_set_gdesc(Enemy *e, Atlas *atlas, char **newgdesc)
 {
   /* Error control*/
-  if (!e || !newgdesc)
+  if (!e || !atlas || !newgdesc)
   {
     return ERROR;
   }
 
-  e->gdesc = newgdesc;
+  /* The rows are copied, newgdesc still belongs to the caller */
+  e->gdesc = atlas_add(atlas, (const char **)newgdesc, ENEMY_GDESC_Y, ENEMY_GDESC_X);
+  if (!e->gdesc)
+  {
+    return ERROR;
+  }
 
   return OK;
 }
 
-char **enemy_get_gdesc(Enemy *e)
+const Atlas_row *enemy_get_gdesc(Enemy *e)
 {
   /* Error control*/
   if (!e)
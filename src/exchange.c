@@ -0,0 +1,125 @@
+/**
+ * @brief It implements the single-slot exchange between two threads
+ *
+ * @file exchange.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include "../include/exchange.h"
+
+#define EXCHANGE_SLOT 2  /*!< Buffer in the slot when the exchange is created */
+#define EXCHANGE_FRESH 4 /*!< Flag of the slot when its buffer was not taken yet */
+
+/**
+ * @brief Exchange
+ *
+ * The slot keeps the index of its buffer and the EXCHANGE_FRESH flag. The
+ * counters are only written by the writer.
+ */
+struct _Exchange
+{
+  int slot;       /*!< Buffer in the slot, with EXCHANGE_FRESH if it is new */
+  long published; /*!< Buffers published */
+  long dropped;   /*!< Buffers published over one that was never taken */
+};
+
+/**
+ * exchange_create allocates an exchange
+ */
+Exchange *exchange_create()
+{
+  Exchange *ex = NULL;
+
+  ex = (Exchange *)malloc(sizeof(Exchange));
+  if (!ex)
+  {
+    return NULL;
+  }
+
+  ex->slot = EXCHANGE_SLOT;
+  ex->published = 0;
+  ex->dropped = 0;
+
+  return ex;
+}
+
+/**
+ * exchange_destroy frees an exchange
+ */
+void exchange_destroy(Exchange *ex)
+{
+  free(ex);
+}
+
+/**
+ * exchange_publish puts the buffer of the writer in the slot
+ */
+int exchange_publish(Exchange *ex, int back)
+{
+  int old;
+
+  /* Error control */
+  if (!ex || back < 0 || back >= EXCHANGE_BUFFERS)
+  {
+    return -1;
+  }
+
+  old = __atomic_exchange_n(&ex->slot, back | EXCHANGE_FRESH, __ATOMIC_ACQ_REL);
+  if (old & EXCHANGE_FRESH)
+  {
+    ex->dropped++;
+  }
+  ex->published++;
+
+  return old & ~EXCHANGE_FRESH;
+}
+
+/**
+ * exchange_take takes the slot if its buffer is new
+ */
+int exchange_take(Exchange *ex, int front)
+{
+  /* Error control */
+  if (!ex || front < 0 || front >= EXCHANGE_BUFFERS)
+  {
+    return -1;
+  }
+
+  /* Only the reader clears the flag, so it cannot be lost in between */
+  if (!(__atomic_load_n(&ex->slot, __ATOMIC_ACQUIRE) & EXCHANGE_FRESH))
+  {
+    return -1;
+  }
+
+  return __atomic_exchange_n(&ex->slot, front, __ATOMIC_ACQ_REL) & ~EXCHANGE_FRESH;
+}
+
+/**
+ * It gets the number of buffers published
+ */
+long exchange_get_published(Exchange *ex)
+{
+  if (!ex)
+  {
+    return -1;
+  }
+
+  return ex->published;
+}
+
+/**
+ * It gets the number of buffers dropped
+ */
+long exchange_get_dropped(Exchange *ex)
+{
+  if (!ex)
+  {
+    return -1;
+  }
+
+  return ex->dropped;
+}
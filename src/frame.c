@@ -0,0 +1,288 @@
+/**
+ * @brief It implements the double-buffered frame of the terminal
+ *
+ * @file frame.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "../include/frame.h"
+
+#define FRAME_SGR_BG "\033[0;34;44m" /*!< Colour of the background cells */
+#define FRAME_SGR_FG "\033[0;30;47m" /*!< Colour of the rest of the cells */
+#define FRAME_CELL_MAX 24            /*!< Bytes a lone changed cell may need (move, colour and character) */
+#define FRAME_MOVE_MAX 32            /*!< Bytes of a cursor move or a clear */
+
+/**
+ * @brief Frame
+ *
+ * The output buffer fits a full repaint, so rendering never allocates.
+ */
+struct _Frame
+{
+  int rows;      /*!< Rows of the screen */
+  int columns;   /*!< Columns of the screen */
+  char *cells;   /*!< Screen being composed */
+  char *shown;   /*!< Screen on the terminal */
+  BOOL valid;    /*!< FALSE if shown does not match the terminal */
+  char *out;     /*!< Output buffer */
+  size_t n_out;  /*!< Bytes of the last output */
+  size_t max_out;/*!< Size of the output buffer */
+};
+
+/**
+ * Private functions
+ */
+void frame_move(Frame *frame, int row, int column);
+
+/**
+ * @brief Adds a cursor move to the output
+ * @author Miguel Soto
+ *
+ * @param frame a pointer to the frame
+ * @param row row, from 0
+ * @param column column, from 0
+ */
+void frame_move(Frame *frame, int row, int column)
+{
+  frame->n_out += sprintf(frame->out + frame->n_out, "\033[%d;%dH", row + 1, column + 1);
+}
+
+/**
+ * frame_create allocates a frame
+ */
+Frame *frame_create(int rows, int columns)
+{
+  Frame *frame = NULL;
+  size_t n;
+
+  /* Error control */
+  if (rows <= 0 || columns <= 0)
+  {
+    return NULL;
+  }
+
+  frame = (Frame *)malloc(sizeof(Frame));
+  if (!frame)
+  {
+    return NULL;
+  }
+
+  n = (size_t)rows * columns;
+  frame->rows = rows;
+  frame->columns = columns;
+  frame->cells = (char *)malloc(n);
+  frame->shown = (char *)malloc(n);
+  frame->max_out = n * FRAME_CELL_MAX + (rows + 2) * FRAME_MOVE_MAX;
+  frame->out = (char *)malloc(frame->max_out);
+  if (!frame->cells || !frame->shown || !frame->out)
+  {
+    frame_destroy(frame);
+    return NULL;
+  }
+
+  memset(frame->cells, FRAME_BG_CHAR, n);
+  frame->n_out = 0;
+  frame->valid = FALSE;
+
+  return frame;
+}
+
+/**
+ * frame_destroy frees a frame
+ */
+void frame_destroy(Frame *frame)
+{
+  if (!frame)
+  {
+    return;
+  }
+
+  free(frame->cells);
+  free(frame->shown);
+  free(frame->out);
+  free(frame);
+}
+
+/**
+ * frame_load copies a composed screen
+ */
+STATUS frame_load(Frame *frame, const char *cells)
+{
+  /* Error control */
+  if (!frame || !cells)
+  {
+    return ERROR;
+  }
+
+  memcpy(frame->cells, cells, (size_t)frame->rows * frame->columns);
+
+  return OK;
+}
+
+/**
+ * It gets the cells being composed
+ */
+char *frame_get_cells(Frame *frame)
+{
+  if (!frame)
+  {
+    return NULL;
+  }
+
+  return frame->cells;
+}
+
+/**
+ * frame_invalidate forgets what is on the terminal
+ */
+void frame_invalidate(Frame *frame)
+{
+  if (frame)
+  {
+    frame->valid = FALSE;
+  }
+}
+
+/**
+ * frame_render builds the output from the shown screen to the composed one
+ */
+const char *frame_render(Frame *frame, size_t *len)
+{
+  const char *cell = NULL, *old = NULL;
+  int r, c, last, j, colour, cur_row = -1, cur_col = -1;
+  BOOL full;
+
+  /* Error control */
+  if (!frame || !len)
+  {
+    return NULL;
+  }
+
+  frame->n_out = 0;
+  full = !frame->valid;
+  colour = -1;
+  if (full)
+  {
+    strcpy(frame->out, "\033[0m\033[2J");
+    frame->n_out = strlen(frame->out);
+  }
+
+  for (r = 0; r < frame->rows; r++)
+  {
+    cell = frame->cells + (size_t)r * frame->columns;
+    old = frame->shown + (size_t)r * frame->columns;
+
+    for (c = 0; c < frame->columns; c++)
+    {
+      if (!full && cell[c] == old[c])
+      {
+        continue;
+      }
+
+      /* A span of changes, joined while the gaps between them are short */
+      last = c;
+      for (j = c + 1; j < frame->columns && j - last <= FRAME_GAP; j++)
+      {
+        if (full || cell[j] != old[j])
+        {
+          last = j;
+        }
+      }
+
+      if (r != cur_row || c != cur_col)
+      {
+        frame_move(frame, r, c);
+      }
+
+      for (j = c; j <= last; j++)
+      {
+        if ((cell[j] == FRAME_BG_CHAR) != colour)
+        {
+          colour = (cell[j] == FRAME_BG_CHAR);
+          strcpy(frame->out + frame->n_out, colour ? FRAME_SGR_BG : FRAME_SGR_FG);
+          frame->n_out += strlen(colour ? FRAME_SGR_BG : FRAME_SGR_FG);
+        }
+        frame->out[frame->n_out++] = cell[j];
+      }
+
+      cur_row = r;
+      cur_col = last + 1;
+      c = last;
+    }
+  }
+
+  /* The cursor is left in the cleared line below the screen */
+  strcpy(frame->out + frame->n_out, "\033[0m");
+  frame->n_out += strlen("\033[0m");
+  frame_move(frame, frame->rows, 0);
+  strcpy(frame->out + frame->n_out, "\033[J");
+  frame->n_out += strlen("\033[J");
+
+  memcpy(frame->shown, frame->cells, (size_t)frame->rows * frame->columns);
+  frame->valid = TRUE;
+
+  *len = frame->n_out;
+  return frame->out;
+}
+
+/**
+ * frame_paint sends the changes to a file descriptor
+ */
+long frame_paint(Frame *frame, int fd)
+{
+  const char *out = NULL;
+  size_t len = 0, sent = 0;
+  long n;
+
+  out = frame_render(frame, &len);
+  if (!out)
+  {
+    return -1;
+  }
+
+  fflush(stdout);
+  while (sent < len)
+  {
+    n = (long)write(fd, out + sent, len - sent);
+    if (n <= 0)
+    {
+      frame->valid = FALSE;
+      return -1;
+    }
+    sent += n;
+  }
+
+  return (long)sent;
+}
+
+/**
+ * It gets the bytes of the last paint
+ */
+size_t frame_get_last_bytes(Frame *frame)
+{
+  if (!frame)
+  {
+    return 0;
+  }
+
+  return frame->n_out;
+}
+
+/**
+ * It gets the output of the last paint
+ */
+const char *frame_get_last_output(Frame *frame)
+{
+  if (!frame)
+  {
+    return NULL;
+  }
+
+  return frame->out;
+}
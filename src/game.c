@@ -16,6 +16,19 @@
 #include <time.h>
 #include "../include/game.h"
 #include "../include/game_managment.h"
+#include "../include/game_effects.h"
+#include "../include/container.h"
+
+VECTOR_DECLARE(Enemy_vector, Enemy *);
+VECTOR_DEFINE(Enemy_vector, Enemy *);
+VECTOR_DECLARE(Space_vector, Space *);
+VECTOR_DEFINE(Space_vector, Space *);
+VECTOR_DECLARE(Obj_vector, Object *);
+VECTOR_DEFINE(Obj_vector, Object *);
+VECTOR_DECLARE(Link_vector, Link *);
+VECTOR_DEFINE(Link_vector, Link *);
+HMAP_DECLARE(Occupant_map, Id, Enemy_vector *);
+HMAP_DEFINE(Occupant_map, Id, Enemy_vector *, CONTAINER_HASH_INT, NO_ID);
 
 /**
  * @brief Game
@@ -25,15 +38,22 @@
 struct _Game
 {
   Player *player[MAX_PLAYERS]; /*!< Pointer to player's array */
-  Object *object[MAX_OBJS];    /*!< Pointer to object's array */
-  Enemy *enemy[MAX_ENEMYS];    /*!< Pointer to enemy's array */
-  Space *spaces[MAX_SPACES];   /*!< Pointer to space's array */
-  Link *links[MAX_LINKS];      /*!< Pointer to link's array */
+  Obj_vector objects;          /*!< Objects, in loading order */
+  Enemy_vector enemies;        /*!< Live enemies, without holes (at most MAX_ENEMYS) */
+  Enemy_vector enemy_free;     /*!< Free list of the pool: records of despawned enemies */
+  Space_vector spaces;         /*!< Spaces, in loading order */
+  Link_vector links;           /*!< Links, in loading order */
+  Occupant_map occupants;      /*!< Live enemies of each space, in order of arrival (lists in the arena) */
   char *inspection;            /*!< Long description for inspect space */
   Time day_time;               /*!< Time cycle of the game */
   T_Command last_cmd;          /*!< Last command input */
   R_Event last_event;          /*!< Last event */
   Dialogue *dialogue;          /*!< Text to print*/
+  Arena *arena;                /*!< Memory of the loaded world (spaces, objects, players, enemies and links) */
+  Handle_table *handles;       /*!< Translation of the ids of the map to the handles of the entities */
+  Strpool *texts;              /*!< Names and descriptions of the world (in the arena) */
+  Atlas *atlas;                /*!< Drawings of the world (in the arena) */
+  Obj_types *types;            /*!< Object types of the world (in the arena) */
 } ;
 
 /**
@@ -59,6 +79,13 @@ STATUS game_event_trap(Game *game);
 STATUS game_event_slime(Game *game);
 STATUS game_event_daynight(Game *game);
 STATUS game_event_spawn(Game *game);
+int game_find(Game *game, Id id, Handle_kind kind);
+STATUS game_alloc_pools(Game *game);
+void game_init_registries(Game *game);
+void game_destroy_registries(Game *game);
+STATUS game_occupant_add(Game *game, Enemy *e);
+void game_occupant_remove(Game *game, Enemy *e);
+STATUS game_move_enemy(Game *game, Enemy *e, Id location);
 
 /**
  * Game interface implementation
@@ -86,10 +113,10 @@ STATUS game_alloc(Game *game)
     }
   }
 
+  game_init_registries(game);
   for (i = 0; i < MAX_ENEMYS; i++)
   {
-    game->enemy[i] = enemy_create(id_enemy);
-    if (!game->enemy[i])
+    if (Enemy_vector_push(&game->enemies, enemy_create(id_enemy)) == ERROR || !game->enemies.data[i])
     {
       return ERROR;
     }
@@ -113,33 +140,23 @@ STATUS game_create(Game *game)
     return ERROR;
   }
 
-  for (i = 0; i < MAX_SPACES; i++)
-  {
-    game->spaces[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_OBJS; i++)
-  {
-    game->object[i] = NULL;
-  }
-
   for (i = 0; i < MAX_PLAYERS; i++)
   {
     game->player[i] = NULL;
   }
 
-  for (i = 0; i < MAX_ENEMYS; i++)
-  {
-    game->enemy[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_LINKS; i++)
-  {
-    game->links[i] = NULL;
-  }
+  Space_vector_clear(&game->spaces);
+  Obj_vector_clear(&game->objects);
+  Enemy_vector_clear(&game->enemies);
+  Enemy_vector_clear(&game->enemy_free);
+  Link_vector_clear(&game->links);
+  Occupant_map_clear(&game->occupants);
 
   game->day_time = DAY;
   game->last_cmd = NO_CMD;
+
+  /* Handles of a previous world become stale */
+  handle_table_reset(game->handles);
   
   return OK;
 }
@@ -149,45 +166,23 @@ STATUS game_create(Game *game)
  */
 STATUS game_destroy(Game *game)
 {
-  int i = 0;
-
   /* Error control*/
   if (game == NULL)
   {
     return ERROR;
   }
 
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
-  {
-    obj_destroy(game->object[i]);
-    game->object[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_PLAYERS && game->player[i] != NULL; i++)
-  {
-    player_destroy(game->player[i]);
-    game->player[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
-  {
-    enemy_destroy(game->enemy[i]);
-    game->enemy[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
-  {
-    space_destroy(game->spaces[i]);
-    game->spaces[i] = NULL;
-  }
-
-  for (i = 0; i < MAX_LINKS; i++)
-  {
-    link_destroy(game->links[i]);
-    game->links[i] = NULL;
-  }
+  game_destroy_registries(game);
+  Space_vector_free(&game->spaces);
+  Obj_vector_free(&game->objects);
+  Enemy_vector_free(&game->enemies);
+  Enemy_vector_free(&game->enemy_free);
+  Link_vector_free(&game->links);
+  Occupant_map_free(&game->occupants);
 
   dialogue_destroy(game->dialogue);
+  arena_destroy(game->arena);
+  handle_table_destroy(game->handles);
 
   free(game);
   game = NULL;
@@ -214,19 +209,14 @@ STATUS game_add_space(Game *game, Space *space)
     return ERROR;
   }
 
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
-  {
-  }
-
-  /* Error control*/
-  if (i >= MAX_SPACES)
+  i = game->spaces.size;
+  if (Space_vector_reserve(&game->spaces, i + 1) == ERROR ||
+      handle_table_add(game->handles, space_get_id(space), HANDLE_SPACE, i) == NO_HANDLE)
   {
     return ERROR;
   }
 
-  game->spaces[i] = space;
-
-  return OK;
+  return Space_vector_push(&game->spaces, space);
 }
 
 /**
@@ -242,19 +232,14 @@ STATUS game_add_object(Game *game, Object *obj)
     return ERROR;
   }
 
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
-  {
-  }
-
-  /* Error control*/
-  if (i >= MAX_OBJS)
+  i = game->objects.size;
+  if (Obj_vector_reserve(&game->objects, i + 1) == ERROR ||
+      handle_table_add(game->handles, obj_get_id(obj), HANDLE_OBJECT, i) == NO_HANDLE)
   {
     return ERROR;
   }
 
-  game->object[i] = obj;
-
-  return OK;
+  return Obj_vector_push(&game->objects, obj);
 }
 
 /**
@@ -281,6 +266,11 @@ STATUS game_add_player(Game *game, Player *p)
   }
 
   game->player[i] = p;
+  if (handle_table_add(game->handles, player_get_id(p), HANDLE_PLAYER, i) == NO_HANDLE)
+  {
+    game->player[i] = NULL;
+    return ERROR;
+  }
 
   return OK;
 }
@@ -290,25 +280,101 @@ STATUS game_add_player(Game *game, Player *p)
  */
 STATUS game_add_enemy(Game *game, Enemy *e)
 {
-    int i = 0;
+  int i = 0;
 
   /* Error control*/
-  if (!game || !e)
+  if (!game || !e || game->enemies.size >= MAX_ENEMYS)
   {
     return ERROR;
   }
 
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  /* Live enemies have no holes, the next slot is free */
+  i = game->enemies.size;
+  if (Enemy_vector_reserve(&game->enemies, i + 1) == ERROR ||
+      handle_table_add(game->handles, enemy_get_id(e), HANDLE_ENEMY, i) == NO_HANDLE)
   {
+    return ERROR;
   }
+  Enemy_vector_push(&game->enemies, e);
+
+  return game_occupant_add(game, e);
+}
+
+/**
+ * Spawns an enemy copied from a model, using a record of the pool
+ */
+Enemy *game_spawn_enemy(Game *game, Enemy *model, Id id, Id location)
+{
+  Enemy *e = NULL;
 
   /* Error control*/
-  if (i >= MAX_ENEMYS)
+  if (!game || !model || id == NO_ID || game->enemies.size >= MAX_ENEMYS || game_get_handle(game, id) != NO_HANDLE)
+  {
+    return NULL;
+  }
+
+  if (game->enemy_free.size > 0)
+  {
+    e = game->enemy_free.data[--game->enemy_free.size];
+  }
+  else
+  {
+    /* The pool grows from the arena of the world */
+    e = enemy_create_in(id, game->arena);
+    if (!e)
+    {
+      return NULL;
+    }
+  }
+
+  enemy_copy(e, model, id);
+  enemy_set_location(e, location);
+
+  if (game_add_enemy(game, e) == ERROR)
+  {
+    if (Enemy_vector_push(&game->enemy_free, e) == ERROR)
+    {
+      enemy_destroy(e);
+    }
+    return NULL;
+  }
+
+  return e;
+}
+
+/**
+ * Despawns an enemy, its record goes back to the pool
+ */
+STATUS game_despawn_enemy(Game *game, Id id)
+{
+  Enemy *e = NULL, *last = NULL;
+  int i, n;
+
+  i = game_find(game, id, HANDLE_ENEMY);
+  /* Error control*/
+  if (i == -1)
   {
     return ERROR;
   }
 
-  game->enemy[i] = e;
+  e = game->enemies.data[i];
+  n = game->enemies.size - 1;
+  handle_table_release(game->handles, game_get_handle(game, id));
+  game_occupant_remove(game, e);
+
+  /* The last live enemy fills the hole and gets a handle for its new slot */
+  Enemy_vector_remove_swap(&game->enemies, i);
+  if (i != n)
+  {
+    last = game->enemies.data[i];
+    handle_table_release(game->handles, game_get_handle(game, enemy_get_id(last)));
+    handle_table_add(game->handles, enemy_get_id(last), HANDLE_ENEMY, i);
+  }
+
+  if (Enemy_vector_push(&game->enemy_free, e) == ERROR)
+  {
+    enemy_destroy(e);
+  }
 
   return OK;
 }
@@ -326,19 +392,14 @@ STATUS game_add_link(Game *game, Link *l)
     return ERROR;
   }
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++)
-  {
-  }
-
-  /* Error control*/
-  if (i >= MAX_LINKS)
+  i = game->links.size;
+  if (Link_vector_reserve(&game->links, i + 1) == ERROR ||
+      handle_table_add(game->handles, link_get_id(l), HANDLE_LINK, i) == NO_HANDLE)
   {
     return ERROR;
   }
 
-  game->links[i] = l;
-
-  return OK;
+  return Link_vector_push(&game->links, l);
 }
 
 /**
@@ -348,12 +409,12 @@ STATUS game_add_link(Game *game, Link *l)
 Id game_get_space_id_at(Game *game, int position)
 {
   /* Error control*/
-  if (position < 0 || position >= MAX_SPACES)
+  if (!game || position < 0 || position >= game->spaces.size)
   {
     return NO_ID;
   }
 
-  return space_get_id(game->spaces[position]);
+  return space_get_id(game->spaces.data[position]);
 }
 
 /** Gets game's space with target id
@@ -362,21 +423,14 @@ Space *game_get_space(Game *game, Id id)
 {
   int i;
 
+  i = game_find(game, id, HANDLE_SPACE);
   /* Error control*/
-  if (!game || id == NO_ID)
+  if (i == -1)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
-  {
-    if (id == space_get_id(game->spaces[i]))
-    {
-      return game->spaces[i];
-    }
-  }
-
-  return NULL;
+  return game->spaces.data[i];
 }
 
 /** Sets the day time of the game
@@ -396,9 +450,9 @@ STATUS game_set_time(Game *game, Time time)
 
   if (time == NIGHT)
   {
-    for (i = 0; i < MAX_SPACES; i++)
+    for (i = 0; i < game->spaces.size; i++)
     {
-      s = game->spaces[i];
+      s = game->spaces.data[i];
       id = space_get_id(s);
 
       if (s != NULL)
@@ -414,9 +468,9 @@ STATUS game_set_time(Game *game, Time time)
     } 
   } else 
   {
-    for (i = 0; i < MAX_SPACES; i++)
+    for (i = 0; i < game->spaces.size; i++)
     {
-      s = game->spaces[i];
+      s = game->spaces.data[i];
       id = space_get_id(s);
 
       if (s != NULL)
@@ -455,21 +509,14 @@ Object *game_get_object(Game *game, Id id)
 {
   int i;
 
+  i = game_find(game, id, HANDLE_OBJECT);
   /* Error control*/
-  if (!game || id == NO_ID)
+  if (i == -1)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
-  {
-    if (id == obj_get_id(game->object[i]))
-    {
-      return game->object[i];
-    }
-  }
-
-  return NULL;
+  return game->objects.data[i];
 }
 
 /**
@@ -490,11 +537,11 @@ Object *game_get_object_byName(Game *game, char *name)
     return NULL;
   }
 
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  for (i = 0; i < game->objects.size; i++)
   {
-    if (strcasecmp(name, obj_get_name(game->object[i])) == 0)
+    if (strcasecmp(name, obj_get_name(game->objects.data[i])) == 0)
     {
-      return game->object[i];
+      return game->objects.data[i];
     }
   }
 
@@ -519,11 +566,11 @@ Link *game_get_link_byName(Game *game, char *name)
     return NULL;
   }
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++)
+  for (i = 0; i < game->links.size; i++)
   {
-    if (strcasecmp(name, link_get_name(game->links[i])) == 0)
+    if (strcasecmp(name, link_get_name(game->links.data[i])) == 0)
     {
-      return game->links[i];
+      return game->links.data[i];
     }
   }
 
@@ -532,21 +579,7 @@ Link *game_get_link_byName(Game *game, char *name)
 
 Enemy *game_get_enemyWithPlayer(Game *game, Id player_loc){
 
-  int i;
-
-  if (!game || player_loc == NO_ID){
-    return NULL;
-  }
-
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
-  {
-    if (player_loc == enemy_get_location(game->enemy[i]))
-    {
-      return game->enemy[i];
-    }
-  }
-
-  return NULL;
+  return game_get_enemy_in_space_at(game, player_loc, 0);
 
 }
 
@@ -563,11 +596,11 @@ Enemy *game_get_enemy_byName(Game *game, char *name)
     return NULL;
   }
 
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  for (i = 0; i < game->enemies.size; i++)
   {
-    if (strcasecmp(name, enemy_get_name(game->enemy[i])) == 0)
+    if (strcasecmp(name, enemy_get_name(game->enemies.data[i])) == 0)
     {
-      return game->enemy[i];
+      return game->enemies.data[i];
     }
   }
 
@@ -581,21 +614,14 @@ Player *game_get_player(Game *game, Id id)
 {
   int i;
 
+  i = game_find(game, id, HANDLE_PLAYER);
   /* Error control*/
-  if (!game || id == NO_ID)
+  if (i == -1)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_PLAYERS && game->player[i] != NULL; i++)
-  {
-    if (id == player_get_id(game->player[i]))
-    {
-      return game->player[i];
-    }
-  }
-
-  return NULL;
+  return game->player[i];
 }
 
 /**
@@ -605,21 +631,14 @@ Enemy *game_get_enemy(Game *game, Id id)
 {
   int i;
 
+  i = game_find(game, id, HANDLE_ENEMY);
   /* Error control*/
-  if (!game || id == NO_ID)
+  if (i == -1)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
-  {
-    if (id == enemy_get_id(game->enemy[i]))
-    {
-      return game->enemy[i];
-    }
-  }
-
-  return NULL;
+  return game->enemies.data[i];
 }
 
 /**
@@ -643,21 +662,14 @@ Link *game_get_link(Game *game, Id id)
 {
   int i;
 
+  i = game_find(game, id, HANDLE_LINK);
   /* Error control*/
-  if (!game || id == NO_ID)
+  if (i == -1)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++)
-  {
-    if (id == link_get_id(game->links[i]))
-    {
-      return game->links[i];
-    }
-  }
-
-  return NULL;
+  return game->links.data[i];
 }
 
 /**
@@ -737,7 +749,7 @@ STATUS game_set_enemy_location(Game *game, Id enemy_id, Id space_id)
     return ERROR;
   }
 
-  return enemy_set_location(game->enemy[MAX_PLAYERS - 1], space_id);
+  return game_move_enemy(game, e, space_id);
 }
 
 /** Gets an player's position
@@ -931,6 +943,13 @@ int game_update(Game *game, T_Command cmd, char *arg1, char *arg2)
   }
   
   game->last_cmd = cmd;
+
+  /* Scrolling is up to the front-end, the world and the dialogue stay as they are */
+  if (cmd == SCROLL)
+  {
+    return 1;
+  }
+
   game->inspection = 0;
   dialogue_reset(game->dialogue);
   
@@ -1039,15 +1058,15 @@ void game_print_data(Game *game)
   printf("\n\n-------------\n\n");
 
   printf("=> Spaces: \n");
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  for (i = 0; i < game->spaces.size; i++)
   {
-    space_print(game->spaces[i]);
+    space_print(game->spaces.data[i]);
   }
 
   printf("=> Objects:\n");
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  for (i = 0; i < game->objects.size; i++)
   {
-    obj_print(game->object[i]);
+    obj_print(game->objects.data[i]);
   }
 
   printf("=> Players:\n");
@@ -1057,9 +1076,9 @@ void game_print_data(Game *game)
   }
 
   printf("=> Enemies:\n");
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  for (i = 0; i < game->enemies.size; i++)
   {
-    enemy_print(game->enemy[i]);
+    enemy_print(game->enemies.data[i]);
   }
 }
 
@@ -1074,7 +1093,7 @@ BOOL game_is_over(Game *game)
     return TRUE;
   }
 
-   if (enemy_get_health(game_get_enemy(game, 45)) <= 0)
+   if (game_is_boss_dead(game) == TRUE)
   {
     dialogue_set_command(game->dialogue, DC_END, NULL, NULL, NULL);
     return TRUE;
@@ -1139,7 +1158,7 @@ STATUS game_command_take(Game *game, char *arg)
   /* Error control*/
   if(object_get_movable(obj_taken)==TRUE && obj_is_visible(obj_taken, space_get_light_status(game_get_space(game, player_location))) && id_obj_taken != 398){  
     /* Error control*/
-    if (space_has_object(game_get_space(game, player_location), id_obj_taken) == TRUE && set_get_nids(inventory_get_objects(player_get_inventory(game->player[0]))) < inventory_get_maxObjs(player_get_inventory(game->player[0])))
+    if (space_has_object(game_get_space(game, player_location), id_obj_taken) == TRUE && inventory_is_full(player_get_inventory(game->player[0])) == FALSE)
     {
       s = game_get_space(game, player_location);
       o = game_get_object(game, id_obj_taken);
@@ -1186,28 +1205,12 @@ STATUS game_command_take(Game *game, char *arg)
         st = ERROR;
       }
       
-      if (id_obj_taken == 383)
-      {
-        dialogue_set_command(game->dialogue, DC_TAKE_M, NULL, NULL, NULL);
-        player_set_max_health(game_get_player(game, 21), player_get_max_health(game_get_player(game, 21)) + 10);
-        player_set_health(game_get_player(game, 21), player_get_health(game_get_player(game, 21)) + 10);
-        return st;
-      }
-
-      if (id_obj_taken == 384)
+      /* Some types do something when taken, they set their own dialogue */
+      if (game_effects_take(game, game->player[MAX_PLAYERS - 1], o) == TRUE)
       {
-        dialogue_set_command(game->dialogue, DC_TAKE_S, NULL, NULL, NULL);
-        player_set_baseDmg(game_get_player(game, 21), player_get_baseDmg(game_get_player(game, 21)) + 1);
         return st;
       }
 
-      if (id_obj_taken == 380)
-      {
-        dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
-        player_set_crit(game_get_player(game, 21), object_get_crit(obj_taken));
-        return st;
-      }
-      
       dialogue_set_command(game->dialogue, DC_TAKE, NULL, o, NULL);
       return st;
     }
@@ -1332,18 +1335,15 @@ STATUS game_command_attack(Game *game, char *arg)
   Enemy *enemy = game_get_enemyWithPlayer(game, player_loc);
   Id enemy_loc = enemy_get_location(enemy);
   
+  Inventory *inventory = player_get_inventory(game->player[MAX_PLAYERS - 1]);
+  Object *weapon = inventory_get_weapon(inventory);
+
   int player_crit = player_get_crit(game->player[MAX_PLAYERS - 1]);
   int player_baseDmg = player_get_baseDmg(game->player[MAX_PLAYERS - 1]);
 
   int enemy_crit = enemy_get_crit(enemy);
   int enemy_baseDmg = enemy_get_baseDmg(enemy);
 
-  Object *Sword1 = game_get_object_byName(game, "Sword1");
-  Object *Sword2 = game_get_object_byName(game, "Sword2");
-
-  Id id_Sword1 = obj_get_id(Sword1) ;
-  Id id_Sword2 = obj_get_id(Sword2) ;
-
   int hit_chance=5;
  
 
@@ -1382,6 +1382,11 @@ STATUS game_command_attack(Game *game, char *arg)
   }
 
 
+  /* Objects like the Crit_Sword give their crit chance while carried */
+  if (inventory_get_crit_bonus(inventory) > player_crit){
+    player_crit = inventory_get_crit_bonus(inventory);
+  }
+
   /* Changing the base dmg if it is a crit from the player*/
   if(rand_crit_player < player_crit){
     player_baseDmg = player_baseDmg*2;
@@ -1391,24 +1396,13 @@ STATUS game_command_attack(Game *game, char *arg)
     dialogue_set_command(game->dialogue, DC_ATTACK_CRITICAL, NULL, NULL, NULL);
   }
 
-/*Basically if a player has either sword, hit chance is increased, each attack removes one durability, after 3 attacks sword must be destroyed*/
-if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword1))
-  {
-     hit_chance= hit_chance-2;
-    object_set_durability(Sword1, (object_get_durability(Sword1)-1));
-    if(object_get_durability(Sword1)<=0){
-      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword1);
-      dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
-    }
-  }
-  else if(player_has_object(game->player[MAX_PLAYERS - 1], id_Sword2))
+/*Basically if a player has a sword, hit chance is increased, each attack removes one durability, after 3 attacks sword must be destroyed*/
+if(weapon)
   {
     hit_chance= hit_chance-2;
-    object_set_durability(Sword2, (object_get_durability(Sword2)-1));
-     if(object_get_durability(Sword1)<=0){
-      inventory_remove_object(player_get_inventory(game->player[MAX_PLAYERS - 1]), id_Sword2);
+    if(inventory_wear_weapon(inventory)<=0){
+      inventory_remove_object(inventory, obj_get_id(weapon));
       dialogue_set_command(game->dialogue, DC_SBROKE, NULL, NULL, NULL);
-      
     }
   }
 
@@ -1877,153 +1871,25 @@ STATUS game_command_open(Game *game, char *link_name, char *obj_name)
 STATUS game_command_use(Game *game, char *arg)
 {
   Object *obj = NULL;
-  Id id = NO_ID;
-  Obj_type type = UNKNOWN_TYPE;
   Player *player = NULL;
-  STATUS st = OK;
-
-  printf("**\nEntrando use\n");
 
+  /* Error control */
   if (!game || !arg)
   {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    st = ERROR;
-    return st;
+    return ERROR;
   }
 
   obj = game_get_object_byName(game, arg);
-  printf("Getting obj\n");
-
-  if (obj == NULL)
-  {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    printf("Obj es NULL\n**\n");
-    st = ERROR;
-    return st;
-  }
-
-  printf("Gettin id & player\n");
-  id = obj_get_id(obj);
   player = game_get_player(game, 21);
-  
-  
-  if (id == NO_ID || !player)
-  {
-    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-    printf("Id obj es NO_ID or player == NULL\n**\n");
-    st = ERROR;
-    return st;
-  }
-
-  printf("Viendo tipo object\n");
-  type = obj_get_type(id);
-
-  printf("Viendo si el player tiene el objeto\n");
-  if (type != BED)
-  {
-    if (inventory_has_id(player_get_inventory(player), id) == FALSE)
-    {
-      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-      printf("No tiene el objeto\n**\n");
-      st = ERROR;
-      return st;
-    }
-  }
-  else if (type == BED)
-  {
-    if (space_has_object(game_get_space(game, player_get_location(player)), id) == FALSE)
-    {
-      dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-      printf("No tiene el objeto\n**\n");
-      st = ERROR;
-      return st;
-    }
-  }
-
-
-  if (type == APPLE && st == OK) /*Case apples*/
-  {
-    printf("Es manzana\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_health(player, player_get_health(player) + 1);
-
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
-
-    return st;
-  }
-  else if (type == ELIXIR && st == OK) /*Case elixir*/
-  {
-    printf("Es elixir\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_health(player, player_get_health(player) + 2);
-
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_APPLE, NULL, NULL, NULL);
-
-    return st;
-  }
-  else if (type == ARMOR && st == OK) /*Case armour*/
-  {
-    printf("Es armadura\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    st = player_set_max_health(player, player_get_max_health(player) + 1);
-
-    st = obj_set_location(game_get_object(game, id), -1);
-    dialogue_set_command(game->dialogue, DC_USE_ARMOR, NULL, NULL, NULL);
-
-    return st;
-  }
-  else if (type == HOOK && st == OK) /*Case hook*/
-  {
-    printf("Es hook\n");
-    st = inventory_remove_object(player_get_inventory(player), id);
-    if (player_get_location(player) == 125)
-    {
-      st = obj_set_location(game_get_object(game, 398), -1);
-      st = inventory_add_object(player_get_inventory(player), 398);
-
-      st = obj_set_location(game_get_object(game, id), -1);
-      dialogue_set_command(game->dialogue, DC_USE_HOOK, NULL, NULL, NULL);
-
-      return st;
-    }
-  }
-  else if (type == BED && st == OK) /*Case bed*/
-  {
-    printf("Es cama\n");
-    /*st = set_del_id(space_get_objects(game_get_space(game, player_get_location(player))), id);*/
-    if (game_get_time(game) == DAY)
-    {
-      st = game_set_time(game, NIGHT);
-    }
-    else
-    {
-      st = game_set_time(game, DAY);
-    }
 
-    dialogue_set_command(game->dialogue, DC_USE_BED, NULL, NULL, NULL);
-
-    return st;
-  } else if (type == BREAD_CRUMBS)
+  /* The type of the object says what using it does */
+  if (!obj || !player || game_effects_use(game, player, obj) == ERROR)
   {
-    if (player_get_location(player) == 11) 
-    {
-      dialogue_set_command(game->dialogue, DC_BREAD, NULL, NULL, NULL);
-      st = inventory_remove_object(player_get_inventory(player), id);
-      return st;
-    }
-    else 
-    {
-      st = ERROR;
-      return st;
-    }
+    dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
+    return ERROR;
   }
 
-  dialogue_set_error(game->dialogue, E_USE, NULL, NULL, NULL);
-  printf("No es ninguno: %d", (int) type);
-  st = ERROR;
-  return st;  
+  return OK;
 }
 /**
  * @brief It executes MOVE event
@@ -2134,7 +2000,7 @@ STATUS game_event_slime(Game *game){
   }
 
   /*Sets the enemy on players location*/
-  enemy_set_location(slime, player_get_location(game->player[MAX_PLAYERS - 1]));
+  game_move_enemy(game, slime, player_get_location(game->player[MAX_PLAYERS - 1]));
 
   dialogue_set_event(game->dialogue, DE_SLIME);
   return OK;
@@ -2196,12 +2062,12 @@ Id game_get_enemy_id(Game *game, int num)
 {
 
   /* Error control */
-  if (!game || num < 0 || num > MAX_ENEMYS - 1)
+  if (!game || num < 0 || num >= game->enemies.size)
   {
     return NO_ID;
   }
 
-  return (Id)enemy_get_id(game->enemy[num]);
+  return (Id)enemy_get_id(game->enemies.data[num]);
 }
 
 Id game_get_player_id(Game *game)
@@ -2224,12 +2090,12 @@ Id game_get_object_id(Game *game, int num)
 {
 
   /* Error control */
-  if (!game || num < 0 || num > MAX_ENEMYS - 1)
+  if (!game || num < 0 || num >= game->objects.size)
   {
     return NO_ID;
   }
 
-  return (Id)obj_get_id(game->object[num]);
+  return (Id)obj_get_id(game->objects.data[num]);
 }
 
 Game *game_alloc2()
@@ -2249,6 +2115,19 @@ Game *game_alloc2()
   game->day_time = DAY;
   game->last_event = NOTHING;
   game->dialogue = dialogue_create();
+  game->arena = arena_create(ARENA_BLOCK_SIZE);
+  game->handles = handle_table_create();
+  game_init_registries(game);
+  /* Error control */
+  if (!game->arena || !game->handles || game_alloc_pools(game) == ERROR)
+  {
+    fprintf(stderr, "Error saving memory for game(game_create)");
+    dialogue_destroy(game->dialogue);
+    arena_destroy(game->arena);
+    handle_table_destroy(game->handles);
+    free(game);
+    return NULL;
+  }
 
   return game;
 }
@@ -2260,16 +2139,19 @@ STATUS game_save(char *filename, Game* game)
  file = fopen("savedata.dat", "w");
  fclose(file);
 
+  /*Object types*/
+  game_effects_print_save(game->types, "savedata.dat");
+
   /*Spaces*/
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  for (i = 0; i < game->spaces.size; i++)
   {
-    space_print_save("savedata.dat", game->spaces[i]);
+    space_print_save("savedata.dat", game->spaces.data[i]);
   }
 
   /*Objects*/
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  for (i = 0; i < game->objects.size; i++)
   {
-    obj_print_save("savedata.dat", game->object[i]);
+    obj_print_save("savedata.dat", game->objects.data[i]);
   }
 
   /*Players*/
@@ -2279,15 +2161,15 @@ STATUS game_save(char *filename, Game* game)
   }
 
   /*Enemies*/
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  for (i = 0; i < game->enemies.size; i++)
   {
-    enemy_print_save("savedata.dat", game->enemy[i]);
+    enemy_print_save("savedata.dat", game->enemies.data[i]);
   }
 
   /*Links*/
-  for (i = 0; i < MAX_LINKS && game->links[i] != NULL; i++)
+  for (i = 0; i < game->links.size; i++)
   {
-    link_print_save("savedata.dat", game->links[i]);
+    link_print_save("savedata.dat", game->links.data[i]);
   }
 
   /*Inventory*/
@@ -2366,9 +2248,9 @@ STATUS game_update_time(Game *game)
 
   time = game_get_time(game);
 
-  for (i = 0; i < MAX_SPACES; i++)
+  for (i = 0; i < game->spaces.size; i++)
   {
-    if ((s = game->spaces[i]) != NULL && (id = space_get_id(s)) != NO_ID)
+    if ((s = game->spaces.data[i]) != NULL && (id = space_get_id(s)) != NO_ID)
     {
       if (id != 121 && id != 125)
       {
@@ -2407,25 +2289,26 @@ STATUS game_update_object(Game *game)
   key1 = game_get_object(game, 399);
   key2 = game_get_object(game, 385);
 
-  if (!e1 || !e2 || !key1 || !key2)
+  if (!key1 || !key2)
   {
     return ERROR;
   }
 
-  if (enemy_get_health(e1) <= 0 && space_has_object(game_get_space(game, 127), obj_get_id(key1)) == FALSE && enemy_get_location(e1) != NO_ID)
+  /* Dead guards are already back in the pool */
+  if (e1 && enemy_get_health(e1) <= 0 && space_has_object(game_get_space(game, 127), obj_get_id(key1)) == FALSE && enemy_get_location(e1) != NO_ID)
   {
     obj_set_location(key1, 127);
     space_add_objectid(game_get_space(game, 127), obj_get_id(key1));
     enemy_set_health(e1, -1);
-    enemy_set_location(e1, -1);
+    game_move_enemy(game, e1, NO_ID);
   }
 
-    if (enemy_get_health(e2) <= 0 && space_has_object(game_get_space(game, 126), obj_get_id(key2)) == FALSE && enemy_get_location(e2) != NO_ID)
+    if (e2 && enemy_get_health(e2) <= 0 && space_has_object(game_get_space(game, 126), obj_get_id(key2)) == FALSE && enemy_get_location(e2) != NO_ID)
   {
     obj_set_location(key2, 126);
     space_add_objectid(game_get_space(game, 126), obj_get_id(key2));
     enemy_set_health(e2, -1);
-    enemy_set_location(e2, -1);
+    game_move_enemy(game, e2, NO_ID);
   }
   
   if (object_get_durability(game_get_object(game, 392)) <= 0)
@@ -2453,17 +2336,21 @@ STATUS game_update_enemy(Game *game)
     return ERROR;
   }
 
-  for (i = 0; i < MAX_ENEMYS; i++)
+  /* Dead enemies go back to the pool, the slot is checked again because
+   * the last enemy was moved into it */
+  while (i < game->enemies.size)
   {
-    e = game->enemy[i];
+    e = game->enemies.data[i];
 
-    if (e)
+    if (enemy_get_health(e) <= 0)
     {
-      if (enemy_get_health(e) <= 0 && enemy_get_location(e) != -1)
-      {
-        enemy_set_health(e, -1);
-        enemy_set_location(e, -1);
-      }
+      enemy_set_health(e, -1);
+      game_move_enemy(game, e, NO_ID);
+      game_despawn_enemy(game, enemy_get_id(e));
+    }
+    else
+    {
+      i++;
     }
   }
   return OK;
@@ -2471,17 +2358,139 @@ STATUS game_update_enemy(Game *game)
 
 STATUS game_destroy_load(Game *game)
 {
-   int i = 0;
-
    if (!game)
    {
      return ERROR;
    } 
 
-  for (i = 0; i < MAX_OBJS && game->object[i] != NULL; i++)
+  game_destroy_registries(game);
+  Space_vector_clear(&game->spaces);
+  Obj_vector_clear(&game->objects);
+  Enemy_vector_clear(&game->enemies);
+  Enemy_vector_clear(&game->enemy_free);
+  Link_vector_clear(&game->links);
+  Occupant_map_clear(&game->occupants);
+
+  /*dialogue_destroy(game->dialogue);*/
+
+  /* Everything loaded from the file was in the arena */
+  arena_reset(game->arena);
+
+  /* So were the types, texts and drawings, the next file loads its own */
+  game->inspection = " ";
+  return game_alloc_pools(game);
+}
+
+/**
+ * It gets the arena of the loaded world
+ */
+Arena *game_get_arena(Game *game)
+{
+  /* Error control */
+  if (!game)
+  {
+    return NULL;
+  }
+
+  return game->arena;
+}
+
+/**
+ * It gets the pool of the texts of the world
+ */
+Strpool *game_get_strpool(Game *game)
+{
+  /* Error control */
+  if (!game)
   {
-    obj_destroy(game->object[i]);
-    game->object[i] = NULL;
+    return NULL;
+  }
+
+  return game->texts;
+}
+
+/**
+ * It gets the atlas of the drawings of the world
+ */
+Atlas *game_get_atlas(Game *game)
+{
+  /* Error control */
+  if (!game)
+  {
+    return NULL;
+  }
+
+  return game->atlas;
+}
+
+/**
+ * It gets the registry of object types of the world
+ */
+Obj_types *game_get_types(Game *game)
+{
+  /* Error control */
+  if (!game)
+  {
+    return NULL;
+  }
+
+  return game->types;
+}
+
+/**
+ * @brief Makes an empty string pool, atlas and registry of types in the arena
+ * @author Miguel Soto
+ *
+ * @param game pointer to the game
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_alloc_pools(Game *game)
+{
+  game->texts = strpool_create(game->arena);
+  game->atlas = atlas_create(game->arena);
+  game->types = obj_type_create(game->arena, game->texts);
+  if (!game->texts || !game->atlas || !game->types)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Starts the empty registries of spaces, objects, enemies and links
+ * @author Miguel Soto
+ *
+ * They are out of the arena: a vector that grows leaves its old array
+ * behind, and the registries grow while the world loads.
+ *
+ * @param game pointer to the game
+ */
+void game_init_registries(Game *game)
+{
+  Space_vector_init(&game->spaces, NULL);
+  Obj_vector_init(&game->objects, NULL);
+  Enemy_vector_init(&game->enemies, NULL);
+  Enemy_vector_init(&game->enemy_free, NULL);
+  Link_vector_init(&game->links, NULL);
+  Occupant_map_init(&game->occupants, NULL);
+}
+
+/**
+ * @brief Destroys every entity of the registries and the players
+ * @author Miguel Soto
+ *
+ * The registries keep their arrays, the caller clears or frees them.
+ *
+ * @param game pointer to the game
+ */
+void game_destroy_registries(Game *game)
+{
+  int i = 0;
+
+  for (i = 0; i < game->objects.size; i++)
+  {
+    obj_destroy(game->objects.data[i]);
   }
 
   for (i = 0; i < MAX_PLAYERS && game->player[i] != NULL; i++)
@@ -2490,47 +2499,221 @@ STATUS game_destroy_load(Game *game)
     game->player[i] = NULL;
   }
 
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i] != NULL; i++)
+  for (i = 0; i < game->enemies.size; i++)
+  {
+    enemy_destroy(game->enemies.data[i]);
+  }
+  for (i = 0; i < game->enemy_free.size; i++)
   {
-    enemy_destroy(game->enemy[i]);
-    game->enemy[i] = NULL;
+    enemy_destroy(game->enemy_free.data[i]);
   }
 
-  for (i = 0; i < MAX_SPACES && game->spaces[i] != NULL; i++)
+  for (i = 0; i < game->spaces.size; i++)
   {
-    space_destroy(game->spaces[i]);
-    game->spaces[i] = NULL;
+    space_destroy(game->spaces.data[i]);
   }
 
-  for (i = 0; i < MAX_LINKS; i++)
+  for (i = 0; i < game->links.size; i++)
   {
-    link_destroy(game->links[i]);
-    game->links[i] = NULL;
+    link_destroy(game->links.data[i]);
   }
+}
 
-  /*dialogue_destroy(game->dialogue);*/
+/**
+ * It gets the handle of the entity with an id
+ */
+Handle game_get_handle(Game *game, Id id)
+{
+  /* Error control */
+  if (!game)
+  {
+    return NO_HANDLE;
+  }
 
-  return OK;
+  return handle_table_find(game->handles, id);
+}
+
+/**
+ * @brief Gets the index in its game array of the entity with an id
+ * @author Miguel Soto
+ *
+ * @param game pointer to the game
+ * @param id id of the entity
+ * @param kind kind the entity must be
+ * @return the index, or -1 if there is no entity of that kind with that id
+ */
+int game_find(Game *game, Id id, Handle_kind kind)
+{
+  Handle h;
+
+  /* Error control */
+  if (!game || id == NO_ID)
+  {
+    return -1;
+  }
+
+  h = handle_table_find(game->handles, id);
+  if (HANDLE_KIND(h) != kind)
+  {
+    return -1;
+  }
+
+  return HANDLE_INDEX(h);
 }
 
 Enemy *game_get_enemy_in_space(Game *game, Id space)
 {
-  int i;
+  return game_get_enemy_in_space_at(game, space, 0);
+}
 
+/**
+ * It counts the live enemies in a space
+ */
+int game_count_enemies_in_space(Game *game, Id space)
+{
+  Enemy_vector **list = NULL;
+
+  /* Error control */
   if (!game || space == NO_ID)
+  {
+    return 0;
+  }
+
+  list = Occupant_map_get(&game->occupants, space);
+  return list ? (*list)->size : 0;
+}
+
+/**
+ * It gets an enemy of a space by its order of arrival
+ */
+Enemy *game_get_enemy_in_space_at(Game *game, Id space, int position)
+{
+  Enemy_vector **list = NULL;
+
+  /* Error control */
+  if (!game || space == NO_ID || position < 0)
+  {
+    return NULL;
+  }
+
+  list = Occupant_map_get(&game->occupants, space);
+  if (!list || position >= (*list)->size)
   {
     return NULL;
   }
 
-  for (i = 0; i < MAX_ENEMYS && game->enemy[i]; i++)
+  return (*list)->data[position];
+}
+
+/**
+ * @brief Puts a live enemy at the end of the occupants of its space
+ * @author Miguel Soto
+ *
+ * The list of a space is made in the arena the first time an enemy gets
+ * there. Enemies out of the map are not kept.
+ *
+ * @param game pointer to the game
+ * @param e the enemy, with its location set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_occupant_add(Game *game, Enemy *e)
+{
+  Enemy_vector **found = NULL, *list = NULL;
+  Id location = enemy_get_location(e);
+
+  if (location == NO_ID)
+  {
+    return OK;
+  }
+
+  found = Occupant_map_get(&game->occupants, location);
+  if (found)
+  {
+    list = *found;
+  }
+  else
   {
-    if (enemy_get_location(game->enemy[i]) == space)
+    list = (Enemy_vector *)arena_alloc(game->arena, sizeof(Enemy_vector));
+    if (!list || Enemy_vector_init(list, game->arena) == ERROR || Occupant_map_put(&game->occupants, location, list) == ERROR)
     {
-      return game->enemy[i];
+      return ERROR;
     }
   }
 
-  return NULL;
+  return Enemy_vector_push(list, e);
+}
+
+/**
+ * @brief Takes an enemy out of the occupants of its space
+ * @author Miguel Soto
+ *
+ * The ones that came after it keep their order.
+ *
+ * @param game pointer to the game
+ * @param e the enemy, with its location still set
+ */
+void game_occupant_remove(Game *game, Enemy *e)
+{
+  Enemy_vector **list = NULL;
+  int i;
+
+  list = Occupant_map_get(&game->occupants, enemy_get_location(e));
+  if (!list)
+  {
+    return;
+  }
+
+  for (i = 0; i < (*list)->size; i++)
+  {
+    if ((*list)->data[i] == e)
+    {
+      Enemy_vector_remove(*list, i);
+      return;
+    }
+  }
+}
+
+/**
+ * @brief Moves a live enemy, keeping the occupants of the spaces
+ * @author Miguel Soto
+ *
+ * Every change of location of an enemy of the game goes through here.
+ *
+ * @param game pointer to the game
+ * @param e the enemy
+ * @param location its new space, or NO_ID to take it out of the map
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS game_move_enemy(Game *game, Enemy *e, Id location)
+{
+  game_occupant_remove(game, e);
+  if (enemy_set_location(e, location) == ERROR)
+  {
+    return ERROR;
+  }
+
+  return game_occupant_add(game, e);
+}
+
+/** game_is_boss_dead checks if the boss was killed (and maybe despawned)
+ */
+BOOL game_is_boss_dead(Game *game)
+{
+  Enemy *boss = NULL;
+
+  /* Error control */
+  if (!game)
+  {
+    return FALSE;
+  }
+
+  boss = game_get_enemy(game, GAME_BOSS);
+  if (!boss || enemy_get_health(boss) <= 0)
+  {
+    return TRUE;
+  }
+
+  return FALSE;
 }
 
 BOOL update_game_over(Game *game)
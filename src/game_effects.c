@@ -0,0 +1,301 @@
+/**
+ * @brief It implements the effects of the objects
+ *
+ * @file game_effects.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "../include/game_effects.h"
+
+/**
+ * @brief Handler of an effect
+ */
+typedef STATUS (*Effect_handler)(Game *game, Player *player, Object *obj, Obj_type type);
+
+/**
+ * @brief Effect of an object type
+ */
+typedef struct
+{
+  const char *name;     /*!< Name used in the map file */
+  Effect_handler use;   /*!< What using the object does (NULL if it can't be used) */
+  Effect_handler take;  /*!< What taking the object does (NULL if nothing special) */
+  BOOL in_space;        /*!< If TRUE it is used where it is instead of from the inventory */
+} Effect;
+
+/**
+ * Private functions
+ */
+void game_effects_consume(Game *game, Player *player, Object *obj);
+STATUS game_effects_use_heal(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_use_max_health(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_use_hook(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_use_day_night(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_use_feed(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_take_health(Game *game, Player *player, Object *obj, Obj_type type);
+STATUS game_effects_take_damage(Game *game, Player *player, Object *obj, Obj_type type);
+
+/**
+ * @brief Table of effects, #t: lines refer to them by name
+ */
+static const Effect effects[] =
+{
+  {"none", NULL, NULL, FALSE},
+  {"heal", game_effects_use_heal, NULL, FALSE},
+  {"max_health", game_effects_use_max_health, NULL, FALSE},
+  {"hook", game_effects_use_hook, NULL, FALSE},
+  {"day_night", game_effects_use_day_night, NULL, TRUE},
+  {"feed", game_effects_use_feed, NULL, FALSE},
+  {"take_health", NULL, game_effects_take_health, FALSE},
+  {"take_damage", NULL, game_effects_take_damage, FALSE}
+};
+
+#define N_EFFECTS ((int)(sizeof(effects) / sizeof(effects[0]))) /*!< Number of effects of the table */
+
+/**
+ * game_effects_find finds an effect by its name
+ */
+int game_effects_find(const char *name)
+{
+  int i;
+
+  /* Error control */
+  if (!name)
+  {
+    return -1;
+  }
+
+  for (i = 0; i < N_EFFECTS; i++)
+  {
+    if (strcmp(effects[i].name, name) == 0)
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/**
+ * It gets the name of an effect
+ */
+const char *game_effects_get_name(int effect)
+{
+  /* Error control */
+  if (effect < 0 || effect >= N_EFFECTS)
+  {
+    return NULL;
+  }
+
+  return effects[effect].name;
+}
+
+/**
+ * game_effects_use uses an object
+ */
+STATUS game_effects_use(Game *game, Player *player, Object *obj)
+{
+  Obj_type type = UNKNOWN_TYPE;
+  const Effect *effect = NULL;
+
+  /* Error control */
+  if (!game || !player || !obj)
+  {
+    return ERROR;
+  }
+
+  type = obj_get_type(obj);
+  effect = &effects[obj_type_get_effect(game_get_types(game), type)];
+  if (!effect->use)
+  {
+    return ERROR;
+  }
+
+  if (effect->in_space == TRUE)
+  {
+    if (space_has_object(game_get_space(game, player_get_location(player)), obj_get_id(obj)) == FALSE)
+    {
+      return ERROR;
+    }
+  }
+  else if (player_has_object(player, obj_get_id(obj)) == FALSE)
+  {
+    return ERROR;
+  }
+
+  return effect->use(game, player, obj, type);
+}
+
+/**
+ * game_effects_take applies the effect of taking an object
+ */
+BOOL game_effects_take(Game *game, Player *player, Object *obj)
+{
+  Obj_type type = UNKNOWN_TYPE;
+  const Effect *effect = NULL;
+
+  /* Error control */
+  if (!game || !player || !obj)
+  {
+    return FALSE;
+  }
+
+  type = obj_get_type(obj);
+  effect = &effects[obj_type_get_effect(game_get_types(game), type)];
+  if (!effect->take)
+  {
+    return FALSE;
+  }
+
+  return effect->take(game, player, obj, type) == OK ? TRUE : FALSE;
+}
+
+/**
+ * It prints the registry of object types in the save file
+ */
+STATUS game_effects_print_save(Obj_types *types, char *filename)
+{
+  FILE *file = NULL;
+  int i;
+
+  file = fopen(filename, "a");
+  /* Error control */
+  if (!file)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < MAX_OBJ_TYPES; i++)
+  {
+    if (obj_type_get_name(types, i))
+    {
+      fprintf(file, "#t:%d|%s|%ld|%ld|%s|%d|%d|\n", i, obj_type_get_name(types, i), obj_type_get_first(types, i), obj_type_get_last(types, i),
+              game_effects_get_name(obj_type_get_effect(types, i)), obj_type_get_param(types, i, 1), obj_type_get_param(types, i, 2));
+    }
+  }
+
+  fclose(file);
+  return OK;
+}
+
+/**
+ * @brief Takes an used object out of the game
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param player the player that carried the object
+ * @param obj the object
+ */
+void game_effects_consume(Game *game, Player *player, Object *obj)
+{
+  inventory_remove_object(player_get_inventory(player), obj_get_id(obj));
+  obj_set_location(obj, NO_ID);
+}
+
+/**
+ * @brief Use effect "heal": recovers param1 health
+ * @author Miguel Soto
+ */
+STATUS game_effects_use_heal(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  game_effects_consume(game, player, obj);
+  player_set_health(player, player_get_health(player) + obj_type_get_param(game_get_types(game), type, 1));
+  dialogue_set_command(game_get_dialogue(game), DC_USE_APPLE, NULL, NULL, NULL);
+
+  return OK;
+}
+
+/**
+ * @brief Use effect "max_health": gives param1 max health
+ * @author Miguel Soto
+ */
+STATUS game_effects_use_max_health(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  game_effects_consume(game, player, obj);
+  player_set_max_health(player, player_get_max_health(player) + obj_type_get_param(game_get_types(game), type, 1));
+  dialogue_set_command(game_get_dialogue(game), DC_USE_ARMOR, NULL, NULL, NULL);
+
+  return OK;
+}
+
+/**
+ * @brief Use effect "hook": in space param1, it grabs object param2
+ * @author Miguel Soto
+ */
+STATUS game_effects_use_hook(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  Object *grabbed = game_get_object(game, obj_type_get_param(game_get_types(game), type, 2));
+
+  if (player_get_location(player) != obj_type_get_param(game_get_types(game), type, 1) || !grabbed)
+  {
+    return ERROR;
+  }
+
+  game_effects_consume(game, player, obj);
+  obj_set_location(grabbed, NO_ID);
+  inventory_add_object(player_get_inventory(player), grabbed);
+  dialogue_set_command(game_get_dialogue(game), DC_USE_HOOK, NULL, NULL, NULL);
+
+  return OK;
+}
+
+/**
+ * @brief Use effect "day_night": it changes the time of the day
+ * @author Miguel Soto
+ */
+STATUS game_effects_use_day_night(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  STATUS st = OK;
+
+  st = game_set_time(game, game_get_time(game) == DAY ? NIGHT : DAY);
+  dialogue_set_command(game_get_dialogue(game), DC_USE_BED, NULL, NULL, NULL);
+
+  return st;
+}
+
+/**
+ * @brief Use effect "feed": it is given to the one in space param1
+ * @author Miguel Soto
+ */
+STATUS game_effects_use_feed(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  if (player_get_location(player) != obj_type_get_param(game_get_types(game), type, 1))
+  {
+    return ERROR;
+  }
+
+  dialogue_set_command(game_get_dialogue(game), DC_BREAD, NULL, NULL, NULL);
+  inventory_remove_object(player_get_inventory(player), obj_get_id(obj));
+
+  return OK;
+}
+
+/**
+ * @brief Take effect "take_health": gives param1 max health and health
+ * @author Miguel Soto
+ */
+STATUS game_effects_take_health(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  dialogue_set_command(game_get_dialogue(game), DC_TAKE_M, NULL, NULL, NULL);
+  player_set_max_health(player, player_get_max_health(player) + obj_type_get_param(game_get_types(game), type, 1));
+  player_set_health(player, player_get_health(player) + obj_type_get_param(game_get_types(game), type, 1));
+
+  return OK;
+}
+
+/**
+ * @brief Take effect "take_damage": gives param1 base damage
+ * @author Miguel Soto
+ */
+STATUS game_effects_take_damage(Game *game, Player *player, Object *obj, Obj_type type)
+{
+  dialogue_set_command(game_get_dialogue(game), DC_TAKE_S, NULL, NULL, NULL);
+  player_set_baseDmg(player, player_get_baseDmg(player) + obj_type_get_param(game_get_types(game), type, 1));
+
+  return OK;
+}
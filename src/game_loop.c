@@ -8,17 +8,33 @@
  * @copyright GNU Public License
  */
 
+#define _POSIX_C_SOURCE 200112L /*!< For gettimeofday with -ansi */
+
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <time.h>
+#include <sys/time.h>
+#include <ctype.h>
 #include "../include/graphic_engine.h"
 #include "../include/game.h"
 #include "../include/command.h"
 #include "../include/game_managment.h"
 
-int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name);
-void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name);
+#ifdef EMBEDDED_MAP
+#define FIRST_ARG 1 /*!< The map is compiled into the binary, options start at argv[1] */
+#define MAP_ARG NULL /*!< No map file is needed */
+#else
+#define FIRST_ARG 2 /*!< Options start after the map file */
+#define MAP_ARG argv[1] /*!< Map file given in the command line */
+#endif
+
+#define PAINT_ALWAYS -1 /*!< Every turn is painted (no fast-forward) */
+#define REPLAY_ST 3     /*!< Statuses counted for each command: ERROR, OK and none */
+
+int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name, BOOL headless);
+void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name, int every);
+void game_loop_summary(long count[N_CMD][REPLAY_ST], long turns, double seconds);
 void game_loop_cleanup(Game *game, Graphic_engine *gengine);
 void print_syntaxinfo(char *argv[]);
 
@@ -37,6 +53,12 @@ int main(int argc, char *argv[])
   Graphic_engine *gengine;
   /* Used to able to save commands in log */
   char *wlog_name = NULL, *cmdf_name = NULL;
+  char *spectate = NULL; /* Socket the frames are sent to */
+  char *record = NULL; /* File the frames are recorded in */
+  BOOL headless = FALSE; /* Nothing is painted */
+  BOOL threaded = FALSE; /* Painted by a render thread */
+  BOOL stats = FALSE; /* Memory of the world reported at the end */
+  int every = PAINT_ALWAYS; /* Turns between paints when fast-forwarding */
   int i; /* Used in loops */
 
   /*Necessary for random features*/
@@ -51,58 +73,82 @@ int main(int argc, char *argv[])
   }
 
   /* Check arguments in execution command */
-  if (argc < 2) /* Incorrect syntax */
+  if (argc < FIRST_ARG) /* Incorrect syntax */
   {
     print_syntaxinfo(argv);
     return 1;
   }
-  else if (argc == 2)
+
+  /* Options of the execution command */
+  for (i = FIRST_ARG; i < argc; i++)
   {
-    /*Loads game and waits for player interaction*/
-    if (!game_loop_init(game, &gengine, argv[1]))
+    printf("argv[%d] = %s\n", i, argv[i]);
+    if (strcmp(argv[i], "--headless") == 0)
     {
-      game_loop_run(game, gengine, NULL, NULL);
-      game_loop_cleanup(game, gengine);
+      headless = TRUE;
     }
-  }
-  else if (argc > 2)
-  {
-    /*Loads game from a file*/
-    wlog_name = NULL;
-    cmdf_name = NULL;
-    if (argc == 3)
+    else if (strcmp(argv[i], "--render-thread") == 0)
+    {
+      threaded = TRUE;
+    }
+    else if (strcmp(argv[i], "--stats") == 0)
+    {
+      stats = TRUE;
+    }
+    else if (strcmp(argv[i], "--fast-forward") == 0 && i + 1 < argc && isdigit((unsigned char)argv[i + 1][0]))
+    {
+      i++;
+      every = atoi(argv[i]);
+    }
+    else if (strcmp(argv[i], "--spectate") == 0 && i + 1 < argc)
+    {
+      i++;
+      spectate = argv[i];
+    }
+    else if (strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+    {
+      i++;
+      record = argv[i];
+    }
+    else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc)
+    {
+      i++;
+      wlog_name = argv[i];
+    }
+    else if (strcmp(argv[i], "<") == 0 && i + 1 < argc)
     {
-      fprintf(stderr, "\nWrong syntax. Argument %s unidentified.\n", argv[2]);
+      i++;
+      cmdf_name = argv[i];
+    }
+    else
+    {
+      fprintf(stderr, "\nWrong syntax. Argument %s unidentified.\n", argv[i]);
       print_syntaxinfo(argv);
       return 1;
     }
-    
-    for (i = 2; i < (argc - 1); i++)
+  }
+
+  /*Loads game and runs it, from the player or from a file*/
+  if (!game_loop_init(game, &gengine, MAP_ARG, headless))
+  {
+    if (spectate && !headless && graphic_engine_start_stream(gengine, spectate) == ERROR)
     {
-      printf("argv[%d] = %s\n", i, argv[i]);
-      if (strcmp(argv[i], "-l\0") == 0)
-      {
-        i++;
-        wlog_name = argv[(i)];
-      }
-      else if (strcmp(argv[i], "<\0") == 0)
-      {
-        i++;
-        cmdf_name = argv[i];
-      }
-      else
-      {
-        fprintf(stderr, "\nWrong syntax. Argument %s unidentified.\n", argv[i]);
-        print_syntaxinfo(argv);
-        return 1;
-      }
+      fprintf(stderr, "Socket %s not opened, nobody can spectate.\n", spectate);
     }
-
-    if (!game_loop_init(game, &gengine, argv[1]))
+    if (record && !headless && graphic_engine_start_record(gengine, record) == ERROR)
+    {
+      fprintf(stderr, "Record %s not created, the session is not recorded.\n", record);
+    }
+    if (threaded && !headless && graphic_engine_start_thread(gengine) == ERROR)
     {
-      game_loop_run(game, gengine, wlog_name, cmdf_name);
-      game_loop_cleanup(game, gengine);
+      fprintf(stderr, "Render thread not started, painting in the game loop.\n");
     }
+    game_loop_run(game, gengine, wlog_name, cmdf_name, every);
+    if (stats)
+    {
+      arena_print(stderr, game_get_arena(game));
+    }
+    game_loop_cleanup(game, gengine);
   }
 
   return 0;
@@ -114,20 +160,26 @@ int main(int argc, char *argv[])
  *
  * @param game Pointer to the game type struct that contains the information of the enemies, player, object, links spaces and the last command 
  * @param gengine doble pointer to access the graphic engine
- * @param file_name is a pointer to the name of the file from which the game is initialized
+ * @param file_name is a pointer to the name of the file from which the game is initialized (ignored in embedded builds)
+ * @param headless TRUE to create a graphic engine that paints nothing (batch runs)
  * @return 0 if the game initializes correctly 1 if there has been an error
  */
-int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name)
+int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name, BOOL headless)
 {
   /*Error control(Creates game)*/
+#ifdef EMBEDDED_MAP
+  if (game_create_from_map(game, &embedded_map) == ERROR)
+#else
   if (game_create_from_file(game, file_name) == ERROR)
+#endif
   {
     fprintf(stderr, "Error while initializing game.\n");
     return 1;
   }
 
   /*Error control(Creates graphic engine)*/
-  if ((*gengine = graphic_engine_create()) == NULL)
+  *gengine = headless ? graphic_engine_create_headless() : graphic_engine_create();
+  if (*gengine == NULL)
   {
     fprintf(stderr, "Error while initializing graphic engine.\n");
     game_destroy(game);
@@ -146,12 +198,16 @@ int game_loop_init(Game *game, Graphic_engine **gengine, char *file_name)
  * @param gengine pointer to the graphi engine
  * @param flog_name string name from file where to write every command executed. It has to be NULL if a log file is not wanted.
  * @param fcmd_name string name from file where to get every command to be executed. It has to be NULL if a command file is not used.
+ * @param every PAINT_ALWAYS to paint before each command; otherwise the commands are fast-forwarded: one turn
+ * in every is painted (none if it is 0), the final state is painted at the end and a summary is written
  */
-void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name)
+void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *fcmd_name, int every)
 {
   T_Command command = NO_CMD;
   char arg1[MAX_ARG], arg2[MAX_ARG], input[MAX_ARG];
   int st = 5, wlog = 0, rcmd = 0;
+  long turns = 0, count[N_CMD][REPLAY_ST];
+  struct timeval start, end;
   FILE *flog = NULL, *fcmd = NULL;
   T_Command last_cmd;
   extern char *cmd_to_str[N_CMD][N_CMDT];
@@ -182,9 +238,16 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
     }
   }
 
+  memset(count, 0, sizeof(count));
+  gettimeofday(&start, NULL);
+
   for (; (command != EXIT) /*&& !game_is_over(game)*/;)
   {
-    graphic_engine_paint_game(gengine, game, st);
+    /* When fast-forwarding, only one turn in every is painted */
+    if (every == PAINT_ALWAYS || (every > 0 && turns % every == 0))
+    {
+      graphic_engine_paint_game(gengine, game, st);
+    }
 
     if (rcmd == 1)
     {
@@ -204,11 +267,21 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
     }
 
     st = game_update(game, command, arg1, arg2);
+    if (command == SCROLL)
+    {
+      /* The game lets it be, the lists are kept by the engine */
+      st = graphic_engine_scroll(gengine, arg1) == OK ? 1 : 0;
+    }
+    turns++;
+    last_cmd = game_get_last_command(game);
+    if (last_cmd >= NO_CMD && last_cmd - NO_CMD < N_CMD)
+    {
+      count[last_cmd - NO_CMD][(st == 0 || st == 1) ? st : 2]++;
+    }
 
     /*Cheks if the game is working in "log-mode" and if true it prints the commands in the output file*/
     if (wlog == 1)
     {
-      last_cmd = game_get_last_command(game);
       if (st == 0)
       {
         if ( last_cmd == 1 || last_cmd == 2 || last_cmd == 3 || last_cmd == 4 || last_cmd == 5 ) {
@@ -232,8 +305,23 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
     }
   }
 
+  /* The final state of a fast-forward */
+  if (every != PAINT_ALWAYS)
+  {
+    graphic_engine_paint_game(gengine, game, st);
+  }
+
+  /* The last frame is on the terminal before anything else is written */
+  graphic_engine_stop_thread(gengine);
   fprintf(stdout, "\n");
 
+  if (every != PAINT_ALWAYS)
+  {
+    /* Wall-clock time, painting and waiting for the terminal included */
+    gettimeofday(&end, NULL);
+    game_loop_summary(count, turns, (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6);
+  }
+
   /*Closes flog (output of "log-mode")*/
   if (flog)
   {
@@ -252,6 +340,37 @@ void game_loop_run(Game *game, Graphic_engine *gengine, char *flog_name, char *f
 }
 
 
+/**
+ * @brief Writes the summary of a fast-forward
+ * @author Miguel Soto
+ *
+ * @param count times each command ended with ERROR, OK or no status
+ * @param turns commands run
+ * @param seconds time taken (wall-clock time)
+ */
+void game_loop_summary(long count[N_CMD][REPLAY_ST], long turns, double seconds)
+{
+  extern char *cmd_to_str[N_CMD][N_CMDT];
+  int i;
+
+  if (seconds > 0)
+  {
+    fprintf(stdout, "Fast-forward: %ld commands in %.3f s (%.0f commands/s)\n", turns, seconds, turns / seconds);
+  }
+  else
+  {
+    fprintf(stdout, "Fast-forward: %ld commands in %.3f s\n", turns, seconds);
+  }
+
+  for (i = 0; i < N_CMD; i++)
+  {
+    if (count[i][0] + count[i][1] + count[i][2] > 0)
+    {
+      fprintf(stdout, "  %-10s (%s): %ld OK, %ld ERROR, %ld other\n", cmd_to_str[i][CMDL], cmd_to_str[i][CMDS], count[i][1], count[i][0], count[i][2]);
+    }
+  }
+}
+
 /**
  * @brief Ends and cleans the game
  * @author Profesores PPROG
@@ -274,9 +393,20 @@ void game_loop_cleanup(Game *game, Graphic_engine *gengine)
  */
 void print_syntaxinfo(char *argv[])
 {
+#ifdef EMBEDDED_MAP
+  fprintf(stderr, "\nUse: %s (the map is compiled into the program).\n", argv[0]);
+  fprintf(stderr, "\tGlobal syntax: %s [-l <log_file>] [< <command_file>] [--headless] [--render-thread] [--fast-forward <n>] [--spectate <socket>] [--record <file>] [--stats]\n", argv[0]);
+#else
   fprintf(stderr, "\nUse: %s <game_data_file>.\n", argv[0]);
   fprintf(stderr, "If you want to save inserted commands use the flag \"-l\" with the file name\n");
-  fprintf(stderr, "Also, if you want to execute commands from a file use \"<\" with the file name\n \n");
-  fprintf(stderr, "\tGlobal syntax: %s <game_data_file> [-l <log_file>] [< <command_file>]\n", argv[0]);
+  fprintf(stderr, "Also, if you want to execute commands from a file use \"<\" with the file name\n");
+  fprintf(stderr, "With \"--headless\" nothing is painted, only the dialogue is written (batch runs)\n");
+  fprintf(stderr, "With \"--render-thread\" the game is painted by a thread of its own, the game never waits for the terminal\n");
+  fprintf(stderr, "With \"--fast-forward <n>\" one turn in n is painted (0: only the final one) and a summary is written\n");
+  fprintf(stderr, "With \"--spectate <socket>\" every frame painted is sent to the viewers of a Unix socket (nc -U <socket>)\n");
+  fprintf(stderr, "With \"--record <file>\" every frame painted is recorded in a file, played with record_player\n");
+  fprintf(stderr, "With \"--stats\" the memory used by the world is written to stderr when the game ends\n \n");
+  fprintf(stderr, "\tGlobal syntax: %s <game_data_file> [-l <log_file>] [< <command_file>] [--headless] [--render-thread] [--fast-forward <n>] [--spectate <socket>] [--record <file>] [--stats]\n", argv[0]);
+#endif
   fprintf(stderr, "\tArguments between [ ] are optional.\n \n");
 }
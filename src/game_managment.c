@@ -11,8 +11,8 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <math.h>
 #include "../include/game_managment.h"
+#include "../include/game_effects.h"
 /*
 STATUS game_add_space(Game *game, Space *space);
 STATUS game_add_object(Game *game, Object *obj);
@@ -27,17 +27,23 @@ STATUS game_set_enemy_location(Game *game, Id enemy_id, Id space_id);
 /**
  * Funciones privadas
  */
+STATUS game_load_types(Obj_types *types, char *filename);
 STATUS game_load_spaces(Game *game, char *filename);
 STATUS game_load_objs(Game *game, char *filename);
 STATUS game_load_players(Game *game, char *filename);
 STATUS game_load_enemy(Game *game, char *filename);
 STATUS game_load_link(Game *game, char *filename);
 STATUS game_load_inventory(Game *game, char *filename);
+STATUS game_load_map_types(Obj_types *types, const Map_data *map);
+STATUS game_load_map_spaces(Game *game, const Map_data *map);
+STATUS game_load_map_objs(Game *game, const Map_data *map);
+STATUS game_load_map_players(Game *game, const Map_data *map);
+STATUS game_load_map_enemies(Game *game, const Map_data *map);
+STATUS game_load_map_links(Game *game, const Map_data *map);
+STATUS game_load_map_inventory(Game *game, const Map_data *map);
 STATUS game_managment_save(char *filename, Game* game);
 STATUS game_managment_load(char *filename, Game *game);
 
-GAME_IS_ELEMENT id_type(Id id);
-
 /**
   Game_reader implementacion
 */
@@ -53,6 +59,12 @@ STATUS game_create_from_file(Game *game, char *filename)
     return ERROR;
   }
 
+  /* Types go first, objects are classified with them */
+  if (game_load_types(game_get_types(game), filename) == ERROR)
+  {
+    return ERROR;
+  }
+
   if (game_load_spaces(game, filename) == ERROR)
   {
     return ERROR;
@@ -89,6 +101,37 @@ STATUS game_create_from_file(Game *game, char *filename)
   return OK;
 }
 
+/** game_create_from_map initializes all of game's members
+ * from a map precompiled by map_compiler
+ */
+STATUS game_create_from_map(Game *game, const Map_data *map)
+{
+  /* Error control */
+  if (!game || !map)
+  {
+    return ERROR;
+  }
+
+  if (game_create(game) == ERROR)
+  {
+    return ERROR;
+  }
+
+  /* Same order as game_create_from_file, objects and links need the spaces */
+  if (game_load_map_types(game_get_types(game), map) == ERROR ||
+      game_load_map_spaces(game, map) == ERROR ||
+      game_load_map_objs(game, map) == ERROR ||
+      game_load_map_players(game, map) == ERROR ||
+      game_load_map_enemies(game, map) == ERROR ||
+      game_load_map_links(game, map) == ERROR ||
+      game_load_map_inventory(game, map) == ERROR)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
+
 STATUS game_managment_save(char *filename, Game* game)
 {
   STATUS st = OK;
@@ -106,6 +149,74 @@ STATUS game_managment_load(char *filename, Game *game)
   return st;
 }
 
+/**
+ * @brief Loads the registry of object types
+ * @author Miguel Soto
+ *
+ * @param types the registry of the game
+ * @param filename pointer to the file's name
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_types(Obj_types *types, char *filename)
+{
+  FILE *file = NULL;
+  char line[WORD_SIZE] = "";
+  char name[WORD_SIZE] = "";
+  char *toks = NULL;
+  Obj_type type = UNKNOWN_TYPE;
+  Id first = NO_ID, last = NO_ID;
+  int effect = 0, param1 = 0, param2 = 0;
+  STATUS status = OK;
+
+  if (!filename)
+  {
+    return ERROR;
+  }
+
+  file = fopen(filename, "r");
+  /*Error control*/
+  if (file == NULL)
+  {
+    return ERROR;
+  }
+
+  while (fgets(line, WORD_SIZE, file))
+  {
+    if (strncmp("#t:", line, 3) == 0)
+    {
+      toks = strtok(line + 3, "|");
+      type = atoi(toks);
+      toks = strtok(NULL, "|");
+      strcpy(name, toks);
+      toks = strtok(NULL, "|");
+      first = atol(toks);
+      toks = strtok(NULL, "|");
+      last = atol(toks);
+      toks = strtok(NULL, "|");
+      effect = game_effects_find(toks);
+      toks = strtok(NULL, "|");
+      param1 = atoi(toks);
+      toks = strtok(NULL, "|");
+      param2 = atoi(toks);
+
+      /*Error control, an unknown effect is a mistake in the map*/
+      if (obj_type_add(types, type, name, first, last, effect, param1, param2) == ERROR)
+      {
+        status = ERROR;
+      }
+    }
+  }
+
+  if (ferror(file))
+  {
+    status = ERROR;
+  }
+
+  fclose(file);
+
+  return status;
+}
+
 /**
  * @brief Loads the spaces of the game
  * @author Modified by Nicolas Victorino
@@ -189,18 +300,20 @@ STATUS game_load_spaces(Game *game, char *filename)
 #ifdef DEBUG
       // printf("Leido: %ld|%s|%s\n", id, name, description);
 #endif
-      space = space_create(id);
+      space = space_create_in(id, game_get_arena(game));
       if (space != NULL)
       {
-        space_set_name(space, name);
-        space_set_brief_description(space, brief_description);
-        space_set_long_description(space, long_description);
-        space_set_gdesc(space, gdesc);
+        space_set_name(space, game_get_strpool(game), name);
+        space_set_brief_description(space, game_get_strpool(game), brief_description);
+        space_set_long_description(space, game_get_strpool(game), long_description);
+        space_set_gdesc(space, game_get_atlas(game), gdesc);
         space_set_light_status(space, ls);
         space_set_floor(space, floor);
         space_set_fire(space, fire);
         game_add_space(game, space);
       }
+      /* The drawing was copied into the atlas */
+      space_destroy_gdesc(gdesc);
     }
   }
 
@@ -283,11 +396,12 @@ STATUS game_load_objs(Game *game, char *filename)
 #ifdef DEBUG
       // printf("Leido: %ld|%s|%ld|%ld|%ld|%ld\n", id, name, north, east, south, west);
 #endif
-      obj = obj_create(id);
+      obj = obj_create_in(id, game_get_arena(game));
       if (obj != NULL)
       {
         obj_set_name(obj, name);
-        obj_set_description(obj, description);
+        obj_set_description(obj, game_get_strpool(game), description);
+        obj_set_type(obj, obj_type_of(game_get_types(game), id));
         obj_set_location(obj, pos);
         object_set_movable(obj, movable);
         object_set_dependency(obj, dependency);
@@ -404,7 +518,7 @@ STATUS game_load_players(Game *game, char *filename)
 #endif
 
       /*Defines a private variable called "player" and saves a pointer to player with the given id in it*/
-      player = player_create(id);
+      player = player_create_in(id, game_get_arena(game));
 
       /*Error control, and in case everything is fine, it saves the
         information gotten in the prior loop in the newly created player*/
@@ -416,9 +530,11 @@ STATUS game_load_players(Game *game, char *filename)
         player_set_health(player, health);
         player_set_crit(player, crit);
         player_set_baseDmg(player, base_dmg);
-        player_set_gdesc(player, gdesc);
+        player_set_gdesc(player, game_get_atlas(game), gdesc);
         game_add_player(game, player);
       }
+      /* The drawing was copied into the atlas */
+      player_destroy_gdesc(gdesc);
     }
   }
 
@@ -516,7 +632,7 @@ STATUS game_load_enemy(Game *game, char *filename)
 
       /*Defines a private variable called "enemy" and saves
       a pointer to enemy with the given id in it*/
-      enemy = enemy_create(id);
+      enemy = enemy_create_in(id, game_get_arena(game));
 
       /*Error control, and in case everything is fine, it saves
       the information gotten in the prior loop in the newly created enemy*/
@@ -527,9 +643,11 @@ STATUS game_load_enemy(Game *game, char *filename)
         enemy_set_health(enemy, health);
         enemy_set_crit(enemy, crit);
         enemy_set_baseDmg(enemy, base_dmg);
-        enemy_set_gdesc(enemy, gdesc);
+        enemy_set_gdesc(enemy, game_get_atlas(game), gdesc);
         game_add_enemy(game, enemy);
       }
+      /* The drawing was copied into the atlas */
+      enemy_destroy_gdesc(gdesc);
     }
   }
 
@@ -651,7 +769,7 @@ STATUS game_load_link(Game *game, char *filename)
 
       /*Defines a private variable called "link" and saves a
       pointer to player with the given id in it*/
-      link = link_create(id);
+      link = link_create_in(id, game_get_arena(game));
 
       /*Error control, and in case everything is fine, it saves
       the information gotten in the prior loop in the newly created link*/
@@ -725,7 +843,7 @@ STATUS game_load_inventory(Game *game, char *filename)
 
       /*Adds the object to the given player*/
       obj_set_location(game_get_object(game, id), player_get_location(game_get_player(game, id_player)));
-      inventory_add_object(player_get_inventory(game_get_player(game, id_player)), id);
+      inventory_add_object(player_get_inventory(game_get_player(game, id_player)), game_get_object(game, id));
     }
   }
 
@@ -744,45 +862,256 @@ STATUS game_load_inventory(Game *game, char *filename)
 }
 
 /**
- * @brief It indicates which element of the game has the target id
+ * @brief Loads the spaces of a precompiled map
  * @author Miguel Soto
  *
- * @param id target id 
- * @return game elements with the target id
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
  */
-GAME_IS_ELEMENT id_type(Id id)
+STATUS game_load_map_spaces(Game *game, const Map_data *map)
 {
-  int first_digit, digits;
+  const Map_space *row = NULL;
+  Space *space = NULL;
+  int i;
 
-  /*Error control*/
-  if (id < 0)
+  for (i = 0; i < map->n_spaces; i++)
+  {
+    row = &map->spaces[i];
+
+    space = space_create_in(row->id, game_get_arena(game));
+    /* Error control */
+    if (space == NULL)
+    {
+      return ERROR;
+    }
+
+    /* The texts are literals of the program, they are not copied */
+    space_borrow_texts(space, row->name, row->brief_description, row->long_description);
+    space_set_gdesc(space, game_get_atlas(game), (char **)row->gdesc);
+    space_set_light_status(space, row->ls);
+    space_set_floor(space, row->floor);
+    space_set_fire(space, row->fire);
+    game_add_space(game, space);
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Loads the object types of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param types the registry of the game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_types(Obj_types *types, const Map_data *map)
+{
+  const Map_type *row = NULL;
+  int i;
+
+  for (i = 0; i < map->n_types; i++)
   {
-    return '\0';
+    row = &map->types[i];
+
+    /* Error control */
+    if (obj_type_add(types, row->type, row->name, row->first, row->last, game_effects_find(row->effect), row->param1, row->param2) == ERROR)
+    {
+      return ERROR;
+    }
   }
 
-  digits = (int)log10(id);
+  return OK;
+}
 
-  first_digit = (int)(id / pow(10, digits));
+/**
+ * @brief Loads the objects of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_objs(Game *game, const Map_data *map)
+{
+  const Map_object *row = NULL;
+  Object *obj = NULL;
+  int i;
 
-  if (first_digit == FD_ID_SPACE)
+  for (i = 0; i < map->n_objects; i++)
   {
-    return IS_SPACE;
+    row = &map->objects[i];
+
+    obj = obj_create_in(row->id, game_get_arena(game));
+    /* Error control */
+    if (obj == NULL)
+    {
+      return ERROR;
+    }
+
+    obj_set_name(obj, (char *)row->name);
+    obj_borrow_description(obj, row->description);
+    obj_set_type(obj, obj_type_of(game_get_types(game), row->id));
+    obj_set_location(obj, row->location);
+    object_set_movable(obj, row->movable);
+    object_set_dependency(obj, row->dependency);
+    object_set_open(obj, row->open);
+    object_set_illuminate(obj, row->illuminate);
+    object_set_turnedon(obj, row->turnedon);
+    object_set_light_visible(obj, row->light_visible);
+    object_set_crit(obj, row->crit);
+    object_set_durability(obj, row->durability);
+
+    /* Error control */
+    if (row->location != -1)
+    {
+      if (space_add_objectid(game_get_space(game, row->location), row->id) == ERROR)
+      {
+        obj_destroy(obj);
+        return ERROR;
+      }
+    }
+    game_add_object(game, obj);
   }
-  else if (first_digit == FD_ID_PLAYER)
+
+  return OK;
+}
+
+/**
+ * @brief Loads the players of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_players(Game *game, const Map_data *map)
+{
+  const Map_player *row = NULL;
+  Player *player = NULL;
+  int i;
+
+  for (i = 0; i < map->n_players; i++)
   {
-    return IS_PLAYER;
+    row = &map->players[i];
+
+    player = player_create_in(row->id, game_get_arena(game));
+    /* Error control */
+    if (player == NULL)
+    {
+      return ERROR;
+    }
+
+    player_set_name(player, (char *)row->name);
+    player_set_max_inventory(player, row->max_objs);
+    player_set_location(player, row->location);
+    player_set_health(player, row->health);
+    player_set_crit(player, row->crit);
+    player_set_baseDmg(player, row->base_dmg);
+    player_set_gdesc(player, game_get_atlas(game), (char **)row->gdesc);
+    game_add_player(game, player);
   }
-  else if (first_digit == FD_ID_OBJ)
+
+  return OK;
+}
+
+/**
+ * @brief Loads the enemies of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_enemies(Game *game, const Map_data *map)
+{
+  const Map_enemy *row = NULL;
+  Enemy *enemy = NULL;
+  int i;
+
+  for (i = 0; i < map->n_enemies; i++)
   {
-    return IS_OBJECT;
+    row = &map->enemies[i];
+
+    enemy = enemy_create_in(row->id, game_get_arena(game));
+    /* Error control */
+    if (enemy == NULL)
+    {
+      return ERROR;
+    }
+
+    enemy_set_name(enemy, (char *)row->name);
+    enemy_set_location(enemy, row->location);
+    enemy_set_health(enemy, row->health);
+    enemy_set_crit(enemy, row->crit);
+    enemy_set_baseDmg(enemy, row->base_dmg);
+    enemy_set_gdesc(enemy, game_get_atlas(game), (char **)row->gdesc);
+    game_add_enemy(game, enemy);
   }
-  else if (first_digit == FD_ID_ENEMY)
+
+  return OK;
+}
+
+/**
+ * @brief Loads the links of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_links(Game *game, const Map_data *map)
+{
+  const Map_link *row = NULL;
+  Link *link = NULL;
+  int i;
+
+  for (i = 0; i < map->n_links; i++)
   {
-    return IS_ENEMY;
+    row = &map->links[i];
+
+    link = link_create_in(row->id, game_get_arena(game));
+    /* Error control */
+    if (link == NULL)
+    {
+      return ERROR;
+    }
+
+    link_set_name(link, (char *)row->name);
+    link_set_start(link, row->start);
+    link_set_destination(link, row->destination);
+    link_set_direction(link, row->direction);
+    link_set_status(link, row->status);
+    space_set_link(game_get_space(game, row->start), row->id, row->direction);
+    game_add_link(game, link);
   }
-  /*Error control*/
-  else
+
+  return OK;
+}
+
+/**
+ * @brief Loads the initial inventory of a precompiled map
+ * @author Miguel Soto
+ *
+ * @param game pointer to game
+ * @param map pointer to the precompiled map
+ * @return OK if everything goes right or ERROR if something goes wrong
+ */
+STATUS game_load_map_inventory(Game *game, const Map_data *map)
+{
+  const Map_inventory *row = NULL;
+  Player *player = NULL;
+  int i;
+
+  for (i = 0; i < map->n_inventory; i++)
   {
-    return '\0';
+    row = &map->inventory[i];
+
+    player = game_get_player(game, row->player);
+    obj_set_location(game_get_object(game, row->object), player_get_location(player));
+    inventory_add_object(player_get_inventory(player), game_get_object(game, row->object));
   }
+
+  return OK;
 }
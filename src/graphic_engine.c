@@ -11,8 +11,19 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <semaphore.h>
 #include "../include/graphic_engine.h"
 #include "../include/libscreen.h"
+#include "../include/frame.h"
+#include "../include/tile_cache.h"
+#include "../include/layout.h"
+#include "../include/snapshot.h"
+#include "../include/viewport.h"
+#include "../include/exchange.h"
+#include "../include/stream.h"
+#include "../include/record.h"
 #include "../include/command.h"
 #include "../include/space.h"
 #include "../include/types.h"
@@ -25,6 +36,13 @@
 #define ROWS 44       /*!< Establish screen size in y dimension */
 #define COLUMNS 120   /*!< Establish screen size in x dimension */
 #define TAMCELL_X 19  /*!< Establish cell size per line */
+#define MINIMAP_X 66  /*!< Column of the map area where the minimap starts */
+#define DESCRIPT_WIDTH 35 /*!< Columns of the description area */
+#define DIALOGUE_WIDTH 80 /*!< Columns of the dialogue area */
+#define EVENTS_WIDTH 35   /*!< Columns of the events area */
+#define TEXT_INDENT 2     /*!< Spaces before a text in its area */
+
+extern char *__data; /*!< Screen composed by libscreen (ROWS x COLUMNS characters, row after row) */
 
 /**
  * @brief Graphic engine
@@ -40,8 +58,36 @@ struct _Graphic_engine
   Area *feedback;   /*!< graphic engine area of feedback */
   Area *dialogue; /*!< graphic engine area of dialoge */
   Area *events; /*!< graphic engine area of events */
+  Frame *frame; /*!< what is on the terminal, only the changes are painted */
+  Tile_cache *tiles; /*!< rooms already drawn for the map area */
+  Layout_cache *layouts; /*!< texts already laid out for the description, dialogue and events areas */
+  Viewport *minimap; /*!< rooms laid out around the player for the minimap */
+  Snapshot_scroll scroll; /*!< pages of the inventory and the enemies shown in the panel */
+  char last_cmds[SNAPSHOT_FEEDBACK][SNAPSHOT_LINE]; /*!< last commands shown in the feedback area */
+  int n_last_cmds; /*!< number of last commands kept */
+  BOOL headless; /*!< TRUE if nothing is painted, only the dialogue is written */
+  Snapshot snaps[EXCHANGE_BUFFERS]; /*!< what the turns show, shared with the render thread (see exchange.h) */
+  int back; /*!< snapshot taken from the game */
+  int front; /*!< snapshot painted by the render thread */
+  Exchange *exchange; /*!< snapshots published to the render thread, NULL if there is no thread */
+  pthread_t thread; /*!< render thread */
+  sem_t ready; /*!< posted after each snapshot published */
+  int stop; /*!< set when the render thread has to end */
+  Stream *stream; /*!< spectators the frames are sent to, NULL if there is no stream */
+  Record *record; /*!< file the frames are recorded in, NULL if they are not recorded */
 };
 
+/**
+ * Private functions
+ */
+void graphic_engine_feedback(Graphic_engine *ge, Snapshot *snap);
+void graphic_engine_show(Graphic_engine *ge, const Snapshot *snap);
+void *graphic_engine_render(void *arg);
+void graphic_engine_paint_snapshot(Graphic_engine *ge, const Snapshot *snap);
+void graphic_engine_map_puts(Graphic_engine *ge, const Snapshot *snap, char *str, int *row);
+void graphic_engine_text_puts(Graphic_engine *ge, Area *area, const char *text, int width);
+void graphic_engine_page_puts(Graphic_engine *ge, int first, int n, int total, char list);
+
 /**
  * graphic_engine_create initializes game's members
  */
@@ -58,12 +104,49 @@ Graphic_engine *graphic_engine_create()
     return NULL;
 
   ge->map = screen_area_init(1, 1, 80, 25);
-  ge->descript = screen_area_init(82, 1, 35, 34);
+  ge->descript = screen_area_init(82, 1, DESCRIPT_WIDTH, 34);
   ge->banner = screen_area_init(30, 27, 19, 1);
   ge->help = screen_area_init(1, 28, 80, 3);
   ge->feedback = screen_area_init(1, 32, 80, 3);
-  ge->dialogue = screen_area_init(1, 36, 80, 7);
-  ge->events = screen_area_init(82, 36, 35, 7);
+  ge->dialogue = screen_area_init(1, 36, DIALOGUE_WIDTH, 7);
+  ge->events = screen_area_init(82, 36, EVENTS_WIDTH, 7);
+
+  ge->headless = FALSE;
+  ge->back = EXCHANGE_WRITER;
+  ge->front = EXCHANGE_READER;
+  ge->exchange = NULL;
+  ge->stream = NULL;
+  ge->record = NULL;
+  ge->n_last_cmds = 0;
+  ge->scroll.inventory = 0;
+  ge->scroll.enemies = 0;
+  ge->frame = frame_create(ROWS, COLUMNS);
+  ge->tiles = tile_cache_create();
+  ge->layouts = layout_cache_create();
+  ge->minimap = viewport_create(SNAPSHOT_MAP_W, SNAPSHOT_MAP_H, VIEWPORT_FLOOR);
+  if (ge->frame == NULL || ge->tiles == NULL || ge->layouts == NULL || ge->minimap == NULL)
+  {
+    graphic_engine_destroy(ge);
+    ge = NULL;
+    return NULL;
+  }
+
+  return ge;
+}
+
+/**
+ * graphic_engine_create_headless creates an engine that paints nothing
+ */
+Graphic_engine *graphic_engine_create_headless()
+{
+  Graphic_engine *ge = NULL;
+
+  /* No area is created, so libscreen is never used */
+  ge = (Graphic_engine *)calloc(1, sizeof(Graphic_engine));
+  if (ge == NULL)
+    return NULL;
+
+  ge->headless = TRUE;
 
   return ge;
 }
@@ -78,6 +161,15 @@ void graphic_engine_destroy(Graphic_engine *ge)
   if (!ge)
     return;
 
+  if (ge->headless)
+  {
+    free(ge);
+    return;
+  }
+
+  graphic_engine_stop_thread(ge);
+  stream_destroy(ge->stream);
+  record_close(ge->record);
   screen_area_destroy(ge->map);
   screen_area_destroy(ge->descript);
   screen_area_destroy(ge->banner);
@@ -85,6 +177,10 @@ void graphic_engine_destroy(Graphic_engine *ge)
   screen_area_destroy(ge->feedback);
   screen_area_destroy(ge->dialogue);
   screen_area_destroy(ge->events);
+  frame_destroy(ge->frame);
+  tile_cache_destroy(ge->tiles);
+  layout_cache_destroy(ge->layouts);
+  viewport_destroy(ge->minimap);
 
   screen_destroy();
   free(ge);
@@ -96,760 +192,429 @@ void graphic_engine_destroy(Graphic_engine *ge)
   */
 void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st)
 {
-  /* Variables declaration */
-  Id id_act = NO_ID, id_up = NO_ID, id_down = NO_ID, id_left= NO_ID, id_right= NO_ID, aux_obj_id = NO_ID;
-  Id player_loc = NO_ID, en_loc[MAX_ENEMYS] = {NO_ID};
-  Inventory *player_inventory = NULL;
-  int en_health[MAX_ENEMYS] = {0}, player_health = 0;
-  Space *space_act = NULL;
-  char obj = '\0', obj_l = '\0', obj_r = '\0';
-  char str[255];
-  T_Command last_cmd = UNKNOWN;
+  /* Nobody is watching, only the dialogue is written */
+  if (ge->headless)
+  {
+    dialogue_print(game_get_dialogue(game), stdout);
+    return;
+  }
+
+  /* The game is only read here, painting works on the snapshot */
+  snapshot_take(&ge->snaps[ge->back], game, ge->tiles, ge->minimap, &ge->scroll, st);
+  graphic_engine_feedback(ge, &ge->snaps[ge->back]);
+
+  if (ge->exchange)
+  {
+    ge->back = exchange_publish(ge->exchange, ge->back);
+    sem_post(&ge->ready);
+    return;
+  }
+
+  graphic_engine_show(ge, &ge->snaps[ge->back]);
+}
+
+/**
+ * @brief Adds the last command to the feedback lines of a snapshot
+ * @author Miguel Soto
+ *
+ * The feedback area shows the last commands, not only the one of the
+ * snapshot, so the lines are kept by the engine and copied into each
+ * snapshot: painting one of them never depends on the ones before.
+ *
+ * @param ge pointer to the graphic engine
+ * @param snap the snapshot just taken
+ */
+void graphic_engine_feedback(Graphic_engine *ge, Snapshot *snap)
+{
   extern char *cmd_to_str[N_CMD][N_CMDT];
-  int i;
-  char **gdesc = NULL, **gdesc_right = NULL, **gdesc_left = NULL, aux_gdesc[10][10];
-  char **enemy_gdesc = NULL;
-  char *description;
-  char *en_name[MAX_ENEMYS];
-  char *inspection, *dialogue, *events;
-  char link_up = '\0', link_down = '\0', link_right = '\0', link_left = '\0';
-  char *space_name, *space_name2, *space_name3, aux_name1[20] = "", aux_name2[20] = "", blank20[] = "                   ";
-  Set *object_set = NULL, *object_set_r = NULL, *object_set_l = NULL;
-  Enemy *enemy = NULL;
-
-  /* setting all proper values for each variable */
-  player_loc = game_get_player_location(game, 21);
-  id_act = player_loc;
-  player_inventory = player_get_inventory(game_get_player(game, game_get_player_id(game)));
-  player_health = player_get_health(game_get_player(game, game_get_player_id(game)));
-  description = (char*) space_get_brief_description(game_get_space(game, player_loc));
-  inspection = game_get_inspection(game);
-
-  for(i=0;i<MAX_ENEMYS;i++)
-  { 
-    /* Error Control */
-    if (game_get_enemy(game, game_get_enemy_id(game, i))==NULL)
-    {
-      break;
-    }
-    en_health[i] = enemy_get_health(game_get_enemy(game, game_get_enemy_id(game, i)));
-    en_name[i] = (char *)enemy_get_name(game_get_enemy(game, game_get_enemy_id(game, i)));
-    en_loc[i] = game_get_enemy_location(game, game_get_enemy_id(game, i));
+  const char *cmdl = cmd_to_str[snap->last_cmd - NO_CMD][CMDL], *cmds = cmd_to_str[snap->last_cmd - NO_CMD][CMDS];
+  char *line = NULL;
+
+  if (ge->n_last_cmds == SNAPSHOT_FEEDBACK)
+  {
+    memmove(ge->last_cmds[0], ge->last_cmds[1], (SNAPSHOT_FEEDBACK - 1) * SNAPSHOT_LINE);
+    ge->n_last_cmds--;
   }
+  line = ge->last_cmds[ge->n_last_cmds++];
 
-  /* Paint the in the map area */
-  screen_area_clear(ge->map);
-  
-  if (id_act != NO_ID)
+  if (snap->st == 0)
+  {
+    sprintf(line, " %.40s (%.40s): ERROR", cmdl, cmds);
+  }
+  else if (snap->st == 1)
+  {
+    sprintf(line, " %.40s (%.40s): OK", cmdl, cmds);
+  }
+  else
   {
-    space_act = game_get_space(game, id_act);
-    id_up = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, N)));
-    id_down = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, S)));
-    id_left = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, W)));
-    id_right = space_get_id_dest_by_link(game_get_link(game, space_get_link(space_act, E)));
+    sprintf(line, " %.40s (%.40s)", cmdl, cmds);
+  }
 
-    object_set = space_get_objects(game_get_space(game, id_act));
-    object_set_r = space_get_objects(game_get_space(game, id_right));
-    object_set_l = space_get_objects(game_get_space(game, id_left));
+  memcpy(snap->feedback, ge->last_cmds, sizeof(ge->last_cmds));
+  snap->n_feedback = ge->n_last_cmds;
+}
 
-    /* Space to the north of the current space */
-    if (id_up != NO_ID)
-    {
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
-      {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-        
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          i = set_get_nids(object_set) + 1;
-        }
-      }
+/**
+ * graphic_engine_scroll moves a list of the panel a page forward
+ */
+STATUS graphic_engine_scroll(Graphic_engine *ge, const char *list)
+{
+  /* Error control */
+  if (!ge || !list)
+  {
+    return ERROR;
+  }
 
-      space_name = (char *)space_get_name(game_get_space(game, id_up));
-      strncat(space_name, blank20, 15 - strlen(space_name));
-      sprintf(str, "  %.19s   | %s |", blank20, space_name);
-      screen_area_puts(ge->map, str);
-
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   +-----------------+", blank20);
-      screen_area_puts(ge->map, str);
-      
-      if (game_get_connection_status(game, id_act, N) == OPEN_L)
-      {
-        link_up = '^';
-      }
-      else
-      {
-        link_up = ' ';
-      }
+  if (strcmp(list, "i") == 0 || strcmp(list, "inventory") == 0)
+  {
+    ge->scroll.inventory += SNAPSHOT_INVENTORY_PAGE;
+  }
+  else if (strcmp(list, "e") == 0 || strcmp(list, "enemies") == 0)
+  {
+    ge->scroll.enemies += SNAPSHOT_ENEMIES_PAGE;
+  }
+  else
+  {
+    return ERROR;
+  }
 
-      if (game_get_connection_status(game, id_act, E) == OPEN_L)
-      {
-        link_right = '>';
-      }
-      else
-      {
-        link_right = ' ';
-      }
+  return OK;
+}
 
-      if (game_get_connection_status(game, id_act, W) == OPEN_L)
-      {
-        link_left = '<';
-      }
-      else
-      {
-        link_left = ' ';
-      }
+/**
+ * graphic_engine_start_thread starts painting in a thread of its own
+ */
+STATUS graphic_engine_start_thread(Graphic_engine *ge)
+{
+  /* Error control */
+  if (!ge || ge->headless)
+  {
+    return ERROR;
+  }
 
-      sprintf(str, "  %.19s            %c", blank20, link_up);
-      screen_area_puts(ge->map, str);
-    }
+  if (ge->exchange)
+  {
+    return OK;
+  }
 
-    /* Current space */
-    if (id_act != NO_ID)
+  ge->exchange = exchange_create();
+  if (!ge->exchange)
+  {
+    return ERROR;
+  }
+  ge->back = EXCHANGE_WRITER;
+  ge->front = EXCHANGE_READER;
+  ge->stop = 0;
+
+  if (sem_init(&ge->ready, 0, 0) != 0)
+  {
+    exchange_destroy(ge->exchange);
+    ge->exchange = NULL;
+    return ERROR;
+  }
+  if (pthread_create(&ge->thread, NULL, graphic_engine_render, ge) != 0)
+  {
+    sem_destroy(&ge->ready);
+    exchange_destroy(ge->exchange);
+    ge->exchange = NULL;
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * graphic_engine_start_stream sends the frames painted to spectators
+ */
+STATUS graphic_engine_start_stream(Graphic_engine *ge, const char *path)
+{
+  /* Error control */
+  if (!ge || ge->headless || !path || ge->stream || ge->exchange)
+  {
+    return ERROR;
+  }
+
+  ge->stream = stream_create(path, ROWS, COLUMNS);
+  if (!ge->stream)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * graphic_engine_start_record records the frames painted in a file
+ */
+STATUS graphic_engine_start_record(Graphic_engine *ge, const char *path)
+{
+  /* Error control */
+  if (!ge || ge->headless || !path || ge->record || ge->exchange)
+  {
+    return ERROR;
+  }
+
+  ge->record = record_create(path, ROWS, COLUMNS);
+  if (!ge->record)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/**
+ * graphic_engine_stop_thread paints the last snapshot and ends the render thread
+ */
+void graphic_engine_stop_thread(Graphic_engine *ge)
+{
+  if (!ge || !ge->exchange)
+  {
+    return;
+  }
+
+  __atomic_store_n(&ge->stop, 1, __ATOMIC_RELEASE);
+  sem_post(&ge->ready);
+  pthread_join(ge->thread, NULL);
+
+  sem_destroy(&ge->ready);
+  exchange_destroy(ge->exchange);
+  ge->exchange = NULL;
+}
+
+/**
+ * @brief Paints a snapshot on the terminal, with the prompt below
+ * @author Miguel Soto
+ *
+ * @param ge pointer to the graphic engine
+ * @param snap the snapshot painted
+ */
+void graphic_engine_show(Graphic_engine *ge, const Snapshot *snap)
+{
+  graphic_engine_paint_snapshot(ge, snap);
+
+  /* Dump to the terminal, only the cells that changed since the last turn */
+  frame_load(ge->frame, __data);
+  frame_paint(ge->frame, STDOUT_FILENO);
+  if (ge->record)
+  {
+    record_frame(ge->record, __data);
+  }
+  if (ge->stream)
+  {
+    stream_publish(ge->stream, __data, frame_get_last_output(ge->frame), frame_get_last_bytes(ge->frame));
+  }
+  printf("prompt:> ");
+}
+
+/**
+ * @brief Body of the render thread
+ * @author Miguel Soto
+ *
+ * It paints the newest snapshot each time one is published; if several
+ * were published while it was painting, only the last one is painted.
+ * libscreen and the frame are only used by this thread while it runs.
+ *
+ * @param arg pointer to the graphic engine
+ * @return NULL
+ */
+void *graphic_engine_render(void *arg)
+{
+  Graphic_engine *ge = (Graphic_engine *)arg;
+  int stop, taken;
+
+  do
+  {
+    sem_wait(&ge->ready);
+
+    /* Read before taking, so the snapshot published before the stop is painted */
+    stop = __atomic_load_n(&ge->stop, __ATOMIC_ACQUIRE);
+    taken = exchange_take(ge->exchange, ge->front);
+    if (taken >= 0)
     {
-      if (id_up == NO_ID)
-      {
-        for (i = 0; i < 6; i++)
-        {
-          sprintf(str, " ");
-          screen_area_puts(ge->map, str);
-        }
-      }
-      
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
-      {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          i = set_get_nids(object_set) + 1;
-        }
-      }
-      
+      ge->front = taken;
+      graphic_engine_show(ge, &ge->snaps[ge->front]);
+      fflush(stdout);
+    }
+  } while (!stop);
 
-       /* Checks that there are no other spaces to the left or right */    
-      if(id_left==NO_ID && id_right==NO_ID)  
-      {
-        sprintf(str, "  %.19s   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        sprintf(str, "  %.19s   | %s |", blank20, space_name);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |           gpp0^ | ", blank20);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act));
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  %.19s   | %s %s|", blank20, enemy_gdesc[i], gdesc[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str, "  %.19s   |        %s|", blank20, gdesc[i]);
-          }
-          else
-          {
-            sprintf(str, "  %.19s   |    %s    |", blank20, gdesc[i]);
-          }
-          
-          screen_area_puts(ge->map, str);
-        }
-        
-        sprintf(str, "  %.19s   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-      } 
-      
-      /* Checks that there is no space to the left but there is one to the right */    
-      if (id_right != NO_ID && id_left == NO_ID)
-      {  
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-
-        obj_r = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_right))) ==  FALSE) 
-          {
-            obj_r = ' ';
-          } else {
-            obj_r = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-
-        sprintf(str, "  %.19s   +-----------------+   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strcpy(aux_name1, space_name);
-        strncat(aux_name1, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_right));
-        strcpy(aux_name2, space_name2);
-        strncat(aux_name2, blank20, 15 - strlen(space_name2));
-        if (id_right == 16 && game_get_time(game) == DAY)
-        {
-          strcpy(aux_name2, "¬¬¬¬¬¬¬ ");
-        }
-        sprintf(str, "  %.19s   | %s |   | %s |", blank20, space_name, aux_name2);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  %.19s   |           gpp0^ |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_right));
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          strcpy(aux_gdesc[i], gdesc_right[i]);
-          if (id_right == 16 && game_get_time(game) == DAY)
-          {
-            strcpy(aux_gdesc[i], "¬¬¬¬ ");
-          }
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  %.19s   | %s %s|   |    %s    |", blank20, enemy_gdesc[i], gdesc[i], aux_gdesc[i]);
-          }
-          else if (enemy && i != 3)
-          {
-            sprintf(str, "  %.19s   |        %s|   |    %s    |", blank20, gdesc[i], aux_gdesc[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str, "  %.19s   |        %s| %c |    %s    |", blank20, gdesc[i], link_right, aux_gdesc[i]);
-          }
-          else if (i != 3) {
-            sprintf(str, "  %.19s   |    %s    |   |    %s    |", blank20, gdesc[i], aux_gdesc[i]);
-          } else {
-            sprintf(str, "  %.19s   |    %s    | %c |    %s    |", blank20, gdesc[i], link_right, aux_gdesc[i]);
-          }
-          screen_area_puts(ge->map, str);
-        }
-        
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   |                 |   |                 |", blank20);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   |        %c        |   |        %c        |", blank20, obj, obj_r);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  %.19s   +-----------------+   +-----------------+", blank20);
-        screen_area_puts(ge->map, str);  
-      }
-      
+  return NULL;
+}
 
+/**
+ * @brief Composes the screen of a snapshot
+ * @author Miguel Soto
+ *
+ * It only reads the snapshot, the game is not asked for anything.
+ *
+ * @param ge pointer to the graphic engine
+ * @param snap the snapshot painted
+ */
+void graphic_engine_paint_snapshot(Graphic_engine *ge, const Snapshot *snap)
+{
+  /* Variables declaration */
+  static const char *directions[SNAPSHOT_LINKS] = {"    %s: NORTH", "    %s:  SOUTH ", "    %s: EAST", "    %s: WEST", "    %s: UP", "    %s: DOWN"};
+  static const int north_rows[5] = {1, 3, 10, 9, 11}; /* Name, objects and bottom border */
+  static const int south_rows[5] = {0, 1, 3, 10, 9};  /* Top border, name and objects */
+  const Snapshot_room *here = &snap->rooms[SNAP_HERE], *up = &snap->rooms[SNAP_NORTH], *down = &snap->rooms[SNAP_SOUTH];
+  const Snapshot_room *left = &snap->rooms[SNAP_WEST], *right = &snap->rooms[SNAP_EAST];
+  char str[255];
+  char blank20[] = "                   ";
+  int i, row = 0;
 
-      if (id_left != NO_ID && id_right == NO_ID)
+  /* Paint the in the map area */
+  screen_area_clear(ge->map);
+  
+  if (snap->location != NO_ID)
+  {
+    /* Space to the north of the current space, its name and its objects */
+    if (up->id != NO_ID)
+    {
+      for (i = 0; i < 5; i++)
       {
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-        obj_l = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_left))) ==  FALSE) 
-          {
-            obj_l = ' ';
-          } else {
-            obj_l = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-
-        sprintf(str, "  +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_left));
-        strncat(space_name2, blank20, 15 - strlen(space_name2));
-        /*
-        if (id_right == 16 && game_get_time(game) == DAY)
-        {
-          strcpy(space_name2, "¬¬¬¬¬¬¬ ");
-        }
-        */
-        sprintf(str, "  | %s |   | %s |", space_name2, space_name);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |           gpp0^ |");
-        screen_area_puts(ge->map, str);
-        
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_left));
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (id_right == 16 && game_get_time(game) == DAY)
-          {
-            strcpy(gdesc_right[i], "¬¬¬¬ ");
-          } 
-          if (i != 3) {
-            sprintf(str, "  |    %s    |   |    %s    |", gdesc_right[i], gdesc[i]);
-            screen_area_puts(ge->map, str);
-          } else {
-            sprintf(str, "  |    %s    | %c |    %s    |", gdesc_right[i], link_right, gdesc[i]);
-            screen_area_puts(ge->map, str);
-          }
-        }
-        
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  |        %c        |   |        %c        |", obj_l, obj);
-        screen_area_puts(ge->map, str);
-        sprintf(str, "  +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);  
+        sprintf(str, "  %.19s   %s", blank20, up->tile[north_rows[i]]);
+        graphic_engine_map_puts(ge, snap, str, &row);
       }
-
-      /* Checks that there are both spaces to the left and right */    
-      if (id_left != NO_ID && id_right != NO_ID)
+      sprintf(str, "  %.19s            %c", blank20, up->link);
+      graphic_engine_map_puts(ge, snap, str, &row);
+    }
+    else
+    {
+      for (i = 0; i < 6; i++)
       {
-        obj = ' ';
-        for(i = 0; i < set_get_nids(object_set); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-          {
-            obj = ' ';
-          } else {
-            obj = '*';              
-            i = set_get_nids(object_set) + 1;
-          }
-        }
-        obj_r = ' ';
-        for(i = 0; i < set_get_nids(object_set_r); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_r, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_right))) ==  FALSE) 
-          {
-            obj_r = ' ';
-          } else {
-            obj_r = '*';              
-            i = set_get_nids(object_set_r) + 1;
-          }
-        }
-
-        obj_l = ' ';
-        for(i = 0; i < set_get_nids(object_set_l); i++)
-        {
-          aux_obj_id = set_get_ids_by_number(object_set_l, i);
-          
-          if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_left))) ==  FALSE) 
-          {
-            obj_l = ' ';
-          } else {
-            obj_l = '*';              
-            i = set_get_nids(object_set_l) + 1;
-          }
-        }
-
-        if (game_get_connection_status(game, id_act, E) == OPEN_L)
-        {
-          link_right = '>';
-        }
-        else
-        {
-          link_right = ' ';
-        }
-
-        if (game_get_connection_status(game, id_act, W) == OPEN_L)
-        {
-          link_left = '<';
-        }
-        else
-        {
-          link_left = ' ';
-        }
-        
-        sprintf(str, "  +-----------------+   +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
-
-        space_name = (char *)space_get_name(game_get_space(game, id_left));
-        strncat(space_name, blank20, 15 - strlen(space_name));
-        space_name2 = (char *)space_get_name(game_get_space(game, id_act));
-        strncat(space_name2, blank20, 15 - strlen(space_name2));
-        space_name3 = (char *)space_get_name(game_get_space(game, id_right));
-        strncat(space_name3, blank20, 15 - strlen(space_name3));
-        sprintf(str, "  | %s |   | %s |   | %s |", space_name, space_name2, space_name3);
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |           gpp0^ |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |                 |   |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-        gdesc = space_get_gdesc(game_get_space(game, id_act)); 
-        gdesc_right = space_get_gdesc(game_get_space(game, id_right)); 
-        gdesc_left = space_get_gdesc(game_get_space(game, id_left)); 
-        enemy = NULL;
-        enemy = game_get_enemy_in_space(game, id_act);
-        if (enemy)
-        {
-          enemy_gdesc = enemy_get_gdesc(enemy);
-        }
-        for (i = 0; i < TAM_GDESC_Y; i++)
-        {
-          if (i < ENEMY_GDESC_Y && enemy)
-          {
-            sprintf(str, "  |    %s    |   | %s %s|   |    %s    |", gdesc_left[i], enemy_gdesc[i], gdesc[i], gdesc_right[i]);
-          }
-          else if (enemy && i != 3)
-          {
-            sprintf(str, "  |    %s    |   |        %s|   |    %s    |", gdesc_left[i], gdesc[i], gdesc_right[i]);
-          }
-          else if (enemy)
-          {
-            sprintf(str,  "  |    %s    | %c |        %s| %c |    %s    |", gdesc_left[i], link_left, gdesc[i], link_right, gdesc_right[i]);
-          }
-          else if (i != 3) {
-            sprintf(str, "  |    %s    |   |    %s    |   |    %s    |", gdesc_left[i], gdesc[i], gdesc_right[i]);
-          } else {
-            sprintf(str, "  |    %s    | %c |    %s    | %c |    %s    |", gdesc_left[i], link_left, gdesc[i], link_right, gdesc_right[i]);
-          }
-          screen_area_puts(ge->map, str);
-        }
-
-        
-        sprintf(str, "  |                 |   |                 |   |                 |");
-        screen_area_puts(ge->map, str);
-
-        sprintf(str, "  |         %c       |   |         %c       |   |         %c       |", obj_l, obj, obj_r);
-        screen_area_puts(ge->map, str);  
-        sprintf(str, "  +-----------------+   +-----------------+   +-----------------+");
-        screen_area_puts(ge->map, str);
+        str[0] = '\0';
+        graphic_engine_map_puts(ge, snap, str, &row);
       }
     }
 
-    /* Space to the south of the current space */
-    if (id_down != NO_ID)
+    /* Current space, between the ones to the west and to the east */
+    for (i = 0; here->id != NO_ID && i < TILE_Y; i++)
     {
-      obj = ' ';
-      for(i = 0; i < set_get_nids(object_set); i++)
+      sprintf(str, "  %s %c %s", left->id != NO_ID ? left->tile[i] : blank20,
+              (left->id != NO_ID && i == TILE_LINK_ROW) ? left->link : ' ',
+              i == TILE_PLAYER_ROW ? "|           gpp0^ |" : here->tile[i]);
+      if (right->id != NO_ID)
       {
-        aux_obj_id = set_get_ids_by_number(object_set, i);
-        if (obj_is_visible(game_get_object(game, aux_obj_id), space_get_light_status(game_get_space(game, id_act))) ==  FALSE) 
-        {
-          obj = ' ';
-        } else {
-          obj = '*';              
-          break;
-        }
+        sprintf(str + strlen(str), " %c %s", i == TILE_LINK_ROW ? right->link : ' ', right->tile[i]);
       }
+      graphic_engine_map_puts(ge, snap, str, &row);
+    }
 
-      if (game_get_connection_status(game, id_act, S) == OPEN_L)
-      {
-        link_down = 'v';
-      }
-      else
+    /* Space to the south of the current space, its name and its objects */
+    if (down->id != NO_ID)
+    {
+      sprintf(str, "  %.19s            %c", blank20, down->link);
+      graphic_engine_map_puts(ge, snap, str, &row);
+      for (i = 0; i < 5; i++)
       {
-        link_down = ' ';
+        sprintf(str, "  %.19s   %s", blank20, down->tile[south_rows[i]]);
+        graphic_engine_map_puts(ge, snap, str, &row);
       }
+    }
 
-      sprintf(str, "  %.19s            %c", blank20, link_down);
-      screen_area_puts(ge->map, str);
-      sprintf(str, "  %.19s   +-----------------+", blank20);
-      screen_area_puts(ge->map, str);
-
-      space_name = (char *)space_get_name(game_get_space(game, id_down));
-      strncat(space_name, blank20, 15 - strlen(space_name));
-      sprintf(str, "  %.19s   | %s |", blank20, space_name);
-      screen_area_puts(ge->map, str);
-
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
-
-      sprintf(str, "  %.19s   |        %c        |", blank20, obj);
-      screen_area_puts(ge->map, str);
-
-      sprintf(str, "  %.19s   |                 |", blank20);
-      screen_area_puts(ge->map, str);
+    /* The rest of the minimap, below the rooms */
+    while (row < SNAPSHOT_MAP_Y)
+    {
+      str[0] = '\0';
+      graphic_engine_map_puts(ge, snap, str, &row);
     }
   }
   
   /* Paint in the description area */
   screen_area_clear(ge->descript);
   
-  if ((player_loc != NO_ID) && (en_loc[0] != NO_ID))
+  if (snap->location != NO_ID && snap->panel)
   {
-    sprintf(str, "  Objects in space:");
-    screen_area_puts(ge->descript, str);
-    
-    for(i=0;i< set_get_nids(space_get_objects(game_get_space(game, id_act)));i++)
-    { 
-      if (game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i)) == NULL)
-      {
-        break;                     
-      }
-
-      if (obj_is_visible(game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i)), space_get_light_status(game_get_space(game, id_act)))== TRUE) {
-        sprintf(str, "  %s ", obj_get_name(game_get_object(game,set_get_ids_by_number(space_get_objects(game_get_space(game, id_act)), i))));
-        screen_area_puts(ge->descript, str);
-      }
+    screen_area_puts(ge->descript, "  Objects in space:");
+    for (i = 0; i < snap->n_objects; i++)
+    {
+      sprintf(str, "  %s ", snap->objects[i]);
+      screen_area_puts(ge->descript, str);
     }
 
-    sprintf(str, "   ") ;
-    screen_area_puts(ge->descript, str);
-
-    sprintf(str, "  PLAYER (gpp0^):");
-    screen_area_puts(ge->descript, str);
-    gdesc = player_get_gdesc(game_get_player(game, 21));
-    sprintf(str, "  +--------+");
-    screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "   ");
+    screen_area_puts(ge->descript, "  PLAYER (gpp0^):");
+    screen_area_puts(ge->descript, "  +--------+");
     for (i = 0; i < PLAYER_GDESC_Y; i++)
     {
-      sprintf(str, "  |  %s  |", gdesc[i]);
+      sprintf(str, "  |  %s  |", snap->player_gdesc[i]);
       screen_area_puts(ge->descript, str);
     }
-    sprintf(str, "  +--------+");
-    screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "  +--------+");
 
-    sprintf(str, "  Player location:%d", (int)player_loc);
+    sprintf(str, "  Player location:%d", (int)snap->location);
     screen_area_puts(ge->descript, str);
   
-    if(player_inventory==NULL || set_get_nids(inventory_get_objects(player_inventory)) == 0)
+    if (snap->inventory_total == 0)
     {
-      sprintf(str, "  Player object: No object" );
-      screen_area_puts(ge->descript, str);
+      screen_area_puts(ge->descript, "  Player object: No object");
     }
     else
     {
-      sprintf(str, "  Player objects:"); 
-      screen_area_puts(ge->descript, str);
-
-    
-      for (i = 0; i < set_get_nids(inventory_get_objects(player_inventory)); i++)
+      screen_area_puts(ge->descript, "  Player objects:");
+      for (i = 0; i < snap->n_inventory; i++)
       {
-        sprintf(str, "    %s", obj_get_name(game_get_object(game, set_get_ids_by_number(inventory_get_objects(player_inventory),i)))); 
+        sprintf(str, "    %s", snap->inventory[i]);
         screen_area_puts(ge->descript, str);
       }
+      graphic_engine_page_puts(ge, snap->inventory_first, snap->n_inventory, snap->inventory_total, 'i');
     }
     
-    sprintf(str, "  Player health:%d", (int)player_health);
-    screen_area_puts(ge->descript, str);
-
-    
-    sprintf(str, "   ") ;
+    sprintf(str, "  Player health:%d", snap->player_health);
     screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "   ");
 
-    sprintf(str, "  Enemies in space:") ;
-    screen_area_puts(ge->descript, str);
-    for (i = 0; i < MAX_ENEMYS; i++) {
-      if (en_loc[i] == id_act) {
-        sprintf(str, "    Enemy name:%s", en_name[i]);
-        screen_area_puts(ge->descript, str);
-        sprintf(str, "    Enemy health:%d", (int)en_health[i]);
-        screen_area_puts(ge->descript, str);
-        sprintf(str, "   ") ;
-        screen_area_puts(ge->descript, str);
-      }
+    screen_area_puts(ge->descript, "  Enemies in space:");
+    for (i = 0; i < snap->n_enemies; i++)
+    {
+      sprintf(str, "    Enemy name:%s", snap->enemies[i].name);
+      screen_area_puts(ge->descript, str);
+      sprintf(str, "    Enemy health:%d", snap->enemies[i].health);
+      screen_area_puts(ge->descript, str);
+      screen_area_puts(ge->descript, "   ");
     }
+    graphic_engine_page_puts(ge, snap->enemies_first, snap->n_enemies, snap->enemies_total, 'e');
 
-    sprintf(str, "   ");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  Info:");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  %s", description);
-    screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "   ");
+    screen_area_puts(ge->descript, "  Info:");
+    graphic_engine_text_puts(ge, ge->descript, snap->description, DESCRIPT_WIDTH);
 
-    sprintf(str, "   ");
-    screen_area_puts(ge->descript, str);
-    sprintf(str, "  Descriptions:");
-    screen_area_puts(ge->descript, str);
-    if(inspection){
-      sprintf(str, "  %s", inspection);
-      screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "   ");
+    screen_area_puts(ge->descript, "  Descriptions:");
+    if (snap->has_inspection)
+    {
+      graphic_engine_text_puts(ge, ge->descript, snap->inspection, DESCRIPT_WIDTH);
     }
 
-    sprintf(str, "   ");
-    screen_area_puts(ge->descript, str);
-    for (i = 0; i < 6; i++)
+    screen_area_puts(ge->descript, "   ");
+    if (snap->n_closed > 0)
     {
-      if (link_get_status(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == CLOSE )
-      {
-        if (link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) != NULL)
-        {
-          sprintf(str, "  Closed links(for keys): ");
-          screen_area_puts(ge->descript, str);
-
-          break;
-        }
-      }
+      screen_area_puts(ge->descript, "  Closed links(for keys): ");
     }
-    for (i = 0; i < 6; i++)
+    for (i = 0; i < snap->n_closed; i++)
     {
-      if (link_get_status(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == CLOSE )
+      if (snap->closed[i].dir >= N && snap->closed[i].dir <= D)
       {
-        if (link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) != NULL)
-        {
-          if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 0)
-          {
-            sprintf(str, "    %s: NORTH", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          } 
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 1)
-          {
-            sprintf(str, "    %s:  SOUTH ", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 2)
-          {
-            sprintf(str, "    %s: EAST", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 3)
-          {
-            sprintf(str, "    %s: WEST", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 4)
-          {
-            sprintf(str, "    %s: UP", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-          else if (link_get_direction(game_get_link(game, space_get_link(game_get_space(game, id_act), i))) == 5)
-          {
-            sprintf(str, "    %s: DOWN", link_get_name(game_get_link(game, space_get_link(game_get_space(game, id_act), i))));
-            screen_area_puts(ge->descript, str);
-          }
-        }
+        sprintf(str, directions[snap->closed[i].dir], snap->closed[i].name);
+        screen_area_puts(ge->descript, str);
       }
     }
-    
-  if (game_get_time(game) == DAY)
-  {
-    sprintf(str, "  Time: DAY");
-  } 
-  else
-  {
-    sprintf(str, "  Time: NIGHT");
-  }
-  screen_area_puts(ge->descript, str);
-    
-  if (player_get_health(game_get_player(game, 21)) <= 0 || enemy_get_health(game_get_enemy(game, 45)) <= 0)
-  {
-    screen_area_clear(ge->descript);
-    screen_area_clear(ge->map);
-    for (i = 0; i < 12; i++)
+
+    screen_area_puts(ge->descript, snap->time == DAY ? "  Time: DAY" : "  Time: NIGHT");
+
+    if (snap->game_over)
     {
-      sprintf(str, "             ");
-      screen_area_puts(ge->map, str);
+      screen_area_clear(ge->descript);
+      screen_area_clear(ge->map);
+      for (i = 0; i < 12; i++)
+      {
+        screen_area_puts(ge->map, "             ");
+      }
+      screen_area_puts(ge->map, "                                 GAME IS OVER");
+      screen_area_puts(ge->map, "                           Press e to exit the game");
     }
-    sprintf(str, "                                 GAME IS OVER");
-    screen_area_puts(ge->map, str);
-    sprintf(str, "                           Press e to exit the game");
-    screen_area_puts(ge->map, str);
-  }
     
-    sprintf(str, "  ");
-    screen_area_puts(ge->descript, str);
+    screen_area_puts(ge->descript, "  ");
   }
 
   /* Paint in the banner area */
@@ -857,65 +622,107 @@ void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st)
 
   /* Paint in the help area */
   screen_area_clear(ge->help);
-  sprintf(str, "                         The commands you can use are:");
-  screen_area_puts(ge->help, str);
-  sprintf(str, " m(MOVE), t(TAKE), d(DROP), a(ATTACK), i(INSPECT), e(EXIT), s(SAVE), l(LOAD)");
-  screen_area_puts(ge->help, str);
-  sprintf(str, "               o (OPEN), ton (TURNON), toff (TURNOFF), u(USE)");
-  screen_area_puts(ge->help, str);
-  /*
-  sprintf(str, " Player object will be -1 as long as it doesn't carry one");
-  screen_area_puts(ge->help, str);
-  */
+  screen_area_puts(ge->help, "                         The commands you can use are:");
+  screen_area_puts(ge->help, " m(MOVE), t(TAKE), d(DROP), a(ATTACK), i(INSPECT), e(EXIT), s(SAVE), l(LOAD)");
+  screen_area_puts(ge->help, "               o (OPEN), ton (TURNON), toff (TURNOFF), u(USE)");
 
   /* Paint in the feedback area */
-  last_cmd = game_get_last_command(game);
-  if (st == 0)
+  screen_area_clear(ge->feedback);
+  for (i = 0; i < snap->n_feedback; i++)
   {
-    sprintf(str, " %s (%s): ERROR", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    screen_area_puts(ge->feedback, (char *)snap->feedback[i]);
   }
-  else if (st == 1)
+
+  /* Paint in the dialogue area */
+  screen_area_clear(ge->dialogue);
+  screen_area_puts(ge->dialogue, " Dialogue:");
+  if (snap->has_dialogue)
   {
-    sprintf(str, " %s (%s): OK", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    graphic_engine_text_puts(ge, ge->dialogue, snap->dialogue, DIALOGUE_WIDTH);
   }
-  else
+
+  /* Paint in the events area */
+  screen_area_clear(ge->events);
+  screen_area_puts(ge->events, " Events:");
+  if (snap->has_events)
   {
-    sprintf(str, " %s (%s)", cmd_to_str[last_cmd - NO_CMD][CMDL], cmd_to_str[last_cmd - NO_CMD][CMDS]);
+    graphic_engine_text_puts(ge, ge->events, snap->events, EVENTS_WIDTH);
   }
-  
-  screen_area_puts(ge->feedback, str);
+}
 
-/* prints the dialoge area */
-screen_area_clear(ge->dialogue);
+/**
+ * @brief Puts a line of the map area, with its row of the minimap
+ * @author Miguel Soto
+ *
+ * @param ge pointer to the graphic engine
+ * @param snap the snapshot painted
+ * @param str the line, it must have room for MINIMAP_X + SNAPSHOT_MAP_X characters
+ * @param row row of the map area, it is moved to the next one
+ */
+void graphic_engine_map_puts(Graphic_engine *ge, const Snapshot *snap, char *str, int *row)
+{
+  int len = strlen(str);
 
-screen_area_puts(ge->dialogue, " Dialogue:");
-dialogue = dialogue_get_error(game_get_dialogue(game));
+  if (*row < SNAPSHOT_MAP_Y && snap->minimap[*row][0] != '\0')
+  {
+    if (len < MINIMAP_X)
+    {
+      memset(str + len, ' ', MINIMAP_X - len);
+    }
+    strcpy(str + MINIMAP_X, snap->minimap[*row]);
+  }
+  else if (len == 0)
+  {
+    strcpy(str, " ");
+  }
+  (*row)++;
 
-if(dialogue == NULL){}
-else if(strcmp(dialogue, " ") == 0){
-  dialogue = dialogue_get_command(game_get_dialogue(game));
+  screen_area_puts(ge->map, str);
 }
 
-if (dialogue)
+/**
+ * @brief Puts a text of a snapshot in an area, laid out once for its width
+ * @author Miguel Soto
+ *
+ * The rows are the ones the area writes for the text after TEXT_INDENT
+ * spaces. They are put in a single call, so an area that is full scrolls
+ * once, as it did when the text was put.
+ *
+ * @param ge pointer to the graphic engine
+ * @param area the area
+ * @param text the text
+ * @param width columns of the area
+ */
+void graphic_engine_text_puts(Graphic_engine *ge, Area *area, const char *text, int width)
 {
-  sprintf(str, "  %s", dialogue);
-  screen_area_puts(ge->dialogue, str);
-}
+  char *rows = NULL;
 
-/* prints the events area */
-screen_area_clear(ge->events);
-
-screen_area_puts(ge->events, " Events:");
-events = dialogue_get_event(game_get_dialogue(game));
-if (events)
-{
-  sprintf(str, "  %s", events);
-  screen_area_puts(ge->events, str);
+  rows = layout_cache_get(ge->layouts, text, TEXT_INDENT, width, NULL);
+  if (rows)
+  {
+    screen_area_puts(area, rows);
+  }
 }
 
+/**
+ * @brief Puts which page of a list of the panel is shown
+ * @author Miguel Soto
+ *
+ * Nothing is put if the whole list fits in a page.
+ *
+ * @param ge pointer to the graphic engine
+ * @param first position of the first one shown
+ * @param n number shown
+ * @param total length of the list
+ * @param list argument of the scroll command for the list
+ */
+void graphic_engine_page_puts(Graphic_engine *ge, int first, int n, int total, char list)
+{
+  char str[64];
 
-  /* Dump to the terminal */
-  screen_paint();
-  printf("prompt:> ");
-
+  if (n < total)
+  {
+    sprintf(str, "    %d-%d of %d (sc %c: more)", first + 1, first + n, total, list);
+    screen_area_puts(ge->descript, str);
+  }
 }
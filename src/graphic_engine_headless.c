@@ -0,0 +1,122 @@
+/**
+ * @brief It implements a graphic engine that never paints
+ *
+ * It is the engine of juego_headless: the whole interface of
+ * graphic_engine.h without a screen, so neither libscreen nor the painter
+ * are linked. Every engine is headless, it only writes the dialogue.
+ *
+ * @file graphic_engine_headless.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "../include/graphic_engine.h"
+
+/**
+ * @brief Graphic engine
+ *
+ * There is nothing to keep: no areas, no frames, no caches.
+ */
+struct _Graphic_engine
+{
+  BOOL headless; /*!< Always TRUE */
+};
+
+/**
+ * graphic_engine_create creates a headless engine, there is no screen
+ */
+Graphic_engine *graphic_engine_create()
+{
+  return graphic_engine_create_headless();
+}
+
+/**
+ * graphic_engine_create_headless creates an engine that paints nothing
+ */
+Graphic_engine *graphic_engine_create_headless()
+{
+  Graphic_engine *ge = NULL;
+
+  ge = (Graphic_engine *)calloc(1, sizeof(Graphic_engine));
+  if (ge == NULL)
+    return NULL;
+
+  ge->headless = TRUE;
+
+  return ge;
+}
+
+/**
+ * graphic_engine_destroy frees the engine
+ */
+void graphic_engine_destroy(Graphic_engine *ge)
+{
+  free(ge);
+}
+
+/**
+ * graphic_engine_paint_game writes the dialogue of the turn
+ */
+void graphic_engine_paint_game(Graphic_engine *ge, Game *game, int st)
+{
+  if (!ge)
+    return;
+
+  dialogue_print(game_get_dialogue(game), stdout);
+}
+
+/**
+ * graphic_engine_start_thread fails, there is nothing to paint
+ */
+STATUS graphic_engine_start_thread(Graphic_engine *ge)
+{
+  return ERROR;
+}
+
+/**
+ * graphic_engine_stop_thread does nothing, no thread is ever started
+ */
+void graphic_engine_stop_thread(Graphic_engine *ge)
+{
+}
+
+/**
+ * graphic_engine_start_stream fails, no frame is painted
+ */
+STATUS graphic_engine_start_stream(Graphic_engine *ge, const char *path)
+{
+  return ERROR;
+}
+
+/**
+ * graphic_engine_start_record fails, no frame is painted
+ */
+STATUS graphic_engine_start_record(Graphic_engine *ge, const char *path)
+{
+  return ERROR;
+}
+
+/**
+ * graphic_engine_scroll only checks the list, there is no panel to move
+ */
+STATUS graphic_engine_scroll(Graphic_engine *ge, const char *list)
+{
+  /* Error control */
+  if (!ge || !list)
+  {
+    return ERROR;
+  }
+
+  if (strcmp(list, "i") != 0 && strcmp(list, "inventory") != 0 &&
+      strcmp(list, "e") != 0 && strcmp(list, "enemies") != 0)
+  {
+    return ERROR;
+  }
+
+  return OK;
+}
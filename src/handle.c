@@ -0,0 +1,191 @@
+/**
+ * @brief It implements the tagged handles of the entities of the game
+ *
+ * @file handle.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include "../include/handle.h"
+#include "../include/container.h"
+
+VECTOR_DECLARE(Gen_vector, unsigned int);
+VECTOR_DEFINE(Gen_vector, unsigned int);
+HMAP_DECLARE(Handle_map, Id, Handle);
+HMAP_DEFINE(Handle_map, Id, Handle, CONTAINER_HASH_INT, NO_ID);
+
+/**
+ * @brief Handle table
+ *
+ * The ids are translated through a hash map. Each kind has the generations
+ * of its slots in a vector indexed like the game array of the entities.
+ */
+struct _Handle_table
+{
+  Handle_map ids;               /*!< Handle of each id */
+  Gen_vector gen[HANDLE_KINDS]; /*!< Generation of each slot of each kind */
+};
+
+/**
+ * handle_table_create creates an empty handle table
+ */
+Handle_table *handle_table_create()
+{
+  Handle_table *table = NULL;
+  int i;
+
+  table = (Handle_table *)malloc(sizeof(Handle_table));
+  /* Error control */
+  if (!table)
+  {
+    return NULL;
+  }
+
+  Handle_map_init(&table->ids, NULL);
+  for (i = 0; i < HANDLE_KINDS; i++)
+  {
+    Gen_vector_init(&table->gen[i], NULL);
+  }
+
+  return table;
+}
+
+/**
+ * handle_table_destroy frees a handle table
+ */
+STATUS handle_table_destroy(Handle_table *table)
+{
+  int i;
+
+  /* Error control */
+  if (!table)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < HANDLE_KINDS; i++)
+  {
+    Gen_vector_free(&table->gen[i]);
+  }
+  Handle_map_free(&table->ids);
+  free(table);
+
+  return OK;
+}
+
+/**
+ * handle_table_add gives a handle to an entity
+ */
+Handle handle_table_add(Handle_table *table, Id id, Handle_kind kind, int index)
+{
+  Gen_vector *gen = NULL;
+  Handle handle;
+
+  /* Error control */
+  if (!table || id < 0 || kind <= HANDLE_NONE || kind >= HANDLE_KINDS || index < 0 || index > (int)HANDLE_INDEX_MASK)
+  {
+    return NO_HANDLE;
+  }
+
+  /* New slots start at generation 0 */
+  gen = &table->gen[kind];
+  while (gen->size <= index)
+  {
+    if (Gen_vector_push(gen, 0) == ERROR)
+    {
+      return NO_HANDLE;
+    }
+  }
+
+  handle = HANDLE_MAKE(kind, gen->data[index], index);
+  if (Handle_map_put(&table->ids, id, handle) == ERROR)
+  {
+    return NO_HANDLE;
+  }
+
+  return handle;
+}
+
+/**
+ * handle_table_find translates an id to its handle
+ */
+Handle handle_table_find(Handle_table *table, Id id)
+{
+  Handle *handle = NULL;
+
+  /* Error control */
+  if (!table || id < 0)
+  {
+    return NO_HANDLE;
+  }
+
+  handle = Handle_map_get(&table->ids, id);
+  if (!handle)
+  {
+    return NO_HANDLE;
+  }
+
+  return handle_table_is_valid(table, *handle) == TRUE ? *handle : NO_HANDLE;
+}
+
+/**
+ * handle_table_is_valid checks the generation of a handle
+ */
+BOOL handle_table_is_valid(Handle_table *table, Handle handle)
+{
+  Handle_kind kind = HANDLE_KIND(handle);
+  int index = HANDLE_INDEX(handle);
+
+  /* Error control */
+  if (!table || kind <= HANDLE_NONE || kind >= HANDLE_KINDS || index >= table->gen[kind].size)
+  {
+    return FALSE;
+  }
+
+  return HANDLE_GEN(handle) == (table->gen[kind].data[index] & HANDLE_GEN_MASK) ? TRUE : FALSE;
+}
+
+/**
+ * handle_table_release changes the generation of the slot of a handle
+ */
+STATUS handle_table_release(Handle_table *table, Handle handle)
+{
+  /* Error control */
+  if (handle_table_is_valid(table, handle) == FALSE)
+  {
+    return ERROR;
+  }
+
+  table->gen[HANDLE_KIND(handle)].data[HANDLE_INDEX(handle)]++;
+
+  return OK;
+}
+
+/**
+ * handle_table_reset forgets every id and releases every handle
+ */
+STATUS handle_table_reset(Handle_table *table)
+{
+  int i, j;
+
+  /* Error control */
+  if (!table)
+  {
+    return ERROR;
+  }
+
+  Handle_map_clear(&table->ids);
+
+  for (i = 0; i < HANDLE_KINDS; i++)
+  {
+    for (j = 0; j < table->gen[i].size; j++)
+    {
+      table->gen[i].data[j]++;
+    }
+  }
+
+  return OK;
+}
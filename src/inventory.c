@@ -13,32 +13,114 @@
 #include <stdlib.h>
 #include <string.h>
 #include "../include/inventory.h"
+#include "../include/container.h"
+
+#define INVENTORY_BUCKET(type) ((type) - UNKNOWN_TYPE) /*!< Bucket of an Obj_type */
+
+VECTOR_DECLARE(Object_vector, Object *);
+VECTOR_DEFINE(Object_vector, Object *);
 
 /**
  * @brief Inventory
  *
  * This struct stores all the 
  * informaction of an inventory.
+ *
+ * The carried objects are grouped by type, one bucket after another, and
+ * bucket b goes from start[b] to start[b + 1]. The equipment summary is
+ * kept up to date on every add and remove.
  */
 struct _Inventory {
   Set* objects;	/*!< Set of objects included in invetory */
   int max_objs; /*!< Defines the maximun objects of the inventory */
+  Object_vector carried;            /*!< Objects carried, grouped by type */
+  int start[INVENTORY_TYPES + 1];   /*!< Where each bucket begins in carried (the last one is the total) */
+  Object *weapon;                   /*!< Weapon in hand, the sword with the lowest id (NULL if none) */
+  int durability;                   /*!< Durability left of the weapon in hand */
+  int crit_bonus;                   /*!< Highest crit chance given by a carried object */
+  Arena *arena; /*!< Arena where the inventory lives (NULL for the heap) */
 };
 
+/**
+ * Private functions
+ */
+void inventory_reset_types(Inventory *inventory);
+void inventory_update_summary(Inventory *inventory);
+
+/**
+ * @brief Empties the buckets and the equipment summary of an inventory
+ * @author Miguel Soto
+ *
+ * @param inventory a pointer to the inventory
+ */
+void inventory_reset_types(Inventory *inventory)
+{
+  int b;
+
+  for (b = 0; b <= INVENTORY_TYPES; b++)
+  {
+    inventory->start[b] = 0;
+  }
+  Object_vector_clear(&inventory->carried);
+  inventory->weapon = NULL;
+  inventory->durability = 0;
+  inventory->crit_bonus = 0;
+}
+
+/**
+ * @brief Works out again the equipment summary of an inventory
+ * @author Miguel Soto
+ *
+ * @param inventory a pointer to the inventory
+ */
+void inventory_update_summary(Inventory *inventory)
+{
+  int b = INVENTORY_BUCKET(SWORD), i;
+
+  inventory->weapon = NULL;
+  for (i = inventory->start[b]; i < inventory->start[b + 1]; i++)
+  {
+    if (!inventory->weapon || obj_get_id(inventory->carried.data[i]) < obj_get_id(inventory->weapon))
+    {
+      inventory->weapon = inventory->carried.data[i];
+    }
+  }
+  inventory->durability = object_get_durability(inventory->weapon);
+
+  inventory->crit_bonus = 0;
+  for (i = 0; i < inventory->start[INVENTORY_TYPES]; i++)
+  {
+    if (object_get_crit(inventory->carried.data[i]) > inventory->crit_bonus)
+    {
+      inventory->crit_bonus = object_get_crit(inventory->carried.data[i]);
+    }
+  }
+}
+
 /** inventory_create allocates memory for a new inventory
   *  and initializes its members
   */
 Inventory* inventory_create() {
+  return inventory_create_in(NULL);
+}
+
+/** inventory_create_in creates an inventory whose memory
+  *  comes from an arena
+  */
+Inventory* inventory_create_in(Arena *arena) {
   Inventory *newInventory = NULL;
 
-  newInventory = (Inventory *) malloc(sizeof (Inventory));
+  newInventory = arena ? (Inventory *) arena_alloc(arena, sizeof (Inventory)) : (Inventory *) malloc(sizeof (Inventory));
   if (newInventory == NULL) {
     return NULL;
   }
 
   /* Initialization of an empty inventory*/
-  newInventory->objects = set_create();
+  newInventory->objects = set_create_in(arena);
   newInventory->max_objs = 0;
+  Object_vector_init(&newInventory->carried, arena);
+  inventory_reset_types(newInventory);
+  newInventory->arena = arena;
 
   return newInventory;
 }
@@ -53,7 +135,13 @@ STATUS inventory_destroy(Inventory* inventory) {
     return ERROR;
   }
 
+  /* It goes away with its arena */
+  if (inventory->arena) {
+    return OK;
+  }
+
 	set_destroy(inventory->objects);
+  Object_vector_free(&inventory->carried);
 	free(inventory);
 
   return OK;
@@ -84,6 +172,8 @@ STATUS inventory_set_objects(Inventory* inventory, Set* set) {
   set_destroy(inventory->objects);
 
 	inventory->objects = set;
+  /* Only ids come with the set, so no object is classified */
+  inventory_reset_types(inventory);
 	return OK;
 }
 
@@ -114,10 +204,12 @@ int inventory_get_maxObjs(Inventory *inventory)
 
 /* It adds an object to the inventory if possible
 	*/
-STATUS inventory_add_object(Inventory* inventory, Id object) {
+STATUS inventory_add_object(Inventory* inventory, Object *object) {
+  Id id = obj_get_id(object);
+  int b, i;
 
 	/*CONTROL ERROR*/
-	if(!inventory || !object){
+	if(!inventory || id == NO_ID || !id){
 		return ERROR;
 	}
 
@@ -125,7 +217,27 @@ STATUS inventory_add_object(Inventory* inventory, Id object) {
 		return ERROR;
 	}
 
-	set_add(inventory->objects, object);
+	if (set_add(inventory->objects, id) == ERROR) {
+    return ERROR;
+  }
+
+  /* It goes at the end of its bucket, the next buckets move one place */
+  b = INVENTORY_BUCKET(obj_get_type(object));
+  if (Object_vector_insert(&inventory->carried, inventory->start[b + 1], object) == ERROR) {
+    set_del_id(inventory->objects, id);
+    return ERROR;
+  }
+  for (i = b + 1; i <= INVENTORY_TYPES; i++) {
+    inventory->start[i]++;
+  }
+
+  if (b == INVENTORY_BUCKET(SWORD) && (!inventory->weapon || id < obj_get_id(inventory->weapon))) {
+    inventory->weapon = object;
+    inventory->durability = object_get_durability(object);
+  }
+  if (object_get_crit(object) > inventory->crit_bonus) {
+    inventory->crit_bonus = object_get_crit(object);
+  }
 
 	return OK;
 	
@@ -149,20 +261,126 @@ BOOL inventory_has_id(Inventory* inventory, Id object){
 /* It removes an object of the inventory
 	*/
 STATUS inventory_remove_object(Inventory* inventory, Id object) {
+  Object *removed = NULL;
+  int b, i;
 
 	/*CONTROL ERROR*/
 	if(!inventory || !object){
 		return ERROR;
 	}
 
-	if(set_del_id(inventory->objects, object) == OK){
-		return OK;
+	if(set_del_id(inventory->objects, object) == ERROR){
+		return ERROR;
 	}
 
-	return ERROR;
+  for (i = 0; i < inventory->start[INVENTORY_TYPES] && obj_get_id(inventory->carried.data[i]) != object; i++);
+  if (i == inventory->start[INVENTORY_TYPES]) {
+    /* It came with inventory_set_objects */
+    return OK;
+  }
+
+  removed = inventory->carried.data[i];
+  b = INVENTORY_BUCKET(obj_get_type(removed));
+  Object_vector_remove(&inventory->carried, i);
+  for (i = b + 1; i <= INVENTORY_TYPES; i++) {
+    inventory->start[i]--;
+  }
+
+  if (removed == inventory->weapon || (inventory->crit_bonus > 0 && object_get_crit(removed) == inventory->crit_bonus)) {
+    inventory_update_summary(inventory);
+  }
+
+	return OK;
 	
 }
 
+/* It tells if an inventory is full
+*/
+BOOL inventory_is_full(Inventory *inventory) {
+
+  /*CONTROL ERROR*/
+  if (!inventory) {
+    return TRUE;
+  }
+
+  return set_get_nids(inventory->objects) >= inventory->max_objs ? TRUE : FALSE;
+}
+
+/* It gets the number of objects of a type
+*/
+int inventory_count_type(Inventory *inventory, Obj_type type) {
+
+  /*CONTROL ERROR*/
+  if (!inventory || type < UNKNOWN_TYPE || type >= MAX_OBJ_TYPES) {
+    return -1;
+  }
+
+  return inventory->start[INVENTORY_BUCKET(type) + 1] - inventory->start[INVENTORY_BUCKET(type)];
+}
+
+/* It gets an object of a type
+*/
+Object *inventory_get_type_object(Inventory *inventory, Obj_type type, int n) {
+
+  /*CONTROL ERROR*/
+  if (n < 0 || n >= inventory_count_type(inventory, type)) {
+    return NULL;
+  }
+
+  return inventory->carried.data[inventory->start[INVENTORY_BUCKET(type)] + n];
+}
+
+/* It gets the weapon in hand
+*/
+Object *inventory_get_weapon(Inventory *inventory) {
+
+  /*CONTROL ERROR*/
+  if (!inventory) {
+    return NULL;
+  }
+
+  return inventory->weapon;
+}
+
+/* It gets the durability of the weapon in hand
+*/
+int inventory_get_weapon_durability(Inventory *inventory) {
+
+  /*CONTROL ERROR*/
+  if (!inventory || !inventory->weapon) {
+    return 0;
+  }
+
+  return inventory->durability;
+}
+
+/* It gets the crit chance given by the objects
+*/
+int inventory_get_crit_bonus(Inventory *inventory) {
+
+  /*CONTROL ERROR*/
+  if (!inventory) {
+    return 0;
+  }
+
+  return inventory->crit_bonus;
+}
+
+/* It wears the weapon in hand
+*/
+int inventory_wear_weapon(Inventory *inventory) {
+
+  /*CONTROL ERROR*/
+  if (!inventory || !inventory->weapon) {
+    return -1;
+  }
+
+  inventory->durability--;
+  object_set_durability(inventory->weapon, inventory->durability);
+
+  return inventory->durability;
+}
+
 /** It prints the enemy information
   */
 STATUS inventory_print(Inventory* inventory) {
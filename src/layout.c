@@ -0,0 +1,229 @@
+/**
+ * @brief It implements the cache of the texts laid out in the areas
+ *
+ * @file layout.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/layout.h"
+
+/**
+ * @brief Rows of a text and what they were laid out from
+ */
+typedef struct
+{
+  char *text;         /*!< Copy of the text, NULL if the entry is free */
+  size_t len;         /*!< Length of the text */
+  unsigned long hash; /*!< Hash of the text, see layout_cache_hash */
+  int indent;         /*!< Spaces before the text */
+  int width;          /*!< Columns of the rows */
+  int n_rows;         /*!< Number of rows */
+  char *rows;         /*!< The rows, one after another and ended by '\0' */
+  size_t size;        /*!< Bytes allocated for rows */
+  long used;          /*!< Stamp of the last time it was got */
+} Layout_entry;
+
+/**
+ * @brief Layout cache
+ */
+struct _Layout_cache
+{
+  Layout_entry entries[LAYOUT_ENTRIES]; /*!< Texts laid out */
+  long clock;                           /*!< Stamp of the last entry got */
+  long layouts;                         /*!< Texts laid out */
+  long hits;                            /*!< Texts taken from the cache */
+};
+
+/**
+ * Private functions
+ */
+unsigned long layout_cache_hash(const char *text, size_t *len);
+STATUS layout_cache_lay_out(Layout_entry *entry, const char *text, size_t len, unsigned long hash, int indent, int width);
+
+/**
+ * @brief Hashes a text (djb2) and measures it in the same pass
+ * @author Miguel Soto
+ *
+ * @param text the text
+ * @param len it gets the length of the text
+ * @return the hash of the text
+ */
+unsigned long layout_cache_hash(const char *text, size_t *len)
+{
+  unsigned long hash = 5381;
+  size_t n;
+
+  for (n = 0; text[n] != '\0'; n++)
+  {
+    hash = hash * 33 + (unsigned char)text[n];
+  }
+  *len = n;
+
+  return hash;
+}
+
+/**
+ * @brief Lays out a text in an entry
+ * @author Miguel Soto
+ *
+ * @param entry where the rows are written
+ * @param text the text
+ * @param len length of the text
+ * @param hash hash of the text
+ * @param indent spaces before the text
+ * @param width columns of the rows
+ * @return OK if everything goes well, or ERROR if there was no memory
+ */
+STATUS layout_cache_lay_out(Layout_entry *entry, const char *text, size_t len, unsigned long hash, int indent, int width)
+{
+  char *rows = NULL;
+  size_t n;
+
+  entry->text = NULL;
+  entry->n_rows = (int)((indent + len + width - 1) / width);
+  n = (size_t)entry->n_rows * width;
+
+  /* The rows and the copy of the text, kept after them, in one block */
+  if (n + len + 2 > entry->size)
+  {
+    rows = (char *)realloc(entry->rows, n + len + 2);
+    if (!rows)
+    {
+      return ERROR;
+    }
+    entry->rows = rows;
+    entry->size = n + len + 2;
+  }
+
+  memset(entry->rows, ' ', n);
+  memcpy(entry->rows + indent, text, len);
+  entry->rows[n] = '\0';
+
+  entry->text = entry->rows + n + 1;
+  memcpy(entry->text, text, len + 1);
+  entry->len = len;
+  entry->hash = hash;
+  entry->indent = indent;
+  entry->width = width;
+
+  return OK;
+}
+
+/**
+ * layout_cache_create allocates an empty cache
+ */
+Layout_cache *layout_cache_create()
+{
+  return (Layout_cache *)calloc(1, sizeof(Layout_cache));
+}
+
+/**
+ * layout_cache_destroy frees the rows of every entry and the cache
+ */
+void layout_cache_destroy(Layout_cache *cache)
+{
+  int i;
+
+  if (!cache)
+  {
+    return;
+  }
+
+  for (i = 0; i < LAYOUT_ENTRIES; i++)
+  {
+    free(cache->entries[i].rows);
+  }
+  free(cache);
+}
+
+/**
+ * layout_cache_get looks for the text by its content and lays it out if it is not there
+ */
+char *layout_cache_get(Layout_cache *cache, const char *text, int indent, int width, int *n_rows)
+{
+  Layout_entry *entry = NULL, *e = NULL;
+  unsigned long hash;
+  size_t len;
+  int i;
+
+  /* Error control */
+  if (!cache || !text || indent < 0 || width <= 0)
+  {
+    return NULL;
+  }
+
+  hash = layout_cache_hash(text, &len);
+  for (i = 0; i < LAYOUT_ENTRIES && !entry; i++)
+  {
+    e = &cache->entries[i];
+    if (e->text && e->hash == hash && e->len == len && e->indent == indent && e->width == width &&
+        memcmp(e->text, text, len) == 0)
+    {
+      entry = e;
+    }
+  }
+
+  if (entry)
+  {
+    cache->hits++;
+  }
+  else
+  {
+    /* A free entry, or else the one used the longest ago */
+    entry = &cache->entries[0];
+    for (i = 1; i < LAYOUT_ENTRIES && entry->text; i++)
+    {
+      e = &cache->entries[i];
+      if (!e->text || e->used < entry->used)
+      {
+        entry = e;
+      }
+    }
+
+    if (layout_cache_lay_out(entry, text, len, hash, indent, width) == ERROR)
+    {
+      return NULL;
+    }
+    cache->layouts++;
+  }
+
+  entry->used = ++cache->clock;
+  if (n_rows)
+  {
+    *n_rows = entry->n_rows;
+  }
+
+  return entry->rows;
+}
+
+/**
+ * It gets the number of texts laid out
+ */
+long layout_cache_get_layouts(Layout_cache *cache)
+{
+  if (!cache)
+  {
+    return -1;
+  }
+
+  return cache->layouts;
+}
+
+/**
+ * It gets the number of texts taken from the cache
+ */
+long layout_cache_get_hits(Layout_cache *cache)
+{
+  if (!cache)
+  {
+    return -1;
+  }
+
+  return cache->hits;
+}
@@ -26,12 +26,21 @@ struct _Link
     Id destination;      /*!< Id to space destination */
     DIRECTION direction; /*!< Defines link's direction */
     LINK_STATUS status;  /*!< Wether link is OPEN or CLOSE */
+    Arena *arena;        /*!< Arena where the link lives (NULL for the heap) */
 };
 
 /**
  * It allocs memory for a new link struct and initialize its members.
  */
 Link *link_create(Id id)
+{
+    return link_create_in(id, NULL);
+}
+
+/**
+ * It creates a link whose memory comes from an arena.
+ */
+Link *link_create_in(Id id, Arena *arena)
 {
     Link *l = NULL;
     int i;
@@ -43,7 +52,7 @@ Link *link_create(Id id)
     }
 
     /* Alloc memory for Link struct */
-    l = (Link *)malloc(sizeof(Link));
+    l = arena ? (Link *)arena_alloc(arena, sizeof(Link)) : (Link *)malloc(sizeof(Link));
     if (!l) /* Error control in malloc */
     {
         return NULL;
@@ -58,6 +67,7 @@ Link *link_create(Id id)
     l->destination = NO_ID;
     l->direction = ND;
     l->status = CLOSE;
+    l->arena = arena;
 
     /* Return initialize link */
     return l;
@@ -74,6 +84,12 @@ STATUS link_destroy(Link *link)
         return ERROR;
     }
 
+    /* It goes away with its arena */
+    if (link->arena)
+    {
+        return OK;
+    }
+
     /* Free pointer to link */
     free(link);
     link = NULL;
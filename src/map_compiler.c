@@ -0,0 +1,611 @@
+/**
+ * @brief It compiles a map file into C tables
+ *
+ * map_compiler reads a map file with the same syntax that game_managment
+ * loads (#t:, #s:, #o:, #p:, #e:, #l: and #i: lines) and writes a C source
+ * with a constant Map_data, so the map can be linked into the binary.
+ *
+ * @file map_compiler.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/map_data.h"
+
+/**
+ * Private functions
+ */
+void map_compiler_emit_str(FILE *out, const char *str, int max_len);
+char *map_compiler_next_tok(char *line, const char *filename, int n_line);
+int map_compiler_spaces(FILE *in, FILE *out, const char *filename);
+int map_compiler_objects(FILE *in, FILE *out, const char *filename);
+int map_compiler_players(FILE *in, FILE *out, const char *filename);
+int map_compiler_enemies(FILE *in, FILE *out, const char *filename);
+int map_compiler_links(FILE *in, FILE *out, const char *filename);
+int map_compiler_inventory(FILE *in, FILE *out, const char *filename);
+int map_compiler_types(FILE *in, FILE *out, const char *filename);
+void map_compiler_table_ref(FILE *out, const char *table, int n);
+
+/**
+ * @brief Main function of the map compiler
+ * @author Miguel Soto
+ *
+ * Syntax: map_compiler <map_file> <output_c_file>
+ *
+ * @param argc number of arguments
+ * @param argv arguments
+ * @return 0 if the map was compiled, 1 if not
+ */
+int main(int argc, char *argv[])
+{
+  FILE *in = NULL, *out = NULL;
+  int n_spaces, n_objects, n_players, n_enemies, n_links, n_inventory, n_types;
+
+  if (argc != 3)
+  {
+    fprintf(stderr, "Use: %s <map_file> <output_c_file>\n", argv[0]);
+    return 1;
+  }
+
+  in = fopen(argv[1], "r");
+  if (!in)
+  {
+    fprintf(stderr, "Error opening map file %s\n", argv[1]);
+    return 1;
+  }
+
+  out = fopen(argv[2], "w");
+  if (!out)
+  {
+    fprintf(stderr, "Error opening output file %s\n", argv[2]);
+    fclose(in);
+    return 1;
+  }
+
+  fprintf(out, "/* Generated by map_compiler from %s. Do not edit. */\n\n", argv[1]);
+  fprintf(out, "#include <stdlib.h>\n#include \"../include/map_data.h\"\n");
+
+  n_spaces = map_compiler_spaces(in, out, argv[1]);
+  n_objects = map_compiler_objects(in, out, argv[1]);
+  n_players = map_compiler_players(in, out, argv[1]);
+  n_enemies = map_compiler_enemies(in, out, argv[1]);
+  n_links = map_compiler_links(in, out, argv[1]);
+  n_inventory = map_compiler_inventory(in, out, argv[1]);
+  n_types = map_compiler_types(in, out, argv[1]);
+
+  if (n_spaces < 0 || n_objects < 0 || n_players < 0 || n_enemies < 0 || n_links < 0 || n_inventory < 0 || n_types < 0)
+  {
+    fclose(in);
+    fclose(out);
+    remove(argv[2]);
+    return 1;
+  }
+
+  fprintf(out, "\nconst Map_data embedded_map =\n{\n");
+  map_compiler_table_ref(out, "map_spaces", n_spaces);
+  map_compiler_table_ref(out, "map_objects", n_objects);
+  map_compiler_table_ref(out, "map_players", n_players);
+  map_compiler_table_ref(out, "map_enemies", n_enemies);
+  map_compiler_table_ref(out, "map_links", n_links);
+  map_compiler_table_ref(out, "map_inventory", n_inventory);
+  map_compiler_table_ref(out, "map_types", n_types);
+  fprintf(out, "};\n");
+
+  fclose(in);
+  fclose(out);
+
+  return 0;
+}
+
+/**
+ * @brief Writes a string as a C literal
+ * @author Miguel Soto
+ *
+ * Non printable and non ASCII bytes are written as octal escapes.
+ *
+ * @param out output file
+ * @param str string to be written
+ * @param max_len maximun number of characters written (-1 for all of them)
+ */
+void map_compiler_emit_str(FILE *out, const char *str, int max_len)
+{
+  int i;
+  unsigned char c;
+
+  fputc('"', out);
+  for (i = 0; str[i] != '\0' && (max_len < 0 || i < max_len); i++)
+  {
+    c = (unsigned char)str[i];
+    if (c == '"' || c == '\\')
+    {
+      fprintf(out, "\\%c", c);
+    }
+    else if (c < 32 || c > 126)
+    {
+      fprintf(out, "\\%03o", c);
+    }
+    else
+    {
+      fputc(c, out);
+    }
+  }
+  fputc('"', out);
+}
+
+/**
+ * @brief Gets the next '|' token of a line, reporting truncated lines
+ * @author Miguel Soto
+ *
+ * @param line line to tokenize the first time, NULL for the next tokens
+ * @param filename map file name (for error messages)
+ * @param n_line line number (for error messages)
+ * @return the token or NULL if the line has no more tokens
+ */
+char *map_compiler_next_tok(char *line, const char *filename, int n_line)
+{
+  char *toks = strtok(line, "|");
+
+  if (!toks)
+  {
+    fprintf(stderr, "%s:%d: missing field\n", filename, n_line);
+  }
+
+  return toks;
+}
+
+/**
+ * @brief Writes the reference to a table in the Map_data initializer
+ * @author Miguel Soto
+ *
+ * @param out output file
+ * @param table name of the table
+ * @param n number of rows of the table
+ */
+void map_compiler_table_ref(FILE *out, const char *table, int n)
+{
+  if (n > 0)
+  {
+    fprintf(out, "  %s, %d,\n", table, n);
+  }
+  else
+  {
+    fprintf(out, "  NULL, 0,\n");
+  }
+}
+
+/**
+ * @brief Compiles the spaces of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of spaces compiled or -1 if there was an error
+ */
+int map_compiler_spaces(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#s:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_space map_spaces[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    for (i = 0; i < 3; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      map_compiler_emit_str(out, toks, -1);
+      fprintf(out, ", ");
+    }
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    fprintf(out, "%ld,\n   {", atol(toks));
+
+    for (i = 0; i < TAM_GDESC_Y; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      map_compiler_emit_str(out, toks, TAM_GDESC_X);
+      fprintf(out, i < TAM_GDESC_Y - 1 ? ", " : "},\n   ");
+    }
+
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    fprintf(out, "%d, ", atoi(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    fprintf(out, "%s},\n", atoi(toks) == 1 ? "TRUE" : "FALSE");
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the objects of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of objects compiled or -1 if there was an error
+ */
+int map_compiler_objects(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#o:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_object map_objects[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    for (i = 0; i < 2; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      map_compiler_emit_str(out, toks, -1);
+      fprintf(out, ", ");
+    }
+
+    /* location, movable, dependency, open, illuminate, turnedon, light_visible, crit, durability */
+    for (i = 0; i < 9; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, i < 8 ? "%ld, " : "%ld},\n", atol(toks));
+    }
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the players of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of players compiled or -1 if there was an error
+ */
+int map_compiler_players(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#p:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_player map_players[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    map_compiler_emit_str(out, toks, -1);
+    fprintf(out, ", ");
+
+    /* location, health, max_objs, crit, base_dmg */
+    for (i = 0; i < 5; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, "%ld, ", atol(toks));
+    }
+
+    fprintf(out, "{");
+    for (i = 0; i < PLAYER_GDESC_Y; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      map_compiler_emit_str(out, toks, PLAYER_GDESC_X);
+      fprintf(out, i < PLAYER_GDESC_Y - 1 ? ", " : "}},\n");
+    }
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the enemies of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of enemies compiled or -1 if there was an error
+ */
+int map_compiler_enemies(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#e:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_enemy map_enemies[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    map_compiler_emit_str(out, toks, -1);
+    fprintf(out, ", ");
+
+    /* location, health, crit, base_dmg */
+    for (i = 0; i < 4; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, "%ld, ", atol(toks));
+    }
+
+    fprintf(out, "{");
+    for (i = 0; i < ENEMY_GDESC_Y; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      map_compiler_emit_str(out, toks, ENEMY_GDESC_X);
+      fprintf(out, i < ENEMY_GDESC_Y - 1 ? ", " : "}},\n");
+    }
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the links of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of links compiled or -1 if there was an error
+ */
+int map_compiler_links(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i, dir;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#l:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_link map_links[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    map_compiler_emit_str(out, toks, -1);
+    fprintf(out, ", ");
+
+    /* start, destination */
+    for (i = 0; i < 2; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, "%ld, ", atol(toks));
+    }
+
+    /* Same direction and status mapping as game_load_link */
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    dir = atoi(toks);
+    fprintf(out, "%d, ", (dir >= N && dir <= D) ? dir : ND);
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    fprintf(out, "%s},\n", atoi(toks) == 1 ? "OPEN_L" : "CLOSE");
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the initial inventory of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of inventory rows compiled or -1 if there was an error
+ */
+int map_compiler_inventory(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#i:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_inventory map_inventory[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%ld, ", atol(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    fprintf(out, "%ld},\n", atol(toks));
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
+
+/**
+ * @brief Compiles the object types of the map
+ * @author Miguel Soto
+ *
+ * @param in map file
+ * @param out output file
+ * @param filename map file name
+ * @return number of object types compiled or -1 if there was an error
+ */
+int map_compiler_types(FILE *in, FILE *out, const char *filename)
+{
+  char line[WORD_SIZE] = "";
+  char *toks = NULL;
+  int n = 0, n_line = 0, i;
+
+  rewind(in);
+  while (fgets(line, WORD_SIZE, in))
+  {
+    n_line++;
+    if (strncmp("#t:", line, 3) != 0)
+    {
+      continue;
+    }
+
+    if (n == 0)
+    {
+      fprintf(out, "\nstatic const Map_type map_types[] =\n{\n");
+    }
+
+    if (!(toks = map_compiler_next_tok(line + 3, filename, n_line)))
+      return -1;
+    fprintf(out, "  {%d, ", atoi(toks));
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    map_compiler_emit_str(out, toks, -1);
+    fprintf(out, ", ");
+
+    /* first, last */
+    for (i = 0; i < 2; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, "%ld, ", atol(toks));
+    }
+
+    if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+      return -1;
+    map_compiler_emit_str(out, toks, -1);
+
+    /* param1, param2 */
+    for (i = 0; i < 2; i++)
+    {
+      if (!(toks = map_compiler_next_tok(NULL, filename, n_line)))
+        return -1;
+      fprintf(out, ", %d", atoi(toks));
+    }
+    fprintf(out, "},\n");
+    n++;
+  }
+
+  if (n > 0)
+  {
+    fprintf(out, "};\n");
+  }
+
+  return n;
+}
@@ -0,0 +1,185 @@
+/**
+ * @brief It implements the registry of object types
+ *
+ * @file obj_type.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include "../include/obj_type.h"
+
+/**
+ * @brief Type of object
+ */
+typedef struct
+{
+  const char *name; /*!< Name of the type (in the string pool), NULL if not registered */
+  Id first;         /*!< Lowest object id of the type */
+  Id last;          /*!< Highest object id of the type */
+  int effect;       /*!< Index of its effect in the table of game_effects */
+  int param1;       /*!< First parameter of the effect */
+  int param2;       /*!< Second parameter of the effect */
+} Obj_type_def;
+
+/**
+ * @brief Registry of object types
+ */
+struct _Obj_types
+{
+  Obj_type_def types[MAX_OBJ_TYPES]; /*!< The types, indexed by type */
+  Strpool *pool;                     /*!< Pool of the names of the types */
+};
+
+/**
+ * obj_type_create creates an empty registry in an arena
+ */
+Obj_types *obj_type_create(Arena *arena, Strpool *pool)
+{
+  Obj_types *types = NULL;
+  int i;
+
+  /* Error control */
+  if (!arena || !pool)
+  {
+    return NULL;
+  }
+
+  types = (Obj_types *)arena_alloc(arena, sizeof(Obj_types));
+  if (!types)
+  {
+    return NULL;
+  }
+
+  for (i = 0; i < MAX_OBJ_TYPES; i++)
+  {
+    types->types[i].name = NULL;
+  }
+  types->pool = pool;
+
+  return types;
+}
+
+/**
+ * obj_type_add adds a type to the registry
+ */
+STATUS obj_type_add(Obj_types *types, Obj_type type, const char *name, Id first, Id last, int effect, int param1, int param2)
+{
+  Obj_type_def *def = NULL;
+
+  /* Error control */
+  if (!types || type < 0 || type >= MAX_OBJ_TYPES || !name || first == NO_ID || last < first || effect < 0)
+  {
+    return ERROR;
+  }
+
+  def = &types->types[type];
+  def->name = strpool_intern(types->pool, name);
+  if (!def->name)
+  {
+    return ERROR;
+  }
+  def->first = first;
+  def->last = last;
+  def->effect = effect;
+  def->param1 = param1;
+  def->param2 = param2;
+
+  return OK;
+}
+
+/**
+ * obj_type_of gets the type of an object
+ */
+Obj_type obj_type_of(Obj_types *types, Id id)
+{
+  int i;
+
+  /* Error control */
+  if (!types)
+  {
+    return UNKNOWN_TYPE;
+  }
+
+  for (i = 0; i < MAX_OBJ_TYPES; i++)
+  {
+    if (types->types[i].name && id >= types->types[i].first && id <= types->types[i].last)
+    {
+      return (Obj_type)i;
+    }
+  }
+
+  return UNKNOWN_TYPE;
+}
+
+/**
+ * It gets the name of a type
+ */
+const char *obj_type_get_name(Obj_types *types, Obj_type type)
+{
+  /* Error control */
+  if (!types || type < 0 || type >= MAX_OBJ_TYPES)
+  {
+    return NULL;
+  }
+
+  return types->types[type].name;
+}
+
+/**
+ * It gets the effect of a type
+ */
+int obj_type_get_effect(Obj_types *types, Obj_type type)
+{
+  /* Error control */
+  if (!obj_type_get_name(types, type))
+  {
+    return OBJ_TYPE_NO_EFFECT;
+  }
+
+  return types->types[type].effect;
+}
+
+/**
+ * It gets a parameter of the effect of a type
+ */
+int obj_type_get_param(Obj_types *types, Obj_type type, int n)
+{
+  /* Error control */
+  if (!obj_type_get_name(types, type) || n < 1 || n > 2)
+  {
+    return -1;
+  }
+
+  return n == 1 ? types->types[type].param1 : types->types[type].param2;
+}
+
+/**
+ * It gets the first object id of a type
+ */
+Id obj_type_get_first(Obj_types *types, Obj_type type)
+{
+  /* Error control */
+  if (!obj_type_get_name(types, type))
+  {
+    return NO_ID;
+  }
+
+  return types->types[type].first;
+}
+
+/**
+ * It gets the last object id of a type
+ */
+Id obj_type_get_last(Obj_types *types, Obj_type type)
+{
+  /* Error control */
+  if (!obj_type_get_name(types, type))
+  {
+    return NO_ID;
+  }
+
+  return types->types[type].last;
+}
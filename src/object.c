@@ -23,7 +23,8 @@ struct _Object
 {
   Id id;                        /*!< Object's id */
   char name[OBJ_NAME_LEN];      /*!< Object name */
-  char description[WORD_SIZE];  /*!< Object description */
+  const char *description;      /*!< Object description (in the string pool) */
+  Obj_type type;                /*!< Type of the object (UNKNOWN_TYPE until its world gives it one) */
   Id location;                  /*!< Object space location */
   BOOL movable;                 /*!< Movable condition of an object (FALSE by default)*/
   Id dependency;                /*!< Dependency condtion of an object (If and object is dependent of another it saves its id here, if not NO_ID) */
@@ -33,11 +34,19 @@ struct _Object
   Light light_visible;          /*!< Tells the light conditions when the object is visible*/
   int Crit_dmg;                 /*!< Critical chance that the object adds to the one who carries it*/
   int Durability;               /*!< Durability points left(-1 if it is not breakable)*/
+  Arena *arena;                 /*!< Arena where the object lives (NULL for the heap) */
 } ;
 
 /** obj_create saves memory for a new object and initializes its parameters
  */
 Object *obj_create(Id id)
+{
+  return obj_create_in(id, NULL);
+}
+
+/** obj_create_in creates an object whose memory comes from an arena
+ */
+Object *obj_create_in(Id id, Arena *arena)
 {
   Object *new_obj = NULL;
 
@@ -47,7 +56,7 @@ Object *obj_create(Id id)
     return NULL;
   }
 
-  new_obj = (Object *)malloc(sizeof(Object));
+  new_obj = arena ? (Object *)arena_alloc(arena, sizeof(Object)) : (Object *)malloc(sizeof(Object));
   if (new_obj == NULL)
   {
     return NULL;
@@ -56,12 +65,14 @@ Object *obj_create(Id id)
   /* Initialization of the object*/
   new_obj->id = id;
   new_obj->name[0] = '\0';
-  new_obj->description[0] = '\0';
+  new_obj->description = "";
+  new_obj->type = UNKNOWN_TYPE;
   new_obj->movable = FALSE;
   new_obj->dependency = NO_ID;
   new_obj->open = NO_ID;
   new_obj->illuminate = FALSE;
   new_obj->turnedon = FALSE;
+  new_obj->arena = arena;
 
   return new_obj;
 }
@@ -76,6 +87,12 @@ STATUS obj_destroy(Object *obj)
     return ERROR;
   }
 
+  /* It goes away with its arena */
+  if (obj->arena)
+  {
+    return OK;
+  }
+
   free(obj);
   obj = NULL;
   return OK;
@@ -173,20 +190,36 @@ const char *obj_get_description(Object *obj)
 
 /** obj_set_description set a new description for an object.
  */
-STATUS obj_set_description(Object *obj, char *description)
+STATUS obj_set_description(Object *obj, Strpool *pool, char *description)
 {
   /* CONTROL ERROR */
-  if (!obj || !description)
+  if (!obj || !pool || !description)
   {
     return ERROR;
   }
 
-  if (!strcpy(obj->description, description))
+  if (!(obj->description = strpool_intern(pool, description)))
   {
     /*CONTROL ERROR*/
+    obj->description = "";
+    return ERROR;
+  }
+
+  return OK;
+}
+
+/** obj_borrow_description points the object at a description that outlives it
+ */
+STATUS obj_borrow_description(Object *obj, const char *description)
+{
+  /* CONTROL ERROR */
+  if (!obj || !description)
+  {
     return ERROR;
   }
 
+  obj->description = description;
+
   return OK;
 }
 
@@ -469,39 +502,30 @@ BOOL obj_is_visible(Object *obj, Light ls)
 
 /** Gets the type (apple, elixir, bed, armour...) of an object
  */
-Obj_type obj_get_type(Id id)
+Obj_type obj_get_type(Object *obj)
 {
-
-  /*Error control*/
-  if (id < 300 || id > 400)
+  /* Error control */
+  if (!obj)
   {
     return UNKNOWN_TYPE;
   }
 
-  if (id - 310 < 0 && id - 310 >= -10) 
-  {
-    return APPLE;
-  } else if (id - 320 < 0 && id - 320 >= -10)
-  {
-    return ELIXIR;
-  } else if (id - 330 < 0 && id - 330 >= -10)
-  {
-    return ARMOR;
-  } else if (id - 340 < 0 && id - 340 >= -10)
-  {
-    return HOOK;
-  } else if (id - 350 < 0 && id - 350 >= -10)
-  {
-    return BED;
-  } else if (id - 360 < 0 && id - 360 >= -10) 
-  {
-    return BREAD_CRUMBS;
-  } else
+  return obj->type;
+}
+
+/** Sets the type of an object
+ */
+STATUS obj_set_type(Object *obj, Obj_type type)
+{
+  /* Error control */
+  if (!obj)
   {
-    return UNKNOWN_TYPE;
+    return ERROR;
   }
 
+  obj->type = type;
 
+  return OK;
 }
 
 /** Gets the critical damage of an object
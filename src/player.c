@@ -30,13 +30,22 @@ struct _Player
   int max_health; /*!< Max player´s health */
   int Crit_dmg;               /*!< Player's crit chance (scale 0 to 10) */
   int base_dmg;               /*!< Player's base damage */
-  char **gdesc;   /*!< Graphic visualization player */
+  const Atlas_row *gdesc; /*!< Tile of the graphic visualization in the atlas (NULL if none) */
+  Arena *arena;   /*!< Arena where the player lives (NULL for the heap) */
 } ;
 
 /** player_create allocates memory for a new player
  * and initializes all its members
  */
 Player *player_create(Id id)
+{
+  return player_create_in(id, NULL);
+}
+
+/** player_create_in creates a player whose memory
+ * comes from an arena
+ */
+Player *player_create_in(Id id, Arena *arena)
 {
   Player *new_player = NULL;
 
@@ -46,7 +55,7 @@ Player *player_create(Id id)
       return NULL;
   }
 
-  new_player = (Player *) malloc(sizeof(Player));
+  new_player = arena ? (Player *) arena_alloc(arena, sizeof(Player)) : (Player *) malloc(sizeof(Player));
 	/*Error control */
   if (new_player == NULL)
   {
@@ -59,8 +68,9 @@ Player *player_create(Id id)
   new_player->name[0] = '\0';
   new_player->location = NO_ID;
   new_player->max_health = 10;
-  new_player->inventory = inventory_create();
+  new_player->inventory = inventory_create_in(arena);
   new_player->gdesc = NULL;
+  new_player->arena = arena;
 
   return new_player;
 }
@@ -75,17 +85,18 @@ STATUS player_destroy(Player *player)
   {
     return ERROR;
   }
+
+  /* It goes away with its arena */
+  if (player->arena)
+  {
+    return OK;
+  }
   
   if (player->inventory != NULL) {
     inventory_destroy(player->inventory);
     player->inventory = NULL;
   }
-	
-  if (player->gdesc)
-  {
-    player_destroy_gdesc(player->gdesc);
-  }
-  
+
   free(player);
   player = NULL;
   return OK;
@@ -215,8 +226,7 @@ STATUS player_add_object(Player *player, Object *object)
     return ERROR;
   }
   
-  inventory_add_object(player->inventory, obj_get_id(object));
-  return OK;
+  return inventory_add_object(player->inventory, object);
 }
 
 /** Removes an object from a player's inventory
@@ -332,6 +342,7 @@ STATUS player_print_save(char *filename, Player *player)
 {
   int i, j;
   FILE *file = NULL;
+  const Atlas_row *gdesc = NULL;
 
   file = fopen(filename, "a");
 
@@ -343,11 +354,12 @@ STATUS player_print_save(char *filename, Player *player)
 
   fprintf(file, "#p:%ld|%s|%ld|%d|%d|%d|%d|", player->id, player->name, player->location, player->health, inventory_get_maxObjs(player->inventory), player->Crit_dmg, player->base_dmg);
 
-  for (i = 0; i < PLAYER_GDESC_Y && player->gdesc[i]; i++)
+  gdesc = player->gdesc;
+  for (i = 0; i < PLAYER_GDESC_Y && gdesc; i++)
   {
-    for (j = 0; j < PLAYER_GDESC_X && player->gdesc[i][j]; j++)
+    for (j = 0; j < PLAYER_GDESC_X && gdesc[i][j]; j++)
     {
-      fprintf(file, "%c", player->gdesc[i][j]);
+      fprintf(file, "%c", gdesc[i][j]);
     }
     fprintf(file, "|");
   }
@@ -450,20 +462,25 @@ STATUS player_destroy_gdesc(char **gdesc)
 /**
  * It gets the graphic description from a player.
  */
-STATUS player_set_gdesc(Player *p, char **newgdesc)
+STATUS player_set_gdesc(Player *p, Atlas *atlas, char **newgdesc)
 {
   /* Error control*/
-  if (!p || !newgdesc)
+  if (!p || !atlas || !newgdesc)
   {
     return ERROR;
   }
 
-  p->gdesc = newgdesc;
+  /* The rows are copied, newgdesc still belongs to the caller */
+  p->gdesc = atlas_add(atlas, (const char **)newgdesc, PLAYER_GDESC_Y, PLAYER_GDESC_X);
+  if (!p->gdesc)
+  {
+    return ERROR;
+  }
 
   return OK;
 }
 
-char **player_get_gdesc(Player *p)
+const Atlas_row *player_get_gdesc(Player *p)
 {
   /* Error control*/
   if (!p)
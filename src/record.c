@@ -0,0 +1,690 @@
+/**
+ * @brief It implements the recording of the frames of a session
+ *
+ * A record file is:
+ *
+ *   "JREC", version (1 byte), rows, columns, RECORD_KEY_EVERY (varints)
+ *   each frame: 'K' or 'D' (1 byte), bytes of its spans (varint), its spans
+ *   when closed: 'I', frames, keyframes, offset of each keyframe (varints),
+ *                offset of the 'I' (8 bytes, the most significant first), "JIDX"
+ *
+ * @file record.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "../include/record.h"
+#include "../include/container.h"
+
+#define RECORD_MAGIC "JREC"      /*!< First bytes of a record */
+#define RECORD_INDEX_MAGIC "JIDX"/*!< Last bytes of a closed record */
+#define RECORD_VERSION 1         /*!< Version of the format */
+#define RECORD_KEY 'K'           /*!< Keyframe */
+#define RECORD_DELTA 'D'         /*!< Changes from the frame before */
+#define RECORD_INDEX 'I'         /*!< List of keyframes */
+#define RECORD_TRAILER 12        /*!< Bytes of the offset of the list and its magic */
+#define RECORD_GAP 3             /*!< Unchanged cells kept in a span rather than starting another one */
+#define RECORD_VARINT 10         /*!< Most bytes of a varint */
+
+VECTOR_DECLARE(Record_keys, long);
+VECTOR_DEFINE(Record_keys, long);
+
+/**
+ * @brief Record
+ */
+struct _Record
+{
+  FILE *f;               /*!< File of the record */
+  BOOL writing;          /*!< TRUE if it was created, FALSE if it was opened */
+  int rows;              /*!< Rows of the screen */
+  int columns;           /*!< Columns of the screen */
+  int key_every;         /*!< Frames from a keyframe to the next one */
+  char *cells;           /*!< Last frame written or decoded */
+  char *blank;           /*!< An empty screen, what keyframes are compared with */
+  unsigned char *buf;    /*!< Spans of a frame */
+  size_t max_buf;        /*!< Size of buf */
+  long frames;           /*!< Frames in the record */
+  Record_keys keys;      /*!< Offset of each keyframe */
+  long offset;           /*!< Offset of the next frame (written or to decode) */
+  long current;          /*!< Frame in cells, -1 if none */
+  long decoded;          /*!< Frames decoded by the last seek */
+  long bytes;            /*!< Bytes of the frames written */
+  clock_t ticks;         /*!< Processor time writing frames */
+};
+
+/**
+ * Private functions
+ */
+Record *record_alloc(int rows, int columns);
+size_t record_put_varint(unsigned char *dest, unsigned long x);
+STATUS record_read_varint(FILE *f, unsigned long *x);
+STATUS record_get_varint(const unsigned char **p, const unsigned char *end, unsigned long *x);
+size_t record_encode(Record *record, const char *cells, BOOL key);
+STATUS record_decode(Record *record, size_t len);
+STATUS record_index(Record *record, long size);
+STATUS record_scan(Record *record, long size);
+
+/**
+ * @brief Allocates a record with no frames
+ * @author Miguel Soto
+ *
+ * @param rows rows of the screen
+ * @param columns columns of the screen
+ * @return a pointer to the new record or NULL if anything went wrong
+ */
+Record *record_alloc(int rows, int columns)
+{
+  Record *record = NULL;
+  size_t n;
+
+  /* Error control */
+  if (rows <= 0 || columns <= 0)
+  {
+    return NULL;
+  }
+
+  record = (Record *)calloc(1, sizeof(Record));
+  if (!record)
+  {
+    return NULL;
+  }
+
+  /* A span for each changed cell at most, each one of RECORD_GAP + 1 cells */
+  n = (size_t)rows * columns;
+  record->rows = rows;
+  record->columns = columns;
+  record->key_every = RECORD_KEY_EVERY;
+  record->current = -1;
+  record->max_buf = n + (n / (RECORD_GAP + 1) + 1) * 2 * RECORD_VARINT;
+  record->cells = (char *)malloc(n);
+  record->blank = (char *)malloc(n);
+  record->buf = (unsigned char *)malloc(record->max_buf);
+  if (!record->cells || !record->blank || !record->buf || Record_keys_init(&record->keys, NULL) == ERROR)
+  {
+    free(record->cells);
+    free(record->blank);
+    free(record->buf);
+    free(record);
+    return NULL;
+  }
+  memset(record->cells, RECORD_BG_CHAR, n);
+  memset(record->blank, RECORD_BG_CHAR, n);
+
+  return record;
+}
+
+/**
+ * @brief Writes an unsigned varint, 7 bits in each byte, the least significant first
+ * @author Miguel Soto
+ *
+ * @param dest where it is written (RECORD_VARINT bytes at most)
+ * @param x the number
+ * @return bytes written
+ */
+size_t record_put_varint(unsigned char *dest, unsigned long x)
+{
+  size_t n = 0;
+
+  while (x >= 0x80)
+  {
+    dest[n++] = (unsigned char)(x | 0x80);
+    x >>= 7;
+  }
+  dest[n++] = (unsigned char)x;
+
+  return n;
+}
+
+/**
+ * @brief Reads an unsigned varint from a file
+ * @author Miguel Soto
+ *
+ * @param f the file
+ * @param x where the number is read
+ * @return OK if everything goes well, or ERROR if the file ends before it
+ */
+STATUS record_read_varint(FILE *f, unsigned long *x)
+{
+  int c, shift = 0;
+
+  *x = 0;
+  do
+  {
+    c = fgetc(f);
+    if (c == EOF || shift >= 7 * RECORD_VARINT)
+    {
+      return ERROR;
+    }
+    *x |= (unsigned long)(c & 0x7f) << shift;
+    shift += 7;
+  } while (c & 0x80);
+
+  return OK;
+}
+
+/**
+ * @brief Gets an unsigned varint from a buffer
+ * @author Miguel Soto
+ *
+ * @param p position in the buffer, moved past the varint
+ * @param end end of the buffer
+ * @param x where the number is read
+ * @return OK if everything goes well, or ERROR if the buffer ends before it
+ */
+STATUS record_get_varint(const unsigned char **p, const unsigned char *end, unsigned long *x)
+{
+  int shift = 0;
+
+  *x = 0;
+  do
+  {
+    if (*p >= end || shift >= 7 * RECORD_VARINT)
+    {
+      return ERROR;
+    }
+    *x |= (unsigned long)(**p & 0x7f) << shift;
+    shift += 7;
+  } while (*(*p)++ & 0x80);
+
+  return OK;
+}
+
+/**
+ * @brief Writes the spans of a frame in the buffer of a record
+ * @author Miguel Soto
+ *
+ * @param record the record, its cells are the frame before
+ * @param cells the frame
+ * @param key TRUE to take the spans from an empty screen
+ * @return bytes of the spans
+ */
+size_t record_encode(Record *record, const char *cells, BOOL key)
+{
+  const char *prev = key ? record->blank : record->cells;
+  size_t len = 0;
+  int n = record->rows * record->columns, end = 0, i, j, last;
+
+  for (i = 0; i < n; i++)
+  {
+    /* Most rows do not change from a frame to the next one */
+    while (i % record->columns == 0 && i < n && memcmp(cells + i, prev + i, record->columns) == 0)
+    {
+      i += record->columns;
+    }
+    if (i >= n || cells[i] == prev[i])
+    {
+      continue;
+    }
+
+    /* A span of changes, joined while the gaps between them are short */
+    last = i;
+    for (j = i + 1; j < n && j - last <= RECORD_GAP; j++)
+    {
+      if (cells[j] != prev[j])
+      {
+        last = j;
+      }
+    }
+
+    len += record_put_varint(record->buf + len, i - end);
+    len += record_put_varint(record->buf + len, last - i + 1);
+    memcpy(record->buf + len, cells + i, last - i + 1);
+    len += last - i + 1;
+    end = last + 1;
+    i = last;
+  }
+
+  return len;
+}
+
+/**
+ * @brief Applies the spans in the buffer of a record to its cells
+ * @author Miguel Soto
+ *
+ * @param record the record
+ * @param len bytes of the spans
+ * @return OK if everything goes well, or ERROR if the spans are damaged
+ */
+STATUS record_decode(Record *record, size_t len)
+{
+  const unsigned char *p = record->buf, *end = record->buf + len;
+  unsigned long skip, count, pos = 0, n = (unsigned long)record->rows * record->columns;
+
+  while (p < end)
+  {
+    if (record_get_varint(&p, end, &skip) == ERROR || record_get_varint(&p, end, &count) == ERROR)
+    {
+      return ERROR;
+    }
+
+    pos += skip;
+    if (pos > n || count > n - pos || count > (unsigned long)(end - p))
+    {
+      return ERROR;
+    }
+    memcpy(record->cells + pos, p, count);
+    p += count;
+    pos += count;
+  }
+
+  return OK;
+}
+
+/**
+ * @brief Reads the list of keyframes of a closed record
+ * @author Miguel Soto
+ *
+ * @param record the record, its header already read
+ * @param size bytes of the file
+ * @return OK if it was read, or ERROR if the record was not closed
+ */
+STATUS record_index(Record *record, long size)
+{
+  unsigned char trailer[RECORD_TRAILER];
+  unsigned long frames, n, offset;
+  long index = 0;
+  int i;
+
+  if (size < record->offset + RECORD_TRAILER || fseek(record->f, size - RECORD_TRAILER, SEEK_SET) != 0 ||
+      fread(trailer, 1, RECORD_TRAILER, record->f) != RECORD_TRAILER || memcmp(trailer + 8, RECORD_INDEX_MAGIC, 4) != 0)
+  {
+    return ERROR;
+  }
+
+  for (i = 0; i < 8; i++)
+  {
+    index = (index << 8) | trailer[i];
+  }
+  if (index < record->offset || index > size - RECORD_TRAILER || fseek(record->f, index, SEEK_SET) != 0 ||
+      fgetc(record->f) != RECORD_INDEX || record_read_varint(record->f, &frames) == ERROR || record_read_varint(record->f, &n) == ERROR)
+  {
+    return ERROR;
+  }
+
+  Record_keys_clear(&record->keys);
+  for (i = 0; i < (long)n; i++)
+  {
+    if (record_read_varint(record->f, &offset) == ERROR || (long)offset >= index || Record_keys_push(&record->keys, (long)offset) == ERROR)
+    {
+      return ERROR;
+    }
+  }
+  record->frames = (long)frames;
+
+  return OK;
+}
+
+/**
+ * @brief Lists the keyframes of a record by walking over its frames
+ * @author Miguel Soto
+ *
+ * Only the type and the size of each frame are read. A frame cut by the
+ * end of the file ends the record.
+ *
+ * @param record the record, its header already read
+ * @param size bytes of the file
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS record_scan(Record *record, long size)
+{
+  unsigned long len;
+  long offset = record->offset;
+  int type;
+
+  Record_keys_clear(&record->keys);
+  record->frames = 0;
+  if (fseek(record->f, offset, SEEK_SET) != 0)
+  {
+    return ERROR;
+  }
+
+  while ((type = fgetc(record->f)) == RECORD_KEY || type == RECORD_DELTA)
+  {
+    if (record_read_varint(record->f, &len) == ERROR || len > record->max_buf || ftell(record->f) + (long)len > size)
+    {
+      break;
+    }
+    if (type == RECORD_KEY && Record_keys_push(&record->keys, offset) == ERROR)
+    {
+      return ERROR;
+    }
+    fseek(record->f, (long)len, SEEK_CUR);
+    offset = ftell(record->f);
+    record->frames++;
+  }
+
+  return OK;
+}
+
+/**
+ * record_create opens a file to record frames in
+ */
+Record *record_create(const char *path, int rows, int columns)
+{
+  Record *record = NULL;
+  unsigned char header[4 + 1 + 3 * RECORD_VARINT];
+  size_t n = 0;
+
+  /* Error control */
+  if (!path)
+  {
+    return NULL;
+  }
+
+  record = record_alloc(rows, columns);
+  if (!record)
+  {
+    return NULL;
+  }
+
+  record->writing = TRUE;
+  record->f = fopen(path, "wb");
+  if (!record->f)
+  {
+    record_close(record);
+    return NULL;
+  }
+
+  memcpy(header, RECORD_MAGIC, 4);
+  n = 4;
+  header[n++] = RECORD_VERSION;
+  n += record_put_varint(header + n, rows);
+  n += record_put_varint(header + n, columns);
+  n += record_put_varint(header + n, record->key_every);
+  if (fwrite(header, 1, n, record->f) != n)
+  {
+    record_close(record);
+    return NULL;
+  }
+  record->offset = (long)n;
+
+  return record;
+}
+
+/**
+ * record_open reads the header and the keyframes of a record
+ */
+Record *record_open(const char *path)
+{
+  Record *record = NULL;
+  FILE *f = NULL;
+  char magic[4];
+  unsigned long rows, columns, key_every;
+  long size;
+
+  /* Error control */
+  if (!path || !(f = fopen(path, "rb")))
+  {
+    return NULL;
+  }
+
+  if (fread(magic, 1, 4, f) != 4 || memcmp(magic, RECORD_MAGIC, 4) != 0 || fgetc(f) != RECORD_VERSION ||
+      record_read_varint(f, &rows) == ERROR || record_read_varint(f, &columns) == ERROR || record_read_varint(f, &key_every) == ERROR ||
+      rows > 0xffff || columns > 0xffff || key_every == 0 || !(record = record_alloc((int)rows, (int)columns)))
+  {
+    fclose(f);
+    return NULL;
+  }
+
+  record->f = f;
+  record->writing = FALSE;
+  record->key_every = (int)key_every;
+  record->offset = ftell(f);
+
+  fseek(f, 0, SEEK_END);
+  size = ftell(f);
+  if (record_index(record, size) == ERROR && record_scan(record, size) == ERROR)
+  {
+    record_close(record);
+    return NULL;
+  }
+
+  return record;
+}
+
+/**
+ * record_close writes the list of keyframes of a record being written, and frees it
+ */
+void record_close(Record *record)
+{
+  unsigned char *buf = NULL;
+  size_t n = 0;
+  int i;
+
+  if (!record)
+  {
+    return;
+  }
+
+  if (record->f && record->writing)
+  {
+    buf = (unsigned char *)malloc(1 + (record->keys.size + 2) * RECORD_VARINT + RECORD_TRAILER);
+    if (buf)
+    {
+      buf[n++] = RECORD_INDEX;
+      n += record_put_varint(buf + n, record->frames);
+      n += record_put_varint(buf + n, record->keys.size);
+      for (i = 0; i < record->keys.size; i++)
+      {
+        n += record_put_varint(buf + n, record->keys.data[i]);
+      }
+      for (i = 7; i >= 0; i--)
+      {
+        buf[n++] = (unsigned char)((unsigned long)record->offset >> (8 * i));
+      }
+      memcpy(buf + n, RECORD_INDEX_MAGIC, 4);
+      n += 4;
+      fwrite(buf, 1, n, record->f);
+      free(buf);
+    }
+  }
+
+  if (record->f)
+  {
+    fclose(record->f);
+  }
+  Record_keys_free(&record->keys);
+  free(record->cells);
+  free(record->blank);
+  free(record->buf);
+  free(record);
+}
+
+/**
+ * record_frame writes a frame, as a keyframe or as its changes
+ */
+STATUS record_frame(Record *record, const char *cells)
+{
+  unsigned char head[1 + RECORD_VARINT];
+  clock_t start;
+  size_t len, n;
+  BOOL key;
+
+  /* Error control */
+  if (!record || !record->writing || !cells)
+  {
+    return ERROR;
+  }
+
+  start = clock();
+
+  key = (record->frames % record->key_every == 0) ? TRUE : FALSE;
+  len = record_encode(record, cells, key);
+  head[0] = key ? RECORD_KEY : RECORD_DELTA;
+  n = 1 + record_put_varint(head + 1, len);
+  if ((key && Record_keys_push(&record->keys, record->offset) == ERROR) ||
+      fwrite(head, 1, n, record->f) != n || fwrite(record->buf, 1, len, record->f) != len)
+  {
+    return ERROR;
+  }
+
+  memcpy(record->cells, cells, (size_t)record->rows * record->columns);
+  record->current = record->frames;
+  record->frames++;
+  record->offset += (long)(n + len);
+  record->bytes += (long)(n + len);
+  record->ticks += clock() - start;
+
+  return OK;
+}
+
+/**
+ * record_seek decodes a frame from the closest frame before it that can be decoded alone
+ */
+STATUS record_seek(Record *record, long frame)
+{
+  unsigned long len;
+  long first, i;
+  int type;
+
+  /* Error control */
+  if (!record || record->writing || frame < 0 || frame >= record->frames)
+  {
+    return ERROR;
+  }
+
+  record->decoded = 0;
+  first = frame - frame % record->key_every;
+  if (record->current >= first && record->current <= frame)
+  {
+    /* Going on from the frame already decoded is as close */
+    first = record->current + 1;
+  }
+  else
+  {
+    if (frame / record->key_every >= record->keys.size)
+    {
+      return ERROR;
+    }
+    record->offset = record->keys.data[frame / record->key_every];
+    record->current = -1;
+  }
+
+  if (fseek(record->f, record->offset, SEEK_SET) != 0)
+  {
+    return ERROR;
+  }
+
+  for (i = first; i <= frame; i++)
+  {
+    type = fgetc(record->f);
+    if ((type != RECORD_KEY && type != RECORD_DELTA) || (type == RECORD_KEY) != (i % record->key_every == 0) ||
+        record_read_varint(record->f, &len) == ERROR || len > record->max_buf || fread(record->buf, 1, len, record->f) != len)
+    {
+      record->current = -1;
+      return ERROR;
+    }
+
+    if (type == RECORD_KEY)
+    {
+      memset(record->cells, RECORD_BG_CHAR, (size_t)record->rows * record->columns);
+    }
+    if (record_decode(record, len) == ERROR)
+    {
+      record->current = -1;
+      return ERROR;
+    }
+    record->current = i;
+    record->decoded++;
+  }
+  record->offset = ftell(record->f);
+
+  return OK;
+}
+
+/**
+ * It gets the cells of the last frame decoded or written
+ */
+const char *record_get_cells(Record *record)
+{
+  if (!record)
+  {
+    return NULL;
+  }
+
+  return record->cells;
+}
+
+/**
+ * It gets the frames of a record
+ */
+long record_get_frames(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return record->frames;
+}
+
+/**
+ * It gets the frames decoded by the last seek
+ */
+long record_get_decoded(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return record->decoded;
+}
+
+/**
+ * It gets the rows of the screen
+ */
+int record_get_rows(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return record->rows;
+}
+
+/**
+ * It gets the columns of the screen
+ */
+int record_get_columns(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return record->columns;
+}
+
+/**
+ * It gets the bytes of the frames written
+ */
+long record_get_bytes(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return record->bytes;
+}
+
+/**
+ * It gets the time spent writing frames
+ */
+double record_get_time(Record *record)
+{
+  if (!record)
+  {
+    return -1;
+  }
+
+  return (double)record->ticks / CLOCKS_PER_SEC;
+}
@@ -0,0 +1,132 @@
+/**
+ * @brief It plays the record of a session
+ *
+ * record_player paints the frames of a record made with --record, without
+ * running the game again. Given a frame, it paints that one and ends.
+ * Otherwise it paints the first frame and reads what to do from the
+ * standard input, a line each time:
+ *
+ *   (empty line) next frame, "p" frame before, a number that frame, "q" quit
+ *
+ * @file record_player.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include "../include/record.h"
+#include "../include/frame.h"
+
+/**
+ * Private functions
+ */
+STATUS record_player_show(Record *record, Frame *frame, long n);
+
+/**
+ * @brief Paints a frame of a record, with its number below
+ * @author Miguel Soto
+ *
+ * @param record the record
+ * @param frame what is on the terminal
+ * @param n the frame
+ * @return OK if it was painted, or ERROR if it could not be decoded
+ */
+STATUS record_player_show(Record *record, Frame *frame, long n)
+{
+  if (record_seek(record, n) == ERROR)
+  {
+    fprintf(stderr, "Frame %ld can not be read\n", n);
+    return ERROR;
+  }
+
+  frame_load(frame, record_get_cells(record));
+  frame_paint(frame, STDOUT_FILENO);
+  printf("frame %ld of %ld (%ld decoded)> ", n, record_get_frames(record), record_get_decoded(record));
+  fflush(stdout);
+
+  return OK;
+}
+
+/**
+ * @brief Main function of the record player
+ * @author Miguel Soto
+ *
+ * Syntax: record_player <record> [<frame>]
+ *
+ * @param argc number of arguments
+ * @param argv arguments
+ * @return 0 if the record was played, 1 if not
+ */
+int main(int argc, char *argv[])
+{
+  Record *record = NULL;
+  Frame *frame = NULL;
+  char line[64];
+  long n = 0, last;
+  int st = 0;
+
+  if (argc != 2 && argc != 3)
+  {
+    fprintf(stderr, "Use: %s <record> [<frame>]\n", argv[0]);
+    return 1;
+  }
+
+  record = record_open(argv[1]);
+  if (!record)
+  {
+    fprintf(stderr, "Error opening record %s\n", argv[1]);
+    return 1;
+  }
+  last = record_get_frames(record) - 1;
+  if (last < 0)
+  {
+    fprintf(stderr, "Record %s has no frames\n", argv[1]);
+    record_close(record);
+    return 1;
+  }
+
+  frame = frame_create(record_get_rows(record), record_get_columns(record));
+  if (!frame)
+  {
+    record_close(record);
+    return 1;
+  }
+
+  if (argc == 3)
+  {
+    st = record_player_show(record, frame, atol(argv[2])) == OK ? 0 : 1;
+    printf("\n");
+  }
+  else if (record_player_show(record, frame, n) == OK)
+  {
+    while (fgets(line, sizeof(line), stdin) && line[0] != 'q')
+    {
+      if (isdigit((unsigned char)line[0]))
+      {
+        n = atol(line);
+      }
+      else if (line[0] == 'p')
+      {
+        n--;
+      }
+      else
+      {
+        n++;
+      }
+      n = n < 0 ? 0 : (n > last ? last : n);
+      record_player_show(record, frame, n);
+    }
+    printf("\n");
+  }
+
+  frame_destroy(frame);
+  record_close(record);
+
+  return st;
+}
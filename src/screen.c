@@ -0,0 +1,325 @@
+/**
+ * @brief It implements the screen interface with a single buffered write
+ *
+ * @file screen.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "../include/screen.h"
+#include "../include/types.h"
+
+#define SCREEN_CLEAR "\033[2J\n"       /*!< Output before the cells, the same puts() of libscreen */
+#define SCREEN_SGR_BG "\033[0;34;44m"  /*!< Colour of the background cells */
+#define SCREEN_SGR_FG "\033[0;30;47m"  /*!< Colour of the rest of the cells */
+#define SCREEN_SGR_END "\033[0m"       /*!< Colour reset after each cell */
+#define SCREEN_SGR_LEN 10              /*!< Bytes of SCREEN_SGR_BG and SCREEN_SGR_FG */
+#define SCREEN_END_LEN 4               /*!< Bytes of SCREEN_SGR_END */
+#define SCREEN_SPECIAL "ÁÉÍÓÚÑáéíóúñ"  /*!< Characters the terminal may not show (two bytes each) */
+#define SCREEN_REPLACEMENT "??"        /*!< What each byte pair of a special character becomes */
+
+/**
+ * @brief Area of the screen
+ *
+ * The cursor points to the cell where the next line is written.
+ */
+struct _Area
+{
+  int x;        /*!< Column of the up-left corner */
+  int y;        /*!< Row of the up-left corner */
+  int width;    /*!< Columns of the area */
+  int height;   /*!< Rows of the area */
+  char *cursor; /*!< Cell of the next line */
+};
+
+char *__data = NULL; /*!< Screen (rows * columns cells, row after row), the name libscreen gives it */
+
+static int screen_rows = 0;     /*!< Rows of the screen */
+static int screen_columns = 0;  /*!< Columns of the screen */
+static char *screen_out = NULL; /*!< Output buffer, it fits a full repaint */
+static long screen_paints = 0;  /*!< Paints since the last reset */
+static long screen_bytes = 0;   /*!< Bytes painted since the last reset */
+static clock_t screen_ticks = 0;/*!< Processor time painting since the last reset */
+
+/**
+ * Private functions
+ */
+BOOL screen_area_cursor_is_out_of_bounds(Area *area);
+void screen_area_scroll_up(Area *area);
+void screen_utils_replaces_special_chars(char *str);
+
+/**
+ * @brief Tells if the cursor of an area is below its last row
+ * @author Miguel Soto
+ *
+ * @param area the area
+ * @return TRUE if the next line does not fit, FALSE if it does
+ */
+BOOL screen_area_cursor_is_out_of_bounds(Area *area)
+{
+  return area->cursor > __data + screen_columns * (area->y + area->height - 1) + area->x + area->width ? TRUE : FALSE;
+}
+
+/**
+ * @brief Moves every row of an area one row up
+ * @author Miguel Soto
+ *
+ * The cursor is left on the last row, whose old line is kept until the
+ * next one is written over it.
+ *
+ * @param area the area
+ */
+void screen_area_scroll_up(Area *area)
+{
+  area->cursor = __data + screen_columns * area->y + area->x;
+  while (area->cursor < __data + screen_columns * (area->y + area->height - 2) + area->x + area->width)
+  {
+    memcpy(area->cursor, area->cursor + screen_columns, area->width);
+    area->cursor += screen_columns;
+  }
+}
+
+/**
+ * @brief Replaces the special characters of a string, in place
+ * @author Miguel Soto
+ *
+ * @param str the string
+ */
+void screen_utils_replaces_special_chars(char *str)
+{
+  char *p = NULL;
+
+  while ((p = strpbrk(str, SCREEN_SPECIAL)) != NULL)
+  {
+    memcpy(p, SCREEN_REPLACEMENT, 2);
+  }
+}
+
+/**
+ * screen_init allocates the cells and the output buffer of a screen
+ */
+void screen_init(int rows, int columns)
+{
+  size_t n;
+
+  screen_destroy();
+
+  /* Error control */
+  if (rows <= 0 || columns <= 0)
+  {
+    return;
+  }
+
+  n = (size_t)rows * columns;
+  __data = (char *)malloc(n + 1);
+  screen_out = (char *)malloc(strlen(SCREEN_CLEAR) + rows * (columns * (SCREEN_SGR_LEN + 1 + SCREEN_END_LEN) + 1));
+  if (!__data || !screen_out)
+  {
+    screen_destroy();
+    return;
+  }
+
+  screen_rows = rows;
+  screen_columns = columns;
+  memset(__data, SCREEN_BG_CHAR, n);
+  __data[n] = '\0';
+}
+
+/**
+ * screen_destroy frees the screen
+ */
+void screen_destroy()
+{
+  free(__data);
+  free(screen_out);
+  __data = NULL;
+  screen_out = NULL;
+  screen_rows = 0;
+  screen_columns = 0;
+}
+
+/**
+ * screen_paint sends every cell, the same bytes as libscreen but in one write()
+ */
+void screen_paint()
+{
+  clock_t start;
+  const char *cell = NULL, *end = NULL;
+  char *out = NULL;
+  size_t len, sent = 0;
+  long n;
+
+  if (!__data)
+  {
+    return;
+  }
+
+  start = clock();
+
+  out = screen_out;
+  memcpy(out, SCREEN_CLEAR, strlen(SCREEN_CLEAR));
+  out += strlen(SCREEN_CLEAR);
+  for (cell = __data, end = __data + screen_rows * screen_columns; cell < end;)
+  {
+    memcpy(out, *cell == SCREEN_BG_CHAR ? SCREEN_SGR_BG : SCREEN_SGR_FG, SCREEN_SGR_LEN);
+    out += SCREEN_SGR_LEN;
+    *out++ = *cell++;
+    memcpy(out, SCREEN_SGR_END, SCREEN_END_LEN);
+    out += SCREEN_END_LEN;
+    if ((cell - __data) % screen_columns == 0)
+    {
+      *out++ = '\n';
+    }
+  }
+  len = out - screen_out;
+
+  /* What was printed before goes out first */
+  fflush(stdout);
+  while (sent < len)
+  {
+    n = (long)write(STDOUT_FILENO, screen_out + sent, len - sent);
+    if (n <= 0)
+    {
+      break;
+    }
+    sent += n;
+  }
+
+  screen_paints++;
+  screen_bytes += (long)sent;
+  screen_ticks += clock() - start;
+}
+
+/**
+ * screen_area_init creates an area and blanks its cells
+ */
+Area *screen_area_init(int x, int y, int width, int height)
+{
+  Area *area = NULL;
+  int i;
+
+  area = (Area *)malloc(sizeof(Area));
+  if (!area)
+  {
+    return NULL;
+  }
+
+  area->x = x;
+  area->y = y;
+  area->width = width;
+  area->height = height;
+  area->cursor = __data + screen_columns * y + x;
+  for (i = 0; i < height; i++)
+  {
+    memset(area->cursor + screen_columns * i, ' ', width);
+  }
+
+  return area;
+}
+
+/**
+ * screen_area_destroy frees an area
+ */
+void screen_area_destroy(Area *area)
+{
+  free(area);
+}
+
+/**
+ * screen_area_clear blanks the cells of an area
+ */
+void screen_area_clear(Area *area)
+{
+  int i;
+
+  if (!area)
+  {
+    return;
+  }
+
+  screen_area_reset_cursor(area);
+  for (i = 0; i < area->height; i++)
+  {
+    memset(area->cursor + screen_columns * i, ' ', area->width);
+  }
+}
+
+/**
+ * screen_area_reset_cursor takes the cursor to the first row of an area
+ */
+void screen_area_reset_cursor(Area *area)
+{
+  if (!area)
+  {
+    return;
+  }
+
+  area->cursor = __data + screen_columns * area->y + area->x;
+}
+
+/**
+ * screen_area_puts writes a line, as many rows as it needs, scrolling when full
+ */
+void screen_area_puts(Area *area, char *str)
+{
+  char *ptr = NULL;
+  size_t len;
+  int n;
+
+  if (screen_area_cursor_is_out_of_bounds(area) == TRUE)
+  {
+    screen_area_scroll_up(area);
+  }
+
+  screen_utils_replaces_special_chars(str);
+
+  len = strlen(str);
+  for (ptr = str; ptr < str + len; ptr += area->width)
+  {
+    memset(area->cursor, ' ', area->width);
+    n = (size_t)(str + len - ptr) < (size_t)area->width ? (int)(str + len - ptr) : area->width;
+    memcpy(area->cursor, ptr, n);
+    area->cursor += screen_columns;
+  }
+}
+
+/**
+ * It gets the number of paints
+ */
+long screen_get_paints()
+{
+  return screen_paints;
+}
+
+/**
+ * It gets the bytes painted
+ */
+long screen_get_bytes()
+{
+  return screen_bytes;
+}
+
+/**
+ * It gets the time spent painting
+ */
+double screen_get_paint_time()
+{
+  return (double)screen_ticks / CLOCKS_PER_SEC;
+}
+
+/**
+ * screen_reset_stats sets every counter back to 0
+ */
+void screen_reset_stats()
+{
+  screen_paints = 0;
+  screen_bytes = 0;
+  screen_ticks = 0;
+}
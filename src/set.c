@@ -1,48 +1,169 @@
-/** 
+/**
  * @brief Implements the necessary functions to work with sets
- * 
+ *
  * @file set.c
  * @author Miguel Soto, Nicolas Victorino, Ignacio Nunez and Antonio Van-Oers
  * @version 2.0
- * @date 08-03-2022 
+ * @date 08-03-2022
  * @copyright GNU Public License
  */
 
+#include <string.h>
 #include "../include/set.h"
+#include "../include/container.h"
+
+#define SET_INLINE_IDS 4 /*!< Ids stored inside the set itself before using the heap */
+#define SET_SMALL_MAX 8 /*!< Up to this number of ids membership is a linear scan */
+#define SET_BITSET_SPAN 512 /*!< Maximun distance between ids to index them with a bitset */
+#define SET_WORD_BITS BITSET_WORD_BITS /*!< Bits in a bitset word */
+#define SET_BITSET_WORDS BITSET_WORDS(SET_BITSET_SPAN) /*!< Words of a bitset */
+#define SET_HANDLE_SLOT_BITS 20 /*!< Bits of a handle used for the slot */
+#define SET_MAX_SLOTS (1 << SET_HANDLE_SLOT_BITS) /*!< Maximun number of slots of a set */
+#define SET_HANDLE_GEN_MASK 0x7FF /*!< Generations wrap around after this value */
+
+/**
+ * @brief Operations of the set algebra
+ */
+typedef enum
+{
+    SET_OP_UNION,     /*!< Ids in a or in b */
+    SET_OP_INTERSECT, /*!< Ids in a and in b */
+    SET_OP_DIFFERENCE /*!< Ids in a but not in b */
+} Set_op;
+
+HMAP_DECLARE(Set_index, Id, int);
+HMAP_DEFINE(Set_index, Id, int, CONTAINER_HASH_INT, NO_ID);
+
+/**
+ * @brief Slot of a set
+ *
+ * Used slots are linked in insertion order, free ones in the free list.
+ */
+typedef struct
+{
+    Id id;            /*!< Id stored, NO_ID if the slot is free */
+    unsigned int gen; /*!< Generation, changes each time the slot is freed */
+    int prev;         /*!< Previous used slot (-1 for the first one) */
+    int next;         /*!< Next used slot, or next free slot (-1 for the last one) */
+} Set_slot;
 
 /**
  * @brief Set
- * 
+ *
  * This struct stores a set of ids and the number of ids stored.
+ *
+ * It works as a slot map: every id gets a slot that does not move while
+ * the id is in the set, so it can be reached by a handle (slot plus
+ * generation) and deleted in O(1). Slots are linked in insertion order, so
+ * deleting an id never changes the order of the rest of them.
+ * The first SET_INLINE_IDS slots live in the struct, so small sets never
+ * touch the heap. Bigger sets double their capacity when they are full.
+ *
+ * set_get_ids and set_get_ids_by_number use a dense copy of the ids in
+ * order, that is only rebuilt after a delete in the middle of the set.
+ *
+ * Sets with more than SET_SMALL_MAX ids also keep a membership index: a
+ * bitset when the ids are close to each other (like object ids 300-399)
+ * and a hash table from id to slot, built the first time it is needed.
+ *
+ * A set created in an arena takes all its memory from it and never frees
+ * anything: grown buffers are left behind and the index buffers are kept
+ * to be reused. The memory goes away with the arena.
  */
 struct _Set
 {
-    Id *ids;            /*!< Ids array */
-    int n_ids;          /*!< Number of ids stored*/
+    Set_slot *slots;                        /*!< Slots array (inline_slots or heap) */
+    int n_slots;                            /*!< Slots handed out so far */
+    int capacity;                           /*!< Number of slots that fit in slots */
+    Set_slot inline_slots[SET_INLINE_IDS];  /*!< Slots of small sets */
+    int first;                              /*!< First used slot (-1 if empty) */
+    int last;                               /*!< Last used slot (-1 if empty) */
+    int free;                               /*!< First free slot (-1 if none) */
+    int n_ids;                              /*!< Number of ids stored*/
+    Id *ids;                                /*!< Ids in order (inline_ids or heap) */
+    int ids_capacity;                       /*!< Number of ids that fit in ids */
+    Id inline_ids[SET_INLINE_IDS];          /*!< Ids in order of small sets */
+    BOOL ids_ok;                            /*!< If ids is up to date */
+    BOOL has_bits;                          /*!< If the bitset is in use */
+    Id base;                                /*!< First id of the bitset */
+    unsigned long *bits;                    /*!< Bitset words (SET_BITSET_WORDS) */
+    BOOL has_hash;                          /*!< If the hash table is in use */
+    Set_index table;                        /*!< Hash table, slot of each id */
+    Arena *arena;                           /*!< Arena where the set lives (NULL for the heap) */
 };
 
 /**
- * set_create Allocates memory for a new set and 
+ * Private functions
+ */
+void *set_mem_alloc(Set *s, size_t size);
+STATUS set_grow(Set *s);
+STATUS set_grow_ids(Set *s, int n);
+Set_handle set_make_handle(Set *s, int slot);
+int set_handle_slot(Set *s, Set_handle h);
+BOOL set_bits_has(Set *s, Id id);
+void set_bits_put(Set *s, Id id, BOOL on);
+void set_index_free(Set *s);
+STATUS set_index_build(Set *s);
+STATUS set_hash_build(Set *s);
+int set_find(Set *s, Id id);
+int set_add_slot(Set *s, Id id);
+void set_del_slot(Set *s, int slot);
+Id *set_dense(Set *s);
+void set_clear(Set *s);
+STATUS set_reserve(Set *s, int n);
+void set_bits_extract(Set *dest, const unsigned long *words, Id base);
+STATUS set_bits_kernel(Set *dest, Set *a, Set *b, Set_op op);
+STATUS set_algebra(Set *dest, Set *a, Set *b, Set_op op);
+
+/**
+ * set_create Allocates memory for a new set and
  * has all its members initialized
  */
 Set *set_create()
 {
-    Set *new_set = NULL;    
+    return set_create_in(NULL);
+}
+
+/**
+ * set_create_in creates a set whose memory comes from an arena
+ */
+Set *set_create_in(Arena *arena)
+{
+    Set *new_set = NULL;
+    int i;
 
-    new_set = (Set *) malloc(sizeof(Set));
+    new_set = arena ? (Set *) arena_alloc(arena, sizeof(Set)) : (Set *) malloc(sizeof(Set));
     if (!new_set)
     {
         return NULL;
     }
-    
-    new_set->ids = NULL;
+
+    new_set->slots = new_set->inline_slots;
+    new_set->n_slots = 0;
+    new_set->capacity = SET_INLINE_IDS;
+    for (i = 0; i < SET_INLINE_IDS; i++)
+    {
+        new_set->inline_slots[i].gen = 0;
+    }
+    new_set->first = -1;
+    new_set->last = -1;
+    new_set->free = -1;
     new_set->n_ids = 0;
+    new_set->ids = new_set->inline_ids;
+    new_set->ids_capacity = SET_INLINE_IDS;
+    new_set->ids_ok = TRUE;
+    new_set->has_bits = FALSE;
+    new_set->base = 0;
+    new_set->bits = NULL;
+    new_set->has_hash = FALSE;
+    Set_index_init(&new_set->table, arena);
+    new_set->arena = arena;
 
     return new_set;
 }
 
 /**
- * set_destroy Frees the previously allocated memory for a set and all 
+ * set_destroy Frees the previously allocated memory for a set and all
  * of its members
  */
 STATUS set_destroy(Set *s)
@@ -52,241 +173,1071 @@ STATUS set_destroy(Set *s)
     {
         return ERROR;
     }
-    
-    if (s->ids)
+
+    /* It goes away with its arena */
+    if (s->arena)
+    {
+        return OK;
+    }
+
+    set_index_free(s);
+    if (s->slots != s->inline_slots)
+    {
+        free(s->slots);
+    }
+    if (s->ids != s->inline_ids)
     {
         free(s->ids);
     }
-    
+
     free(s);
     s = NULL;
-    
+
     return OK;
 }
 
 /**
- * set_add increases the number of ids in the set 
- * and stores the newest in the last position
+ * @brief Allocates memory for a set, from its arena if it has one
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param size number of bytes
+ * @return a pointer to the memory or NULL if there was no memory
  */
-STATUS set_add(Set *s, Id id)
+void *set_mem_alloc(Set *s, size_t size)
 {
-    Id *aux = NULL;
+    return s->arena ? arena_alloc(s->arena, size) : malloc(size);
+}
 
-    /*Error control*/
-    if (!s || id == NO_ID)
+/**
+ * @brief Doubles the number of slots of a set
+ * @author Miguel Soto
+ *
+ * The first time the slots are moved out of the inline buffer.
+ *
+ * @param s a pointer to target set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_grow(Set *s)
+{
+    Set_slot *aux = NULL;
+    int new_capacity = s->capacity * 2, i;
+
+    if (new_capacity > SET_MAX_SLOTS)
     {
         return ERROR;
     }
-    
-    /* increasing the number of ids*/
-    aux = (Id *) realloc(s->ids, (s->n_ids + 1) * sizeof(Id));
-    if (!aux)
+
+    if (s->slots == s->inline_slots || s->arena)
     {
-        return ERROR;
+        aux = (Set_slot *) set_mem_alloc(s, new_capacity * sizeof(Set_slot));
+        if (!aux)
+        {
+            return ERROR;
+        }
+        memcpy(aux, s->slots, s->capacity * sizeof(Set_slot));
+    }
+    else
+    {
+        aux = (Set_slot *) realloc(s->slots, new_capacity * sizeof(Set_slot));
+        if (!aux)
+        {
+            return ERROR;
+        }
     }
-    s->n_ids++;
-    s->ids = aux;
-    aux = NULL;
 
-    s->ids[s->n_ids-1] = id;
+    for (i = s->capacity; i < new_capacity; i++)
+    {
+        aux[i].gen = 0;
+    }
+    s->slots = aux;
+    s->capacity = new_capacity;
 
     return OK;
 }
 
 /**
- * et_del_id searches for the indicated id on a set
- * and has it removed
+ * @brief Makes room for n ids in the dense copy of a set
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param n number of ids that have to fit
+ * @return OK if everything goes well, or ERROR if anything doesn't.
  */
-STATUS set_del_id(Set *s, Id id)
+STATUS set_grow_ids(Set *s, int n)
 {
-    int i, k;
     Id *aux = NULL;
-    
-    /*Error control*/
-    if (!s || id == NO_ID || s->n_ids == 0)
+    int new_capacity = s->ids_capacity;
+
+    while (new_capacity < n)
     {
-        return ERROR;
+        new_capacity *= 2;
+    }
+    if (new_capacity == s->ids_capacity)
+    {
+        return OK;
+    }
+
+    if (s->ids == s->inline_ids || s->arena)
+    {
+        aux = (Id *) set_mem_alloc(s, new_capacity * sizeof(Id));
+        if (!aux)
+        {
+            return ERROR;
+        }
+        memcpy(aux, s->ids, s->ids_capacity * sizeof(Id));
     }
-    
-    for (i = 0, k = 0; i < s->n_ids && k == 0; i++)
+    else
     {
-        if (s->ids[i] == id)
+        aux = (Id *) realloc(s->ids, new_capacity * sizeof(Id));
+        if (!aux)
         {
-            s->ids[i] = s->ids[s->n_ids-1];
+            return ERROR;
+        }
+    }
 
-            /*Error control*/
-            aux = (Id *) realloc(s->ids, (s->n_ids) * sizeof(Id));
-            if (!aux)
-            {
-                return ERROR;
-            }
-            s->n_ids--;
+    s->ids = aux;
+    s->ids_capacity = new_capacity;
+
+    return OK;
+}
 
-            s->ids = aux;
-            aux = NULL;
+/**
+ * @brief Builds the handle of a used slot
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param slot used slot
+ * @return the handle
+ */
+Set_handle set_make_handle(Set *s, int slot)
+{
+    return ((Set_handle)s->slots[slot].gen << SET_HANDLE_SLOT_BITS) | slot;
+}
 
-            k = 1;
-        }
+/**
+ * @brief Gets the slot of a handle, checking its generation
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param h handle
+ * @return the slot, or -1 if the handle is not valid anymore
+ */
+int set_handle_slot(Set *s, Set_handle h)
+{
+    int slot;
+
+    if (h < 0)
+    {
+        return -1;
     }
 
-    if (k == 1)
+    slot = (int)(h & (SET_MAX_SLOTS - 1));
+    if (slot >= s->n_slots || s->slots[slot].id == NO_ID ||
+        s->slots[slot].gen != (unsigned int)(h >> SET_HANDLE_SLOT_BITS))
     {
-        return OK;
+        return -1;
+    }
+
+    return slot;
+}
+
+/**
+ * @brief Gets if the bit of an id is set in the bitset
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set (with has_bits)
+ * @param id target id
+ * @return TRUE if the bit is set, FALSE if not or if the id is out of the bitset
+ */
+BOOL set_bits_has(Set *s, Id id)
+{
+    Id off = id - s->base;
+
+    if (off < 0 || off >= SET_BITSET_SPAN)
+    {
+        return FALSE;
+    }
+
+    return BITSET_TEST(s->bits, off) ? TRUE : FALSE;
+}
+
+/**
+ * @brief Sets or clears the bit of an id (that has to be in the bitset window)
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set (with has_bits)
+ * @param id target id
+ * @param on TRUE to set the bit, FALSE to clear it
+ */
+void set_bits_put(Set *s, Id id, BOOL on)
+{
+    Id off = id - s->base;
+
+    if (on == TRUE)
+    {
+        BITSET_SET(s->bits, off);
     }
     else
     {
-        return ERROR;
+        BITSET_CLEAR(s->bits, off);
     }
 }
 
 /**
- * set_del_pos Removes an id from the set by a position based search
+ * @brief Frees the membership index and goes back to linear scans
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
  */
-STATUS set_del_pos(Set *s, int pos)
+void set_index_free(Set *s)
 {
-    Id *aux = NULL;
+    s->has_bits = FALSE;
+    s->has_hash = FALSE;
 
-    /*Error control*/
-    if (!s || pos < 0 || pos >= s->n_ids || s->n_ids == 0)
+    /* Arena buffers are kept to build the index again */
+    if (s->arena)
     {
-        printf("aa\n");
-        return ERROR;
+        return;
     }
 
-    /*Error control*/
-    if (s->ids[pos] == NO_ID)
+    free(s->bits);
+    Set_index_free(&s->table);
+    s->bits = NULL;
+}
+
+/**
+ * @brief Builds the membership index that suits the ids in the set
+ * @author Miguel Soto
+ *
+ * The bitset is built if the ids are close enough. The hash table is left
+ * to be built by set_find the first time a slot is looked for.
+ * The buffers of a previous index are reused, so rebuilding the index of
+ * a set that already had one does not allocate.
+ *
+ * @param s a pointer to target set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_index_build(Set *s)
+{
+    Id min, max;
+    int i;
+
+    s->has_bits = FALSE;
+    s->has_hash = FALSE;
+    if (s->n_ids <= SET_SMALL_MAX)
     {
-        printf("aaa\n");
-        return ERROR;
+        return OK;
     }
-    
-    s->ids[pos] = s->ids[s->n_ids-1];
-    
-    aux = (Id *) realloc(s->ids, s->n_ids * sizeof(Id));
-    if (!aux)
+
+    min = max = s->slots[s->first].id;
+    for (i = s->first; i != -1; i = s->slots[i].next)
     {
-        return ERROR;
+        if (s->slots[i].id < min)
+        {
+            min = s->slots[i].id;
+        }
+        if (s->slots[i].id > max)
+        {
+            max = s->slots[i].id;
+        }
     }
-    s->n_ids--;
-    s->ids = aux;
-    aux = NULL;
+
+    if (min < 0 || max - (min - min % (Id)SET_WORD_BITS) >= SET_BITSET_SPAN)
+    {
+        return OK;
+    }
+
+    /* Dense ids: one bit each, the base is aligned to a word */
+    if (!s->bits)
+    {
+        s->bits = (unsigned long *) set_mem_alloc(s, SET_BITSET_WORDS * sizeof(unsigned long));
+        if (!s->bits)
+        {
+            return ERROR;
+        }
+    }
+    BITSET_ZERO(s->bits, SET_BITSET_SPAN);
+    s->base = min - min % (Id)SET_WORD_BITS;
+    for (i = s->first; i != -1; i = s->slots[i].next)
+    {
+        set_bits_put(s, s->slots[i].id, TRUE);
+    }
+    s->has_bits = TRUE;
 
     return OK;
 }
 
 /**
- * Gets the amount of ids in a set
+ * @brief Builds the hash table from id to slot, at most half full
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @return OK if everything goes well, or ERROR if anything doesn't.
  */
-int set_get_nids(Set *s)
+STATUS set_hash_build(Set *s)
 {
-    /*Error control*/
-    if (!s)
+    int i;
+
+    /* The entries of a previous table are kept */
+    Set_index_clear(&s->table);
+    for (i = s->first; i != -1; i = s->slots[i].next)
     {
-        return -1;
+        if (Set_index_put(&s->table, s->slots[i].id, i) == ERROR)
+        {
+            s->has_hash = FALSE;
+            return ERROR;
+        }
     }
-    
-    return s->n_ids;
+    s->has_hash = TRUE;
+
+    return OK;
 }
 
 /**
- * Gets the array containing all ids from a set
+ * @brief Gets the slot of an id
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return the slot, or -1 if the id is not in the set
  */
-Id *set_get_ids(Set *s)
+int set_find(Set *s, Id id)
 {
-    /*Error control*/
-    if (!s)
+    int *slot = NULL;
+    int i;
+
+    if (s->has_bits == TRUE && set_bits_has(s, id) == FALSE)
     {
-        return NULL;
+        return -1;
     }
-    
-    return s->ids;
+
+    if (s->has_hash == FALSE && s->n_ids > SET_SMALL_MAX)
+    {
+        set_hash_build(s);
+    }
+
+    if (s->has_hash == TRUE)
+    {
+        slot = Set_index_get(&s->table, id);
+        return slot ? *slot : -1;
+    }
+
+    for (i = s->first; i != -1; i = s->slots[i].next)
+    {
+        if (s->slots[i].id == id)
+        {
+            return i;
+        }
+    }
+
+    return -1;
 }
 
 /**
- * Tests whether the set is well defined or not
+ * @brief Stores an id in a new slot at the end of the order
+ * @author Miguel Soto
+ *
+ * It does not check if the id was already in the set nor updates the index.
+ *
+ * @param s a pointer to target set
+ * @param id target id
+ * @return the slot, or -1 if there was no memory
  */
-STATUS set_test(Set *s)
+int set_add_slot(Set *s, Id id)
 {
-    int i, size_s;
+    int slot;
 
-    /*Error control*/
-    if (!s || s->n_ids < 0)
+    if (s->free != -1)
     {
-        return ERROR;
+        slot = s->free;
+        s->free = s->slots[slot].next;
     }
-    
-    /* Testing correct amount of ids*/
-    if (s->n_ids > 0)
+    else
     {
-        size_s = (int) sizeof(s->ids) / sizeof(Id);
-        if (size_s != s->n_ids)
+        /* Only grows when every slot is used */
+        if (s->n_slots == s->capacity && set_grow(s) == ERROR)
         {
-            return ERROR;
+            return -1;
         }
-        
+        slot = s->n_slots++;
+    }
+
+    s->slots[slot].id = id;
+    s->slots[slot].prev = s->last;
+    s->slots[slot].next = -1;
+    if (s->last != -1)
+    {
+        s->slots[s->last].next = slot;
     }
-    
-    /* Testing that there is no id == NO_ID*/
-    for (i = 0; i < s->n_ids; i++)
+    else
+    {
+        s->first = slot;
+    }
+    s->last = slot;
+    s->n_ids++;
+
+    /* Adding at the end keeps the dense copy in order */
+    if (s->ids_ok == TRUE)
     {
-        if (s->ids[i] == NO_ID)
+        if (set_grow_ids(s, s->n_ids) == OK)
         {
-            return ERROR;
+            s->ids[s->n_ids - 1] = id;
+        }
+        else
+        {
+            s->ids_ok = FALSE;
         }
-        
     }
-    
-    return OK;
+
+    return slot;
 }
 
-/*Function that tells if an object is or not in a set*/
-BOOL set_idInSet (Set* set, Id id)
+/**
+ * @brief Frees a used slot
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param slot used slot
+ */
+void set_del_slot(Set *s, int slot)
 {
-    int i = 0; 
+    Set_slot *sl = &s->slots[slot];
 
-    /*Error control*/
-    if ((!set) || (!id)) {
-        return FALSE;
+    if (s->has_hash == TRUE)
+    {
+        Set_index_remove(&s->table, sl->id);
+    }
+    if (s->has_bits == TRUE)
+    {
+        set_bits_put(s, sl->id, FALSE);
     }
 
+    /* Removing the last id keeps the dense copy in order */
+    if (slot != s->last)
+    {
+        s->ids_ok = FALSE;
+    }
 
-    /*Checks the position where the id coincides*/
-    while (i < set->n_ids) {
-        if(set->ids[i]==id){
-            break;
-        }
-        i++;
+    if (sl->prev != -1)
+    {
+        s->slots[sl->prev].next = sl->next;
+    }
+    else
+    {
+        s->first = sl->next;
+    }
+    if (sl->next != -1)
+    {
+        s->slots[sl->next].prev = sl->prev;
+    }
+    else
+    {
+        s->last = sl->prev;
     }
 
-    /*If it has not located the position, it reaches MAX_IDS and returns ERROR*/
-    if ( i == set->n_ids) {
-        return FALSE;
-    } else {
-        return TRUE;
+    sl->id = NO_ID;
+    sl->gen = (sl->gen + 1) & SET_HANDLE_GEN_MASK;
+    sl->next = s->free;
+    s->free = slot;
+    s->n_ids--;
+
+    /* Small again, the index is not worth it */
+    if ((s->bits || s->table.entries) && s->n_ids <= SET_SMALL_MAX / 2)
+    {
+        set_index_free(s);
     }
 }
 
 /**
- * Prints all info regarding set
+ * @brief Gets the dense copy of the ids, rebuilding it if needed
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @return the ids in order, or NULL if there was no memory
  */
-int set_print(Set *s)
+Id *set_dense(Set *s)
 {
     int i, n;
 
-    /*Error control*/
-    for (i = 0, n = 0; i < s->n_ids; i++)
+    if (s->ids_ok == FALSE)
     {
-        n += fprintf(stdout, "Id %d : %ld\n", i, s->ids[i]);
+        if (set_grow_ids(s, s->n_ids) == ERROR)
+        {
+            return NULL;
+        }
+        for (i = s->first, n = 0; i != -1; i = s->slots[i].next)
+        {
+            s->ids[n++] = s->slots[i].id;
+        }
+        s->ids_ok = TRUE;
     }
-    
-    return n;
+
+    return s->ids;
 }
 
-Id set_get_ids_by_number(Set* set, int n)
+/**
+ * set_add increases the number of ids in the set
+ * and stores the newest in the last position
+ */
+STATUS set_add(Set *s, Id id)
+{
+    return set_add_handle(s, id) != SET_NO_HANDLE ? OK : ERROR;
+}
+
+/**
+ * set_add_handle adds an id to a set and gets its handle
+ */
+Set_handle set_add_handle(Set *s, Id id)
 {
+    int slot;
+
     /*Error control*/
-    if (!set || n < 0 || n > set->n_ids + 1)
-    return -1;
+    if (!s || id == NO_ID)
+    {
+        return SET_NO_HANDLE;
+    }
+
+    /* An id can only be once in a set */
+    if (set_find(s, id) != -1)
+    {
+        return SET_NO_HANDLE;
+    }
 
-    return set->ids[n];
+    slot = set_add_slot(s, id);
+    if (slot == -1)
+    {
+        return SET_NO_HANDLE;
+    }
+
+    if (s->has_bits == FALSE && s->has_hash == FALSE)
+    {
+        if (s->n_ids > SET_SMALL_MAX)
+        {
+            set_index_build(s);
+        }
+    }
+    else
+    {
+        if (s->has_bits == TRUE)
+        {
+            if (id - s->base >= 0 && id - s->base < SET_BITSET_SPAN)
+            {
+                set_bits_put(s, id, TRUE);
+            }
+            else
+            {
+                /* Out of the window, maybe the ids are not close anymore */
+                set_index_build(s);
+            }
+        }
+        if (s->has_hash == TRUE && Set_index_put(&s->table, id, slot) == ERROR)
+        {
+            s->has_hash = FALSE;
+        }
+    }
+
+    return set_make_handle(s, slot);
+}
+
+/**
+ * set_get_handle gets the handle of an id of a set
+ */
+Set_handle set_get_handle(Set *s, Id id)
+{
+    int slot;
+
+    /*Error control*/
+    if (!s || id == NO_ID)
+    {
+        return SET_NO_HANDLE;
+    }
+
+    slot = set_find(s, id);
+    if (slot == -1)
+    {
+        return SET_NO_HANDLE;
+    }
+
+    return set_make_handle(s, slot);
+}
+
+/**
+ * set_get_id_by_handle gets the id that a handle refers to
+ */
+Id set_get_id_by_handle(Set *s, Set_handle h)
+{
+    int slot;
+
+    /*Error control*/
+    if (!s || (slot = set_handle_slot(s, h)) == -1)
+    {
+        return NO_ID;
+    }
+
+    return s->slots[slot].id;
+}
+
+/**
+ * set_del_handle removes the id that a handle refers to
+ */
+STATUS set_del_handle(Set *s, Set_handle h)
+{
+    int slot;
+
+    /*Error control*/
+    if (!s || (slot = set_handle_slot(s, h)) == -1)
+    {
+        return ERROR;
+    }
+
+    set_del_slot(s, slot);
+
+    return OK;
+}
+
+/**
+ * set_del_id searches for the indicated id on a set
+ * and has it removed
+ */
+STATUS set_del_id(Set *s, Id id)
+{
+    int slot;
+
+    /*Error control*/
+    if (!s || id == NO_ID || s->n_ids == 0)
+    {
+        return ERROR;
+    }
+
+    slot = set_find(s, id);
+    if (slot == -1)
+    {
+        return ERROR;
+    }
+
+    set_del_slot(s, slot);
+
+    return OK;
+}
+
+/**
+ * set_del_pos Removes an id from the set by a position based search
+ */
+STATUS set_del_pos(Set *s, int pos)
+{
+    Id *ids = NULL;
+
+    /*Error control*/
+    if (!s || pos < 0 || pos >= s->n_ids)
+    {
+        return ERROR;
+    }
+
+    ids = set_dense(s);
+    /*Error control*/
+    if (!ids || ids[pos] == NO_ID)
+    {
+        return ERROR;
+    }
+
+    return set_del_id(s, ids[pos]);
+}
+
+/**
+ * Gets the amount of ids in a set
+ */
+int set_get_nids(Set *s)
+{
+    /*Error control*/
+    if (!s)
+    {
+        return -1;
+    }
+
+    return s->n_ids;
+}
+
+/**
+ * Gets the array containing all ids from a set
+ */
+Id *set_get_ids(Set *s)
+{
+    /*Error control*/
+    if (!s)
+    {
+        return NULL;
+    }
+
+    return set_dense(s);
+}
+
+/**
+ * Tests whether the set is well defined or not
+ */
+STATUS set_test(Set *s)
+{
+    int i, n;
+
+    /*Error control*/
+    if (!s || s->n_ids < 0 || s->n_ids > s->n_slots || s->n_slots > s->capacity)
+    {
+        return ERROR;
+    }
+
+    /* Testing that there is no id == NO_ID and the index finds every id*/
+    for (i = s->first, n = 0; i != -1; i = s->slots[i].next, n++)
+    {
+        if (s->slots[i].id == NO_ID || set_find(s, s->slots[i].id) != i)
+        {
+            return ERROR;
+        }
+        if (s->ids_ok == TRUE && s->ids[n] != s->slots[i].id)
+        {
+            return ERROR;
+        }
+    }
+
+    /* Testing correct amount of ids*/
+    if (n != s->n_ids)
+    {
+        return ERROR;
+    }
+
+    return OK;
+}
+
+/*Function that tells if an object is or not in a set*/
+BOOL set_idInSet (Set* set, Id id)
+{
+    /*Error control*/
+    if ((!set) || (!id)) {
+        return FALSE;
+    }
+
+    /* The bitset answers by itself, no need to know the slot */
+    if (set->has_bits == TRUE)
+    {
+        return set_bits_has(set, id);
+    }
+
+    return set_find(set, id) != -1 ? TRUE : FALSE;
+}
+
+/**
+ * Prints all info regarding set
+ */
+int set_print(Set *s)
+{
+    int i, k, n;
+
+    /*Error control*/
+    if (!s)
+    {
+        return 0;
+    }
+
+    for (i = s->first, k = 0, n = 0; i != -1; i = s->slots[i].next, k++)
+    {
+        n += fprintf(stdout, "Id %d : %ld\n", k, s->slots[i].id);
+    }
+
+    return n;
+}
+
+Id set_get_ids_by_number(Set* set, int n)
+{
+    Id *ids = NULL;
+
+    /*Error control*/
+    if (!set || n < 0 || n >= set->n_ids)
+    return -1;
+
+    ids = set_dense(set);
+    if (!ids)
+    return -1;
+
+    return ids[n];
+}
+
+/**
+ * @brief Empties a set, keeping its memory
+ * @author Miguel Soto
+ *
+ * The handles of the ids that were in the set stop being valid.
+ *
+ * @param s a pointer to target set
+ */
+void set_clear(Set *s)
+{
+    int i;
+
+    for (i = s->first; i != -1; i = s->slots[i].next)
+    {
+        s->slots[i].id = NO_ID;
+        s->slots[i].gen = (s->slots[i].gen + 1) & SET_HANDLE_GEN_MASK;
+    }
+
+    s->n_slots = 0;
+    s->first = -1;
+    s->last = -1;
+    s->free = -1;
+    s->n_ids = 0;
+    s->ids_ok = TRUE;
+    s->has_bits = FALSE;
+    s->has_hash = FALSE;
+}
+
+/**
+ * @brief Makes room for n ids in a set
+ * @author Miguel Soto
+ *
+ * @param s a pointer to target set
+ * @param n number of ids that have to fit
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_reserve(Set *s, int n)
+{
+    while (s->capacity < n)
+    {
+        if (set_grow(s) == ERROR)
+        {
+            return ERROR;
+        }
+    }
+
+    return set_grow_ids(s, n);
+}
+
+/**
+ * @brief Appends the ids of the bits set in some bitset words
+ * @author Miguel Soto
+ *
+ * The ids are appended in increasing order, there must be room for them.
+ *
+ * @param dest a pointer to the set where ids are written
+ * @param words bitset words (SET_BITSET_WORDS)
+ * @param base id of the first bit of words[0]
+ */
+void set_bits_extract(Set *dest, const unsigned long *words, Id base)
+{
+    unsigned long w;
+    int i, bit;
+
+    for (i = 0; i < SET_BITSET_WORDS; i++)
+    {
+        /* Take the lowest bit set each time */
+        for (w = words[i]; w; w &= w - 1)
+        {
+#ifdef __GNUC__
+            bit = __builtin_ctzl(w);
+#else
+            for (bit = 0; !(w & (1UL << bit)); bit++)
+                ;
+#endif
+            set_add_slot(dest, base + (Id)i * SET_WORD_BITS + bit);
+        }
+    }
+}
+
+/**
+ * @brief Set algebra over two bitsets, a whole word (64 ids) at a time
+ * @author Miguel Soto
+ *
+ * Both sets have to keep a bitset. Their bases are aligned to a word, so
+ * the words of b are just shifted some positions from those of a.
+ *
+ * @param dest a pointer to the result set (empty and with room for the result)
+ * @param a a pointer to the first set
+ * @param b a pointer to the second set
+ * @param op operation
+ * @return OK if the result and its index were written, ERROR if the union does not fit in a bitset
+ */
+STATUS set_bits_kernel(Set *dest, Set *a, Set *b, Set_op op)
+{
+    unsigned long words[SET_BITSET_WORDS], wb;
+    int n_words = SET_BITSET_WORDS;
+    int i, shift;
+    Set *lo, *hi;
+    Id base, diff;
+
+    if (op == SET_OP_UNION)
+    {
+        /* The union has to fit in the window of the set with the lowest base */
+        lo = a->base <= b->base ? a : b;
+        hi = lo == a ? b : a;
+        base = lo->base;
+        if (hi->base - lo->base >= SET_BITSET_SPAN)
+        {
+            return ERROR;
+        }
+        shift = (int)((hi->base - lo->base) / (Id)SET_WORD_BITS);
+        for (i = n_words - shift; i < n_words; i++)
+        {
+            if (hi->bits[i])
+            {
+                return ERROR;
+            }
+        }
+        for (i = 0; i < n_words; i++)
+        {
+            words[i] = lo->bits[i] | (i >= shift ? hi->bits[i - shift] : 0);
+        }
+    }
+    else
+    {
+        /* The result is a subset of a, so a's window is enough */
+        base = a->base;
+        /* Windows further than n_words apart do not overlap at all */
+        diff = (b->base - a->base) / (Id)SET_WORD_BITS;
+        shift = (int)(diff > n_words ? n_words : (diff < -n_words ? -n_words : diff));
+        for (i = 0; i < n_words; i++)
+        {
+            wb = (i - shift >= 0 && i - shift < n_words) ? b->bits[i - shift] : 0;
+            words[i] = op == SET_OP_INTERSECT ? a->bits[i] & wb : a->bits[i] & ~wb;
+        }
+    }
+
+    set_bits_extract(dest, words, base);
+
+    /* The result words are already the bitset index of dest */
+    if (dest->n_ids <= SET_SMALL_MAX)
+    {
+        return set_index_build(dest);
+    }
+    if (!dest->bits)
+    {
+        dest->bits = (unsigned long *) set_mem_alloc(dest, SET_BITSET_WORDS * sizeof(unsigned long));
+        if (!dest->bits)
+        {
+            return set_index_build(dest);
+        }
+    }
+    memcpy(dest->bits, words, SET_BITSET_WORDS * sizeof(unsigned long));
+    dest->base = base;
+    dest->has_bits = TRUE;
+
+    return OK;
+}
+
+/**
+ * @brief Common code of set_union, set_intersect and set_difference
+ * @author Miguel Soto
+ *
+ * @param dest a pointer to the result set
+ * @param a a pointer to the first set
+ * @param b a pointer to the second set
+ * @param op operation
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS set_algebra(Set *dest, Set *a, Set *b, Set_op op)
+{
+    Set *small, *big;
+    int i, n_max;
+
+    /*Error control*/
+    if (!dest || !a || !b || dest == a || dest == b)
+    {
+        return ERROR;
+    }
+
+    n_max = op == SET_OP_UNION ? a->n_ids + b->n_ids : (op == SET_OP_INTERSECT && b->n_ids < a->n_ids ? b->n_ids : a->n_ids);
+    set_clear(dest);
+    if (set_reserve(dest, n_max) == ERROR)
+    {
+        return ERROR;
+    }
+
+    if (a->has_bits == TRUE && b->has_bits == TRUE && set_bits_kernel(dest, a, b, op) == OK)
+    {
+        return OK;
+    }
+
+    /* Any other case: walk one set and ask the index of the other one */
+    set_clear(dest);
+    switch (op)
+    {
+    case SET_OP_UNION:
+        for (i = a->first; i != -1; i = a->slots[i].next)
+        {
+            set_add_slot(dest, a->slots[i].id);
+        }
+        for (i = b->first; i != -1; i = b->slots[i].next)
+        {
+            if (set_idInSet(a, b->slots[i].id) == FALSE)
+            {
+                set_add_slot(dest, b->slots[i].id);
+            }
+        }
+        break;
+
+    case SET_OP_INTERSECT:
+        small = a->n_ids <= b->n_ids ? a : b;
+        big = small == a ? b : a;
+        for (i = small->first; i != -1; i = small->slots[i].next)
+        {
+            if (set_idInSet(big, small->slots[i].id) == TRUE)
+            {
+                set_add_slot(dest, small->slots[i].id);
+            }
+        }
+        break;
+
+    case SET_OP_DIFFERENCE:
+        for (i = a->first; i != -1; i = a->slots[i].next)
+        {
+            if (set_idInSet(b, a->slots[i].id) == FALSE)
+            {
+                set_add_slot(dest, a->slots[i].id);
+            }
+        }
+        break;
+    }
+
+    return set_index_build(dest);
+}
+
+/**
+ * set_union stores in dest the ids that are in a or in b
+ */
+STATUS set_union(Set *dest, Set *a, Set *b)
+{
+    return set_algebra(dest, a, b, SET_OP_UNION);
+}
+
+/**
+ * set_intersect stores in dest the ids that are in a and in b
+ */
+STATUS set_intersect(Set *dest, Set *a, Set *b)
+{
+    return set_algebra(dest, a, b, SET_OP_INTERSECT);
+}
+
+/**
+ * set_difference stores in dest the ids that are in a but not in b
+ */
+STATUS set_difference(Set *dest, Set *a, Set *b)
+{
+    return set_algebra(dest, a, b, SET_OP_DIFFERENCE);
+}
+
+/**
+ * set_count_if counts the ids of a set that satisfy a condition
+ */
+int set_count_if(Set *s, BOOL (*pred)(Id id, void *data), void *data)
+{
+    int i, n;
+
+    /*Error control*/
+    if (!s || !pred)
+    {
+        return -1;
+    }
+
+    for (i = s->first, n = 0; i != -1; i = s->slots[i].next)
+    {
+        n += pred(s->slots[i].id, data) == TRUE;
+    }
+
+    return n;
 }
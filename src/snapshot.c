@@ -0,0 +1,323 @@
+/**
+ * @brief It implements the snapshot of a game that is painted
+ *
+ * @file snapshot.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <string.h>
+#include "../include/snapshot.h"
+
+#define SNAPSHOT_FOG 16   /*!< Space hidden by the fog during the day when seen from the west */
+
+/**
+ * Private functions
+ */
+void snapshot_text(char *dest, const char *src, BOOL *has);
+void snapshot_name(char *dest, const char *src);
+void snapshot_room(Snapshot *snap, Snapshot_place place, Game *game, Tile_cache *tiles, DIRECTION dir, char arrow);
+void snapshot_minimap(Snapshot *snap, Game *game, Tile_cache *tiles, Viewport *vp);
+void snapshot_enemies(Snapshot *snap, Game *game, int first);
+
+/**
+ * @brief Copies a text into a snapshot
+ * @author Miguel Soto
+ *
+ * @param dest where the text is copied (SNAPSHOT_TEXT bytes)
+ * @param src the text, or NULL
+ * @param has if not NULL, it gets if there was a text
+ */
+void snapshot_text(char *dest, const char *src, BOOL *has)
+{
+  if (has)
+  {
+    *has = src ? TRUE : FALSE;
+  }
+
+  dest[0] = '\0';
+  if (src)
+  {
+    strncat(dest, src, SNAPSHOT_TEXT - 1);
+  }
+}
+
+/**
+ * @brief Copies a name into a snapshot
+ * @author Miguel Soto
+ *
+ * @param dest where the name is copied (SNAPSHOT_NAME bytes)
+ * @param src the name, or NULL for an empty one
+ */
+void snapshot_name(char *dest, const char *src)
+{
+  dest[0] = '\0';
+  if (src)
+  {
+    strncat(dest, src, SNAPSHOT_NAME - 1);
+  }
+}
+
+/**
+ * @brief Takes a neighbour room of the map area
+ * @author Miguel Soto
+ *
+ * @param snap the snapshot, its location already taken
+ * @param place the room taken
+ * @param game pointer to the game
+ * @param tiles cache of the tiles of the rooms
+ * @param dir direction of the room from the room of the player
+ * @param arrow arrow drawn if the link to the room is open
+ */
+void snapshot_room(Snapshot *snap, Snapshot_place place, Game *game, Tile_cache *tiles, DIRECTION dir, char arrow)
+{
+  Snapshot_room *room = &snap->rooms[place];
+  const Tile_row *tile = NULL;
+  Space *here = NULL;
+  BOOL fog;
+
+  here = game_get_space(game, snap->location);
+  room->id = space_get_id_dest_by_link(game_get_link(game, space_get_link(here, dir)));
+  room->link = game_get_connection_status(game, snap->location, dir) == OPEN_L ? arrow : ' ';
+
+  fog = (place == SNAP_EAST && room->id == SNAPSHOT_FOG && snap->time == DAY) ? TRUE : FALSE;
+  tile = tile_cache_get(tiles, game, room->id, FALSE, fog);
+  if (!tile)
+  {
+    room->id = NO_ID;
+    return;
+  }
+  memcpy(room->tile, tile, sizeof(room->tile));
+}
+
+/**
+ * @brief Draws the minimap around the player
+ * @author Miguel Soto
+ *
+ * The object marks are taken from the tiles of the rooms. The room of the
+ * player and the one behind the fog are not asked for, so their tiles in
+ * the map area are not drawn again for the minimap.
+ *
+ * @param snap the snapshot, its location and time already taken
+ * @param game pointer to the game
+ * @param tiles cache of the tiles of the rooms
+ * @param vp viewport of SNAPSHOT_MAP_W by SNAPSHOT_MAP_H rooms
+ */
+void snapshot_minimap(Snapshot *snap, Game *game, Tile_cache *tiles, Viewport *vp)
+{
+  static const char links[3][2] = {{' ', ' '}, {'-', '|'}, {'x', 'x'}}; /* East and south of each Viewport_link */
+  const Tile_row *tile = NULL;
+  char *cell = NULL;
+  Id id;
+  int x, y;
+
+  for (y = 0; y < SNAPSHOT_MAP_Y; y++)
+  {
+    memset(snap->minimap[y], ' ', SNAPSHOT_MAP_X);
+    snap->minimap[y][SNAPSHOT_MAP_X] = '\0';
+  }
+
+  if (viewport_get_width(vp) != SNAPSHOT_MAP_W || viewport_get_height(vp) != SNAPSHOT_MAP_H || viewport_layout(vp, game, snap->location) <= 0)
+  {
+    return;
+  }
+
+  for (y = 0; y < SNAPSHOT_MAP_H; y++)
+  {
+    for (x = 0; x < SNAPSHOT_MAP_W; x++)
+    {
+      id = viewport_get_room(vp, x, y);
+      if (id == NO_ID)
+      {
+        continue;
+      }
+
+      cell = &snap->minimap[2 * y][2 * x];
+      if (id == snap->location)
+      {
+        *cell = '@';
+      }
+      else if (id == SNAPSHOT_FOG && snap->time == DAY)
+      {
+        *cell = '?';
+      }
+      else
+      {
+        tile = tile_cache_get(tiles, game, id, FALSE, FALSE);
+        *cell = (tile && tile[TILE_OBJECT_ROW][TILE_X / 2] == '*') ? '*' : 'o';
+      }
+
+      if (x + 1 < SNAPSHOT_MAP_W)
+      {
+        snap->minimap[2 * y][2 * x + 1] = links[viewport_get_link(vp, x, y, E)][0];
+      }
+      if (y + 1 < SNAPSHOT_MAP_H)
+      {
+        snap->minimap[2 * y + 1][2 * x] = links[viewport_get_link(vp, x, y, S)][1];
+      }
+    }
+  }
+}
+
+/**
+ * @brief Copies a page of the enemies in the room of the player
+ * @author Miguel Soto
+ *
+ * The game keeps the enemies of each room, so only the ones of the page
+ * are looked at. A page past the end goes back to the first one.
+ *
+ * @param snap the snapshot, with its location taken
+ * @param game pointer to the game
+ * @param first position of the first enemy of the page among the ones in the room
+ */
+void snapshot_enemies(Snapshot *snap, Game *game, int first)
+{
+  Enemy *enemy = NULL;
+  int i;
+
+  snap->enemies_total = game_count_enemies_in_space(game, snap->location);
+  snap->enemies_first = (first > 0 && first < snap->enemies_total) ? first : 0;
+  snap->n_enemies = 0;
+  for (i = snap->enemies_first; i < snap->enemies_total && snap->n_enemies < SNAPSHOT_ENEMIES_PAGE; i++)
+  {
+    enemy = game_get_enemy_in_space_at(game, snap->location, i);
+    snapshot_name(snap->enemies[snap->n_enemies].name, enemy_get_name(enemy));
+    snap->enemies[snap->n_enemies].health = enemy_get_health(enemy);
+    snap->n_enemies++;
+  }
+}
+
+/**
+ * snapshot_take takes everything the screen shows of a game
+ */
+STATUS snapshot_take(Snapshot *snap, Game *game, Tile_cache *tiles, Viewport *vp, Snapshot_scroll *scroll, int st)
+{
+  Player *player = NULL;
+  Space *here = NULL;
+  Set *set = NULL;
+  Object *obj = NULL;
+  Link *link = NULL;
+  Dialogue *dialogue = NULL;
+  const Atlas_row *gdesc = NULL;
+  const Tile_row *tile = NULL;
+  const char *text = NULL;
+  int i;
+
+  /* Error control */
+  if (!snap || !game || !tiles)
+  {
+    return ERROR;
+  }
+
+  memset(snap, 0, sizeof(Snapshot));
+
+  player = game_get_player(game, game_get_player_id(game));
+  snap->location = game_get_player_location(game, game_get_player_id(game));
+  snap->player_health = player_get_health(player);
+  snap->time = game_get_time(game);
+  snap->last_cmd = game_get_last_command(game);
+  snap->st = st;
+  snap->game_over = (snap->player_health <= 0 || game_is_boss_dead(game) == TRUE) ? TRUE : FALSE;
+
+  gdesc = player_get_gdesc(player);
+  for (i = 0; i < PLAYER_GDESC_Y && gdesc; i++)
+  {
+    strcpy(snap->player_gdesc[i], gdesc[i]);
+  }
+
+  /* Page of the inventory, a page past the end goes back to the first one */
+  set = inventory_get_objects(player_get_inventory(player));
+  snap->inventory_total = set_get_nids(set) > 0 ? set_get_nids(set) : 0;
+  snap->inventory_first = (scroll && scroll->inventory < snap->inventory_total) ? scroll->inventory : 0;
+  if (scroll)
+  {
+    scroll->inventory = snap->inventory_first;
+  }
+  for (i = snap->inventory_first; i < snap->inventory_total && snap->n_inventory < SNAPSHOT_INVENTORY_PAGE; i++)
+  {
+    snapshot_name(snap->inventory[snap->n_inventory++], obj_get_name(game_get_object(game, set_get_ids_by_number(set, i))));
+  }
+
+  /* Dialogue and events of the last command */
+  dialogue = game_get_dialogue(game);
+  text = dialogue_get_error(dialogue);
+  if (text && strcmp(text, " ") == 0)
+  {
+    text = dialogue_get_command(dialogue);
+  }
+  snapshot_text(snap->dialogue, text, &snap->has_dialogue);
+  snapshot_text(snap->events, dialogue_get_event(dialogue), &snap->has_events);
+
+  for (i = 0; i < SNAP_ROOMS; i++)
+  {
+    snap->rooms[i].id = NO_ID;
+    snap->rooms[i].link = ' ';
+  }
+
+  here = game_get_space(game, snap->location);
+  if (!here)
+  {
+    snap->location = NO_ID;
+    return OK;
+  }
+
+  /* Map area */
+  tile = tile_cache_get(tiles, game, snap->location, TRUE, FALSE);
+  if (tile)
+  {
+    snap->rooms[SNAP_HERE].id = snap->location;
+    memcpy(snap->rooms[SNAP_HERE].tile, tile, sizeof(snap->rooms[SNAP_HERE].tile));
+  }
+  snapshot_room(snap, SNAP_NORTH, game, tiles, N, '^');
+  snapshot_room(snap, SNAP_SOUTH, game, tiles, S, 'v');
+  snapshot_room(snap, SNAP_WEST, game, tiles, W, '<');
+  snapshot_room(snap, SNAP_EAST, game, tiles, E, '>');
+  if (vp)
+  {
+    snapshot_minimap(snap, game, tiles, vp);
+  }
+
+  /* The panel is shown once the enemies of the game are placed */
+  snap->panel = (game_get_enemy_location(game, game_get_enemy_id(game, 0)) != NO_ID) ? TRUE : FALSE;
+
+  /* Objects that can be seen in the room, in the order of its set */
+  set = space_get_objects(here);
+  for (i = 0; i < set_get_nids(set) && snap->n_objects < SNAPSHOT_LIST; i++)
+  {
+    obj = game_get_object(game, set_get_ids_by_number(set, i));
+    if (!obj)
+    {
+      break;
+    }
+    if (obj_is_visible(obj, space_get_light_status(here)) == TRUE)
+    {
+      snapshot_name(snap->objects[snap->n_objects++], obj_get_name(obj));
+    }
+  }
+
+  /* Page of the enemies in the room */
+  snapshot_enemies(snap, game, scroll ? scroll->enemies : 0);
+  if (scroll)
+  {
+    scroll->enemies = snap->enemies_first;
+  }
+
+  snapshot_text(snap->description, space_get_brief_description(here), NULL);
+  snapshot_text(snap->inspection, game_get_inspection(game), &snap->has_inspection);
+
+  /* Closed links of the room, the ones that need a key */
+  for (i = 0; i < SNAPSHOT_LINKS; i++)
+  {
+    link = game_get_link(game, space_get_link(here, i));
+    if (link_get_status(link) == CLOSE && link_get_name(link) != NULL)
+    {
+      snapshot_name(snap->closed[snap->n_closed].name, link_get_name(link));
+      snap->closed[snap->n_closed].dir = link_get_direction(link);
+      snap->n_closed++;
+    }
+  }
+
+  return OK;
+}
@@ -24,17 +24,21 @@
 struct _Space
 {
   Id id;                             /*!< Id number of the space, it must be unique */
-  char name[WORD_SIZE + 1];          /*!< Name of the space */
-  char brief_description[WORD_SIZE]; /*!< Brief description of the space*/
-  char long_description[WORD_SIZE];  /*!< Detailed description of the space*/
+  const char *name;                  /*!< Name of the space (in the string pool) */
+  const char *brief_description;     /*!< Brief description of the space (in the string pool) */
+  const char *long_description;      /*!< Detailed description of the space (in the string pool) */
   Id link[MAX_LINKS_SPACE];          /*!< Id from links between space with this space as origin */
   Set *objects;                      /*!< Conjunto de ids de los objetos que se encuentran en el espacio */
-  char **gdesc;                      /*!< Array de 5 strings de 9 caracteres */
+  const Atlas_row *gdesc;            /*!< Tile of the graphic description in the atlas (NULL if none) */
   Light ls;                          /*!< Status of light (Brief for Light Status) */
   Floor floor;                       /*!< Floor level of the space*/
   BOOL fire;                         /*!< If TRUE, torches can be turnon. If FALSE, torches cannot illuminate*/
+  Arena *arena;                      /*!< Arena where the space lives (NULL for the heap) */
+  unsigned long revision;            /*!< Stamp of the last change of what is drawn of the space */
 } ;
 
+static unsigned long space_revision = 0; /*!< Last stamp given, so no two changes share one */
+
 /**
  * Private functions
  */
@@ -93,6 +97,14 @@ int _dir2i(DIRECTION dir)
  *  and initializes its members
  */
 Space *space_create(Id id)
+{
+  return space_create_in(id, NULL);
+}
+
+/** space_create_in creates a space whose memory
+ *  comes from an arena
+ */
+Space *space_create_in(Id id, Arena *arena)
 {
   Space *newSpace = NULL;
   int i;
@@ -101,7 +113,7 @@ Space *space_create(Id id)
   if (id == NO_ID)
     return NULL;
 
-  newSpace = (Space *)malloc(sizeof(Space));
+  newSpace = arena ? (Space *)arena_alloc(arena, sizeof(Space)) : (Space *)malloc(sizeof(Space));
   if (newSpace == NULL)
   {
     return NULL;
@@ -109,18 +121,20 @@ Space *space_create(Id id)
 
   /* Initialization of an empty space*/
   newSpace->id = id;
-  newSpace->name[0] = '\0';
-  newSpace->brief_description[0] = '\0';
-  newSpace->long_description[0] = '\0';
+  newSpace->name = "";
+  newSpace->brief_description = "";
+  newSpace->long_description = "";
   for (i = 0; i < 6; i++)
   {
     newSpace->link[i] = NO_ID;
   }
-  newSpace->objects = set_create();
+  newSpace->objects = set_create_in(arena);
   newSpace->gdesc = NULL;
   newSpace->ls = UNKNOWN_LIGHT;
   newSpace->floor = UNKNOWN_FLOOR;
   newSpace->fire = FALSE;
+  newSpace->arena = arena;
+  newSpace->revision = ++space_revision;
 
   return newSpace;
 }
@@ -138,6 +152,12 @@ STATUS space_destroy(Space *space)
     return ERROR;
   }
 
+  /* It goes away with its arena */
+  if (space->arena)
+  {
+    return OK;
+  }
+
   for (i = 0; i < 6; i++)
   {
     space->link[i] = NO_ID;
@@ -152,15 +172,6 @@ STATUS space_destroy(Space *space)
     space->objects = NULL;
   }
 
-  if (space->gdesc)
-  {
-    if (space_destroy_gdesc(space->gdesc) == ERROR)
-    {
-      /*printf("ERROR liberando memoria gdesc\n");*/
-      return ERROR;
-    }
-  }
-
   free(space);
   space = NULL;
   return OK;
@@ -208,21 +219,19 @@ STATUS space_test_id(Id id)
 
 /** It sets the name of a space
  */
-STATUS space_set_name(Space *space, char *name)
+STATUS space_set_name(Space *space, Strpool *pool, char *name)
 {
-  if (!space || !name)
+  if (!space || !pool || !name)
   {
     return ERROR;
   }
 
-  if (strlen(name) >= WORD_SIZE)
-  {
-    strncpy(space->name, name, WORD_SIZE);
-  }
-  else
+  if (!(space->name = strpool_intern(pool, name)))
   {
-    strcpy(space->name, name);
+    space->name = "";
+    return ERROR;
   }
+  space->revision = ++space_revision;
   return OK;
 }
 
@@ -252,17 +261,18 @@ const char *space_get_brief_description(Space *space)
 
 /** space_set_description set a new description for an space.
  */
-STATUS space_set_brief_description(Space *space, char *brief_description)
+STATUS space_set_brief_description(Space *space, Strpool *pool, char *brief_description)
 {
   /* CONTROL ERROR */
-  if (!space || !brief_description)
+  if (!space || !pool || !brief_description)
   {
     return ERROR;
   }
 
-  if (!strcpy(space->brief_description, brief_description))
+  if (!(space->brief_description = strpool_intern(pool, brief_description)))
   {
     /*CONTROL ERROR*/
+    space->brief_description = "";
     return ERROR;
   }
 
@@ -284,23 +294,42 @@ const char *space_get_long_description(Space *space)
 
 /** space_set_long_description set a new detailed description for an space.
  */
-STATUS space_set_long_description(Space *space, char *long_description)
+STATUS space_set_long_description(Space *space, Strpool *pool, char *long_description)
 {
   /* CONTROL ERROR */
-  if (!space || !long_description)
+  if (!space || !pool || !long_description)
   {
     return ERROR;
   }
 
-  if (!strcpy(space->long_description, long_description))
+  if (!(space->long_description = strpool_intern(pool, long_description)))
   {
     /*CONTROL ERROR*/
+    space->long_description = "";
     return ERROR;
   }
 
   return OK;
 }
 
+/** space_borrow_texts points the space at texts that outlive it
+ */
+STATUS space_borrow_texts(Space *space, const char *name, const char *brief_description, const char *long_description)
+{
+  /* CONTROL ERROR */
+  if (!space || !name || !brief_description || !long_description)
+  {
+    return ERROR;
+  }
+
+  space->name = name;
+  space->brief_description = brief_description;
+  space->long_description = long_description;
+  space->revision = ++space_revision;
+
+  return OK;
+}
+
 /**
  * It sets the link of the space in an specific direction
  */
@@ -319,6 +348,7 @@ STATUS space_set_link(Space *space, Id link, DIRECTION dir)
   }
 
   space->link[n] = link;
+  space->revision = ++space_revision;
   return OK;
 }
 
@@ -358,6 +388,7 @@ STATUS space_add_objectid(Space *s, Id id)
     return ERROR;
   }
 
+  s->revision = ++space_revision;
   return OK;
 }
 
@@ -377,6 +408,7 @@ STATUS space_del_objectid(Space *s, Id id)
     return ERROR;
   }
 
+  s->revision = ++space_revision;
   return OK;
 }
 
@@ -408,35 +440,17 @@ Id *space_get_objects_ids(Space *s)
 }
 
 /**
- * It sets the graphic description of a spaces.
+ * It gets if there is an object with id id in a space s.
  */
 BOOL space_has_object(Space *s, Id id)
 {
-  Id *ids = NULL;
-  BOOL b = FALSE;
-  int i;
-
   /* Error control*/
   if (!s)
   {
     return FALSE;
   }
 
-  ids = set_get_ids(s->objects);
-  if (ids == NULL)
-  {
-    return FALSE;
-  }
-
-  for (i = 0; (i < set_get_nids(s->objects)) && (b == FALSE); i++)
-  {
-    if (*(ids + i) == id)
-    {
-      b = TRUE;
-    }
-  }
-
-  return b;
+  return set_idInSet(s->objects, id);
 }
 
 char **space_create_gdesc()
@@ -498,20 +512,26 @@ STATUS space_destroy_gdesc(char **gdesc)
 /**
  * It gets the graphic description from a space.
  */
-STATUS space_set_gdesc(Space *s, char **newgdesc)
+STATUS space_set_gdesc(Space *s, Atlas *atlas, char **newgdesc)
 {
   /* Error control*/
-  if (!s || !newgdesc)
+  if (!s || !atlas || !newgdesc)
   {
     return ERROR;
   }
 
-  s->gdesc = newgdesc;
+  /* The rows are copied, newgdesc still belongs to the caller */
+  s->gdesc = atlas_add(atlas, (const char **)newgdesc, TAM_GDESC_Y, TAM_GDESC_X);
+  if (!s->gdesc)
+  {
+    return ERROR;
+  }
 
+  s->revision = ++space_revision;
   return OK;
 }
 
-char **space_get_gdesc(Space *s)
+const Atlas_row *space_get_gdesc(Space *s)
 {
   /* Error control*/
   if (!s)
@@ -529,6 +549,7 @@ STATUS space_print(Space *space)
   Id idaux = NO_ID;
   int nobj, i, j;
   Light ls;
+  const Atlas_row *gdesc = NULL;
 
   /* Error Control */
   if (!space)
@@ -611,11 +632,12 @@ STATUS space_print(Space *space)
 
   /* 5. Print gdesc*/
   printf("=> Gdesc:\n");
-  for (i = 0; i < TAM_GDESC_Y && space->gdesc[i]; i++)
+  gdesc = space->gdesc;
+  for (i = 0; i < TAM_GDESC_Y && gdesc; i++)
   {
-    for (j = 0; j < TAM_GDESC_X && space->gdesc[i][j]; j++)
+    for (j = 0; j < TAM_GDESC_X && gdesc[i][j]; j++)
     {
-      printf("%c", space->gdesc[i][j]);
+      printf("%c", gdesc[i][j]);
     }
     printf("\n");
     if (j != TAM_GDESC_X)
@@ -655,6 +677,7 @@ STATUS space_set_light_status (Space *space, Light ls)
     space->ls = BRIGHT;
   }
 
+  space->revision = ++space_revision;
   return OK;
 }
 
@@ -674,6 +697,7 @@ STATUS space_print_save(char *filename, Space *space)
 {
   int i = 0, j = 0;
   FILE *file = NULL;
+  const Atlas_row *gdesc = NULL;
 
   file = fopen(filename, "a");
 
@@ -685,11 +709,12 @@ STATUS space_print_save(char *filename, Space *space)
 
   fprintf(file, "#s:%ld|%s|%s|%s|%d|", space->id, space->name, space->brief_description, space->long_description, space->ls);
 
-  for (i = 0; i < TAM_GDESC_Y && space->gdesc[i]; i++)
+  gdesc = space->gdesc;
+  for (i = 0; i < TAM_GDESC_Y && gdesc; i++)
   {
-    for (j = 0; j < TAM_GDESC_X && space->gdesc[i][j]; j++)
+    for (j = 0; j < TAM_GDESC_X && gdesc[i][j]; j++)
     {
-      fprintf(file, "%c", space->gdesc[i][j]);
+      fprintf(file, "%c", gdesc[i][j]);
     }
     fprintf(file, "|");
   }
@@ -746,5 +771,19 @@ STATUS space_set_fire(Space *s, BOOL fire)
   }
   
   s->fire = fire;
+  s->revision = ++space_revision;
   return OK;
 }
+
+/**
+ * It gets the stamp of the last change of a space
+ */
+unsigned long space_get_revision(Space *s)
+{
+  if (!s)
+  {
+    return 0;
+  }
+
+  return s->revision;
+}
@@ -0,0 +1,351 @@
+/**
+ * @brief It implements the stream of painted frames to spectators
+ *
+ * @file stream.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#define _POSIX_C_SOURCE 200112L /*!< For lstat and S_ISSOCK with -ansi */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../include/stream.h"
+#include "../include/frame.h"
+
+/**
+ * @brief Viewer of a stream
+ *
+ * The queue is a ring: the bytes not sent yet start at head and go on,
+ * wrapping around, for size bytes.
+ */
+typedef struct
+{
+  int fd;      /*!< Socket of the viewer, -1 if the place is free */
+  char *ring;  /*!< Queue of bytes to send (STREAM_RING bytes) */
+  size_t head; /*!< First byte not sent yet */
+  size_t size; /*!< Bytes not sent yet */
+  BOOL key;    /*!< TRUE if the next frame queued must be a keyframe */
+} Stream_viewer;
+
+/**
+ * @brief Stream
+ */
+struct _Stream
+{
+  int fd;                                 /*!< Listening socket */
+  struct sockaddr_un addr;                /*!< Address of the socket */
+  Frame *key;                             /*!< Builds the keyframes */
+  Stream_viewer viewers[STREAM_VIEWERS];  /*!< Viewers, free places have fd -1 */
+  int n_viewers;                          /*!< Viewers connected */
+  long dropped;                           /*!< Frames dropped */
+  long keyframes;                         /*!< Keyframes queued */
+};
+
+/**
+ * Private functions
+ */
+void stream_accept(Stream *stream);
+void stream_close(Stream *stream, Stream_viewer *v);
+BOOL stream_queue(Stream_viewer *v, const char *bytes, size_t len);
+void stream_send(Stream *stream, Stream_viewer *v);
+
+/**
+ * @brief Lets in the viewers waiting to connect
+ * @author Miguel Soto
+ *
+ * The ones that do not fit are closed.
+ *
+ * @param stream a pointer to the stream
+ */
+void stream_accept(Stream *stream)
+{
+  Stream_viewer *v = NULL;
+  int fd, i;
+
+  while ((fd = accept(stream->fd, NULL, NULL)) >= 0)
+  {
+    v = NULL;
+    for (i = 0; i < STREAM_VIEWERS && !v; i++)
+    {
+      if (stream->viewers[i].fd < 0)
+      {
+        v = &stream->viewers[i];
+      }
+    }
+
+    if (!v || fcntl(fd, F_SETFL, O_NONBLOCK) < 0 || (!v->ring && !(v->ring = (char *)malloc(STREAM_RING))))
+    {
+      close(fd);
+      continue;
+    }
+
+    v->fd = fd;
+    v->head = 0;
+    v->size = 0;
+    v->key = TRUE;
+    stream->n_viewers++;
+  }
+}
+
+/**
+ * @brief Closes a viewer
+ * @author Miguel Soto
+ *
+ * Its queue is kept for the next viewer in its place.
+ *
+ * @param stream a pointer to the stream
+ * @param v the viewer
+ */
+void stream_close(Stream *stream, Stream_viewer *v)
+{
+  close(v->fd);
+  v->fd = -1;
+  stream->n_viewers--;
+}
+
+/**
+ * @brief Queues bytes for a viewer, only if all of them fit
+ * @author Miguel Soto
+ *
+ * @param v the viewer
+ * @param bytes the bytes
+ * @param len number of bytes
+ * @return TRUE if they were queued, FALSE if they did not fit
+ */
+BOOL stream_queue(Stream_viewer *v, const char *bytes, size_t len)
+{
+  size_t tail, n;
+
+  if (len > STREAM_RING - v->size)
+  {
+    return FALSE;
+  }
+
+  tail = (v->head + v->size) % STREAM_RING;
+  n = len < STREAM_RING - tail ? len : STREAM_RING - tail;
+  memcpy(v->ring + tail, bytes, n);
+  memcpy(v->ring, bytes + n, len - n);
+  v->size += len;
+
+  return TRUE;
+}
+
+/**
+ * @brief Sends the queue of a viewer as far as its socket takes it
+ * @author Miguel Soto
+ *
+ * A viewer whose socket fails (it left) is closed.
+ *
+ * @param stream a pointer to the stream
+ * @param v the viewer
+ */
+void stream_send(Stream *stream, Stream_viewer *v)
+{
+  size_t n;
+  long sent;
+
+  while (v->size > 0)
+  {
+    n = v->size < STREAM_RING - v->head ? v->size : STREAM_RING - v->head;
+    sent = (long)send(v->fd, v->ring + v->head, n, MSG_DONTWAIT | MSG_NOSIGNAL);
+    if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+    {
+      return;
+    }
+    if (sent <= 0)
+    {
+      stream_close(stream, v);
+      return;
+    }
+
+    v->head = (v->head + sent) % STREAM_RING;
+    v->size -= sent;
+  }
+}
+
+/**
+ * stream_create opens the socket of a stream
+ */
+Stream *stream_create(const char *path, int rows, int columns)
+{
+  Stream *stream = NULL;
+  struct stat info;
+  int i;
+
+  /* Error control */
+  if (!path || strlen(path) >= sizeof(stream->addr.sun_path))
+  {
+    return NULL;
+  }
+
+  /* Only a socket left by an earlier game is removed, never other files */
+  if (lstat(path, &info) == 0)
+  {
+    if (!S_ISSOCK(info.st_mode))
+    {
+      return NULL;
+    }
+    unlink(path);
+  }
+
+  stream = (Stream *)calloc(1, sizeof(Stream));
+  if (!stream)
+  {
+    return NULL;
+  }
+
+  stream->fd = -1;
+  for (i = 0; i < STREAM_VIEWERS; i++)
+  {
+    stream->viewers[i].fd = -1;
+  }
+  stream->addr.sun_family = AF_UNIX;
+  strcpy(stream->addr.sun_path, path);
+
+  stream->key = frame_create(rows, columns);
+  stream->fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (!stream->key || stream->fd < 0 || bind(stream->fd, (struct sockaddr *)&stream->addr, sizeof(stream->addr)) < 0 ||
+      listen(stream->fd, STREAM_VIEWERS) < 0 || fcntl(stream->fd, F_SETFL, O_NONBLOCK) < 0)
+  {
+    stream_destroy(stream);
+    return NULL;
+  }
+
+  return stream;
+}
+
+/**
+ * stream_destroy closes every viewer and the socket
+ */
+void stream_destroy(Stream *stream)
+{
+  int i;
+
+  if (!stream)
+  {
+    return;
+  }
+
+  for (i = 0; i < STREAM_VIEWERS; i++)
+  {
+    if (stream->viewers[i].fd >= 0)
+    {
+      stream_close(stream, &stream->viewers[i]);
+    }
+    free(stream->viewers[i].ring);
+  }
+
+  if (stream->fd >= 0)
+  {
+    close(stream->fd);
+    unlink(stream->addr.sun_path);
+  }
+  frame_destroy(stream->key);
+  free(stream);
+}
+
+/**
+ * stream_publish queues a frame for every viewer and sends what it can
+ */
+int stream_publish(Stream *stream, const char *cells, const char *changes, size_t len)
+{
+  Stream_viewer *v = NULL;
+  const char *key = NULL;
+  size_t key_len = 0;
+  int i;
+
+  /* Error control */
+  if (!stream || !cells || (!changes && len > 0))
+  {
+    return -1;
+  }
+
+  stream_accept(stream);
+
+  for (i = 0; i < STREAM_VIEWERS; i++)
+  {
+    v = &stream->viewers[i];
+    if (v->fd < 0)
+    {
+      continue;
+    }
+
+    if (v->key)
+    {
+      /* Built once per frame, only if somebody needs it */
+      if (!key)
+      {
+        frame_load(stream->key, cells);
+        frame_invalidate(stream->key);
+        key = frame_render(stream->key, &key_len);
+      }
+      if (key && stream_queue(v, key, key_len))
+      {
+        v->key = FALSE;
+        stream->keyframes++;
+      }
+      else
+      {
+        stream->dropped++;
+      }
+    }
+    else if (stream_queue(v, changes, len) == FALSE)
+    {
+      /* The changes of the next frames would be wrong without this one */
+      v->key = TRUE;
+      stream->dropped++;
+    }
+
+    stream_send(stream, v);
+  }
+
+  return stream->n_viewers;
+}
+
+/**
+ * It gets the viewers connected
+ */
+int stream_get_viewers(Stream *stream)
+{
+  if (!stream)
+  {
+    return -1;
+  }
+
+  return stream->n_viewers;
+}
+
+/**
+ * It gets the frames dropped
+ */
+long stream_get_dropped(Stream *stream)
+{
+  if (!stream)
+  {
+    return -1;
+  }
+
+  return stream->dropped;
+}
+
+/**
+ * It gets the keyframes queued
+ */
+long stream_get_keyframes(Stream *stream)
+{
+  if (!stream)
+  {
+    return -1;
+  }
+
+  return stream->keyframes;
+}
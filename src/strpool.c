@@ -0,0 +1,213 @@
+/**
+ * @brief It implements the interned string pool
+ *
+ * @file strpool.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <string.h>
+#include "../include/strpool.h"
+
+#define STRPOOL_TABLE_MIN 64     /*!< Minimun entries of the hash table */
+
+/**
+ * @brief String pool
+ *
+ * Texts are copied into an arena and found through an open-addressed
+ * hash table that is kept at most half full.
+ */
+struct _Strpool
+{
+  Arena *arena;        /*!< Memory of the pool */
+  const char **table;  /*!< Hash table, pooled string or NULL */
+  int n_table;         /*!< Entries of the hash table (power of 2) */
+  int n_strings;       /*!< Number of different strings */
+  size_t bytes;        /*!< Bytes of the texts (with their '\0') */
+};
+
+/**
+ * Private functions
+ */
+unsigned long strpool_hash(const char *str);
+int strpool_probe(const char **table, int n_table, const char *str, unsigned long hash);
+STATUS strpool_grow(Strpool *pool);
+
+/**
+ * strpool_create creates an empty pool in an arena
+ */
+Strpool *strpool_create(Arena *arena)
+{
+  Strpool *pool = NULL;
+
+  /* Error control */
+  if (!arena)
+  {
+    return NULL;
+  }
+
+  pool = (Strpool *)arena_alloc(arena, sizeof(Strpool));
+  if (!pool)
+  {
+    return NULL;
+  }
+
+  pool->arena = arena;
+  pool->table = NULL;
+  pool->n_table = 0;
+  pool->n_strings = 0;
+  pool->bytes = 0;
+
+  return pool;
+}
+
+/**
+ * @brief Hashes a string (FNV-1a)
+ * @author Miguel Soto
+ *
+ * @param str string
+ * @return the hash
+ */
+unsigned long strpool_hash(const char *str)
+{
+  unsigned long hash = 2166136261UL;
+
+  for (; *str; str++)
+  {
+    hash = (hash ^ (unsigned char)*str) * 16777619UL;
+  }
+
+  return hash;
+}
+
+/**
+ * @brief Gets the entry of a string in a hash table
+ * @author Miguel Soto
+ *
+ * @param table hash table
+ * @param n_table entries of the table
+ * @param str string
+ * @param hash hash of str
+ * @return the entry that holds str, or the empty entry where it would go
+ */
+int strpool_probe(const char **table, int n_table, const char *str, unsigned long hash)
+{
+  int entry = (int)(hash & (unsigned long)(n_table - 1));
+
+  while (table[entry] && strcmp(table[entry], str) != 0)
+  {
+    entry = (entry + 1) & (n_table - 1);
+  }
+
+  return entry;
+}
+
+/**
+ * @brief Doubles the hash table (or creates it)
+ * @author Miguel Soto
+ *
+ * The old table stays in the arena, like everything else of the pool.
+ *
+ * @param pool the pool
+ * @return OK if everything goes well, or ERROR if anything doesn't.
+ */
+STATUS strpool_grow(Strpool *pool)
+{
+  const char **table = NULL;
+  int n_table = pool->n_table ? 2 * pool->n_table : STRPOOL_TABLE_MIN;
+  int i;
+
+  table = (const char **)arena_alloc(pool->arena, n_table * sizeof(const char *));
+  if (!table)
+  {
+    return ERROR;
+  }
+  memset(table, 0, n_table * sizeof(const char *));
+
+  for (i = 0; i < pool->n_table; i++)
+  {
+    if (pool->table[i])
+    {
+      table[strpool_probe(table, n_table, pool->table[i], strpool_hash(pool->table[i]))] = pool->table[i];
+    }
+  }
+
+  pool->table = table;
+  pool->n_table = n_table;
+
+  return OK;
+}
+
+/**
+ * strpool_intern gets the pooled copy of a string
+ */
+const char *strpool_intern(Strpool *pool, const char *str)
+{
+  unsigned long hash;
+  size_t len;
+  char *copy = NULL;
+  int entry;
+
+  /* Error control */
+  if (!pool || !str)
+  {
+    return NULL;
+  }
+
+  if (2 * (pool->n_strings + 1) > pool->n_table && strpool_grow(pool) == ERROR)
+  {
+    return NULL;
+  }
+
+  hash = strpool_hash(str);
+  entry = strpool_probe(pool->table, pool->n_table, str, hash);
+  if (pool->table[entry])
+  {
+    return pool->table[entry];
+  }
+
+  /* New text, it is copied once */
+  len = strlen(str) + 1;
+  copy = (char *)arena_alloc(pool->arena, len);
+  if (!copy)
+  {
+    return NULL;
+  }
+  memcpy(copy, str, len);
+
+  pool->table[entry] = copy;
+  pool->n_strings++;
+  pool->bytes += len;
+
+  return copy;
+}
+
+/**
+ * It gets the number of strings of the pool
+ */
+int strpool_get_count(Strpool *pool)
+{
+  /* Error control */
+  if (!pool)
+  {
+    return -1;
+  }
+
+  return pool->n_strings;
+}
+
+/**
+ * It gets the bytes of the texts of the pool
+ */
+size_t strpool_get_bytes(Strpool *pool)
+{
+  /* Error control */
+  if (!pool)
+  {
+    return 0;
+  }
+
+  return pool->bytes;
+}
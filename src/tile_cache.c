@@ -0,0 +1,262 @@
+/**
+ * @brief It implements the cache of the drawn room tiles
+ *
+ * @file tile_cache.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tile_cache.h"
+#include "../include/container.h"
+
+#define TILE_BORDER "+-----------------+" /*!< Top and bottom rows of a tile */
+#define TILE_BLANK "|                 |"  /*!< Empty row of a tile */
+#define TILE_FOG_NAME "¬¬¬¬¬¬¬ "           /*!< Name of a space hidden by the fog */
+#define TILE_FOG_GDESC "¬¬¬¬ "             /*!< Graphic description of a space hidden by the fog */
+
+/**
+ * @brief Tile of a space and what it was drawn from
+ */
+typedef struct
+{
+  unsigned long revision;   /*!< Stamp of the space when it was drawn */
+  const Atlas_row *enemy;   /*!< Graphic description of the enemy drawn, or NULL */
+  BOOL fog;                 /*!< TRUE if it was drawn behind the fog */
+  Tile_row rows[TILE_Y];    /*!< The tile */
+} Tile_entry;
+
+HMAP_DECLARE(Tile_map, Id, Tile_entry *);
+HMAP_DEFINE(Tile_map, Id, Tile_entry *, CONTAINER_HASH_INT, NO_ID);
+
+/**
+ * @brief Tile cache
+ *
+ * Each space has its own entry, so the rows of one tile stay in place while
+ * the tiles of other spaces are drawn.
+ */
+struct _Tile_cache
+{
+  Tile_map tiles; /*!< Entry of each space drawn */
+  long draws;     /*!< Tiles drawn */
+  long hits;      /*!< Tiles taken from the cache */
+};
+
+/**
+ * Private functions
+ */
+void tile_cache_draw(Tile_entry *entry, Game *game, Space *s, const Atlas_row *enemy, BOOL fog);
+
+/**
+ * @brief Draws the tile of a space
+ * @author Miguel Soto
+ *
+ * @param entry where the tile is drawn
+ * @param game pointer to the game
+ * @param s the space
+ * @param enemy graphic description of the enemy in the space, or NULL
+ * @param fog TRUE to hide the space
+ */
+void tile_cache_draw(Tile_entry *entry, Game *game, Space *s, const Atlas_row *enemy, BOOL fog)
+{
+  const Atlas_row *gdesc = NULL;
+  Set *objects = NULL;
+  char name[20], obj = ' ';
+  const char *row = NULL;
+  int i;
+
+  /* The mark of the room, if any of its objects can be seen with its light */
+  objects = space_get_objects(s);
+  for (i = 0; i < set_get_nids(objects); i++)
+  {
+    if (obj_is_visible(game_get_object(game, set_get_ids_by_number(objects, i)), space_get_light_status(s)) == TRUE)
+    {
+      obj = '*';
+      break;
+    }
+  }
+
+  sprintf(name, "%-15.19s", space_get_name(s));
+  if (fog)
+  {
+    strcpy(name, TILE_FOG_NAME);
+  }
+
+  strcpy(entry->rows[0], TILE_BORDER);
+  sprintf(entry->rows[1], "| %s |", name);
+  strcpy(entry->rows[2], TILE_BLANK);
+  strcpy(entry->rows[3], TILE_BLANK);
+
+  gdesc = space_get_gdesc(s);
+  for (i = 0; i < TAM_GDESC_Y; i++)
+  {
+    row = fog ? TILE_FOG_GDESC : (gdesc ? gdesc[i] : "");
+    if (enemy && i < ENEMY_GDESC_Y)
+    {
+      sprintf(entry->rows[4 + i], "| %s %s|", enemy[i], row);
+    }
+    else if (enemy)
+    {
+      sprintf(entry->rows[4 + i], "|        %s|", row);
+    }
+    else
+    {
+      sprintf(entry->rows[4 + i], "|    %s    |", row);
+    }
+  }
+
+  strcpy(entry->rows[9], TILE_BLANK);
+  sprintf(entry->rows[TILE_OBJECT_ROW], "|        %c        |", obj);
+  strcpy(entry->rows[11], TILE_BORDER);
+}
+
+/**
+ * tile_cache_create allocates an empty cache
+ */
+Tile_cache *tile_cache_create()
+{
+  Tile_cache *cache = NULL;
+
+  cache = (Tile_cache *)malloc(sizeof(Tile_cache));
+  if (!cache)
+  {
+    return NULL;
+  }
+
+  if (Tile_map_init(&cache->tiles, NULL) == ERROR)
+  {
+    free(cache);
+    return NULL;
+  }
+  cache->draws = 0;
+  cache->hits = 0;
+
+  return cache;
+}
+
+/**
+ * tile_cache_destroy frees the cache and its tiles
+ */
+void tile_cache_destroy(Tile_cache *cache)
+{
+  if (!cache)
+  {
+    return;
+  }
+
+  tile_cache_clear(cache);
+  Tile_map_free(&cache->tiles);
+  free(cache);
+}
+
+/**
+ * tile_cache_get gets the tile of a space, drawn again only if it changed
+ */
+const Tile_row *tile_cache_get(Tile_cache *cache, Game *game, Id space, BOOL occupant, BOOL fog)
+{
+  Tile_entry **found = NULL, *entry = NULL;
+  const Atlas_row *enemy = NULL;
+  Enemy *e = NULL;
+  Space *s = NULL;
+
+  /* Error control */
+  if (!cache || !game || space == NO_ID)
+  {
+    return NULL;
+  }
+
+  s = game_get_space(game, space);
+  if (!s)
+  {
+    return NULL;
+  }
+
+  if (occupant && (e = game_get_enemy_in_space(game, space)) != NULL)
+  {
+    enemy = enemy_get_gdesc(e);
+  }
+
+  found = Tile_map_get(&cache->tiles, space);
+  if (found)
+  {
+    entry = *found;
+    if (entry->revision == space_get_revision(s) && entry->enemy == enemy && entry->fog == fog)
+    {
+      cache->hits++;
+      return (const Tile_row *)entry->rows;
+    }
+  }
+  else
+  {
+    entry = (Tile_entry *)malloc(sizeof(Tile_entry));
+    if (!entry)
+    {
+      return NULL;
+    }
+    if (Tile_map_put(&cache->tiles, space, entry) == ERROR)
+    {
+      free(entry);
+      return NULL;
+    }
+  }
+
+  tile_cache_draw(entry, game, s, enemy, fog);
+  entry->revision = space_get_revision(s);
+  entry->enemy = enemy;
+  entry->fog = fog;
+  cache->draws++;
+
+  return (const Tile_row *)entry->rows;
+}
+
+/**
+ * tile_cache_clear forgets every tile
+ */
+void tile_cache_clear(Tile_cache *cache)
+{
+  int i;
+
+  if (!cache)
+  {
+    return;
+  }
+
+  for (i = 0; i < cache->tiles.n_entries; i++)
+  {
+    if (cache->tiles.entries[i].key != NO_ID)
+    {
+      free(cache->tiles.entries[i].value);
+    }
+  }
+  Tile_map_clear(&cache->tiles);
+}
+
+/**
+ * It gets the number of tiles drawn
+ */
+long tile_cache_get_draws(Tile_cache *cache)
+{
+  if (!cache)
+  {
+    return -1;
+  }
+
+  return cache->draws;
+}
+
+/**
+ * It gets the number of tiles taken from the cache
+ */
+long tile_cache_get_hits(Tile_cache *cache)
+{
+  if (!cache)
+  {
+    return -1;
+  }
+
+  return cache->hits;
+}
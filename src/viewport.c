@@ -0,0 +1,249 @@
+/**
+ * @brief It implements the viewport over the rooms of a floor
+ *
+ * @file viewport.c
+ * @author Miguel Soto, Nicolas Victorino, Antonio Van-Oers, Ignacio Nunez
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "../include/viewport.h"
+#include "../include/container.h"
+
+HMAP_DECLARE(Room_map, Id, int);
+HMAP_DEFINE(Room_map, Id, int, CONTAINER_HASH_INT, NO_ID);
+
+/**
+ * @brief Viewport
+ *
+ * Every array has a place for each cell, row after row. The link of a cell
+ * to the east and to the south is kept in the cell; the other two are the
+ * ones of the cell next to it.
+ */
+struct _Viewport
+{
+  int width;            /*!< Rooms across the grid */
+  int height;           /*!< Rooms down the grid */
+  int radius;           /*!< Links walked from the centre, VIEWPORT_FLOOR for no limit */
+  Id *rooms;            /*!< Room of each cell */
+  int *depth;           /*!< Links from the centre to the room of each cell */
+  unsigned char *east;  /*!< Link of each cell to the east */
+  unsigned char *south; /*!< Link of each cell to the south */
+  int *queue;           /*!< Cells still to be walked from */
+  Room_map placed;      /*!< Cell of each room placed */
+};
+
+/**
+ * viewport_create allocates an empty viewport
+ */
+Viewport *viewport_create(int width, int height, int radius)
+{
+  Viewport *vp = NULL;
+  size_t n;
+
+  /* Error control */
+  if (width <= 0 || height <= 0)
+  {
+    return NULL;
+  }
+
+  vp = (Viewport *)calloc(1, sizeof(Viewport));
+  if (!vp)
+  {
+    return NULL;
+  }
+
+  n = (size_t)width * height;
+  vp->width = width;
+  vp->height = height;
+  vp->radius = radius;
+  vp->rooms = (Id *)malloc(n * sizeof(Id));
+  vp->depth = (int *)malloc(n * sizeof(int));
+  vp->east = (unsigned char *)malloc(n);
+  vp->south = (unsigned char *)malloc(n);
+  vp->queue = (int *)malloc(n * sizeof(int));
+  if (!vp->rooms || !vp->depth || !vp->east || !vp->south || !vp->queue || Room_map_init(&vp->placed, NULL) == ERROR)
+  {
+    viewport_destroy(vp);
+    return NULL;
+  }
+
+  viewport_layout(vp, NULL, NO_ID);
+
+  return vp;
+}
+
+/**
+ * viewport_destroy frees a viewport
+ */
+void viewport_destroy(Viewport *vp)
+{
+  if (!vp)
+  {
+    return;
+  }
+
+  free(vp->rooms);
+  free(vp->depth);
+  free(vp->east);
+  free(vp->south);
+  free(vp->queue);
+  Room_map_free(&vp->placed);
+  free(vp);
+}
+
+/**
+ * viewport_layout walks the links from the centre, placing the rooms found
+ */
+int viewport_layout(Viewport *vp, Game *game, Id center)
+{
+  static const int dx[4] = {0, 0, 1, -1}; /* N, S, E, W */
+  static const int dy[4] = {-1, 1, 0, 0};
+  Space *s = NULL;
+  Link *l = NULL;
+  Id dest;
+  int n, i, c, next, x, y, head = 0, tail = 0, placed = 0;
+  unsigned char *cell = NULL;
+
+  /* Error control */
+  if (!vp)
+  {
+    return -1;
+  }
+
+  n = vp->width * vp->height;
+  for (i = 0; i < n; i++)
+  {
+    vp->rooms[i] = NO_ID;
+  }
+  memset(vp->east, VIEWPORT_NONE, n);
+  memset(vp->south, VIEWPORT_NONE, n);
+  Room_map_clear(&vp->placed);
+
+  if (!game || !game_get_space(game, center))
+  {
+    return 0;
+  }
+
+  c = (vp->height / 2) * vp->width + vp->width / 2;
+  vp->rooms[c] = center;
+  vp->depth[c] = 0;
+  Room_map_put(&vp->placed, center, c);
+  vp->queue[tail++] = c;
+  placed++;
+
+  while (head < tail)
+  {
+    c = vp->queue[head++];
+    if (vp->radius != VIEWPORT_FLOOR && vp->depth[c] >= vp->radius)
+    {
+      continue;
+    }
+
+    s = game_get_space(game, vp->rooms[c]);
+    for (i = 0; i < 4; i++)
+    {
+      l = game_get_link(game, space_get_link(s, (DIRECTION)i));
+      dest = space_get_id_dest_by_link(l);
+      x = c % vp->width + dx[i];
+      y = c / vp->width + dy[i];
+
+      /* The walk stops at the border of the grid */
+      if (!l || dest == NO_ID || x < 0 || x >= vp->width || y < 0 || y >= vp->height)
+      {
+        continue;
+      }
+
+      next = y * vp->width + x;
+      if (vp->rooms[next] == NO_ID && !Room_map_get(&vp->placed, dest) && game_get_space(game, dest))
+      {
+        vp->rooms[next] = dest;
+        vp->depth[next] = vp->depth[c] + 1;
+        Room_map_put(&vp->placed, dest, next);
+        vp->queue[tail++] = next;
+        placed++;
+      }
+
+      if (vp->rooms[next] != dest)
+      {
+        continue;
+      }
+
+      /* Each room has its own link to the other one, closed wins */
+      cell = (i == E || i == S) ? &(i == E ? vp->east : vp->south)[c] : &(i == W ? vp->east : vp->south)[next];
+      if (*cell != VIEWPORT_CLOSED)
+      {
+        *cell = link_get_status(l) == OPEN_L ? VIEWPORT_OPEN : VIEWPORT_CLOSED;
+      }
+    }
+  }
+
+  return placed;
+}
+
+/**
+ * It gets the room of a cell
+ */
+Id viewport_get_room(Viewport *vp, int x, int y)
+{
+  if (!vp || x < 0 || x >= vp->width || y < 0 || y >= vp->height)
+  {
+    return NO_ID;
+  }
+
+  return vp->rooms[y * vp->width + x];
+}
+
+/**
+ * It gets the link from a cell to the next one
+ */
+Viewport_link viewport_get_link(Viewport *vp, int x, int y, DIRECTION dir)
+{
+  /* The links to the north and to the west are kept by the cell next to it */
+  if (dir == N)
+  {
+    y--;
+    dir = S;
+  }
+  else if (dir == W)
+  {
+    x--;
+    dir = E;
+  }
+
+  if (!vp || x < 0 || x >= vp->width || y < 0 || y >= vp->height || (dir != E && dir != S))
+  {
+    return VIEWPORT_NONE;
+  }
+
+  return (Viewport_link)(dir == E ? vp->east : vp->south)[y * vp->width + x];
+}
+
+/**
+ * It gets the rooms across the grid
+ */
+int viewport_get_width(Viewport *vp)
+{
+  if (!vp)
+  {
+    return -1;
+  }
+
+  return vp->width;
+}
+
+/**
+ * It gets the rooms down the grid
+ */
+int viewport_get_height(Viewport *vp)
+{
+  if (!vp)
+  {
+    return -1;
+  }
+
+  return vp->height;
+}
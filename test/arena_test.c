@@ -0,0 +1,177 @@
+/**
+ * @brief It tests arena module
+ *
+ * @file arena_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/arena.h"
+#include "../include/space.h"
+#include "arena_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for arena unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module arena:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_arena_create();
+  i++;
+  if (all || test == i) test1_arena_destroy();
+  i++;
+  if (all || test == i) test1_arena_alloc();
+  i++;
+  if (all || test == i) test2_arena_alloc();
+  i++;
+  if (all || test == i) test3_arena_alloc();
+  i++;
+  if (all || test == i) test1_arena_reset();
+  i++;
+  if (all || test == i) test1_arena_get_high_water();
+  i++;
+  if (all || test == i) test1_arena_space();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* arena_create */
+void test1_arena_create()
+{
+  Arena *a = NULL;
+  a = arena_create(0);
+  PRINT_TEST_RESULT(a != NULL && arena_get_used(a) == 0 && arena_get_reserved(a) == 0);
+  arena_destroy(a);
+}
+
+/* arena_destroy */
+void test1_arena_destroy()
+{
+  Arena *a = NULL;
+  PRINT_TEST_RESULT(arena_destroy(a) == ERROR);
+}
+
+/* arena_alloc */
+void test1_arena_alloc()
+{
+  Arena *a = NULL;
+  char *c = NULL;
+  double *d = NULL;
+  a = arena_create(0);
+  c = (char *)arena_alloc(a, 3);
+  d = (double *)arena_alloc(a, 10);
+  PRINT_TEST_RESULT(c != NULL && d != NULL && (unsigned long)d % sizeof(double) == 0);
+  arena_destroy(a);
+}
+void test2_arena_alloc()
+{
+  PRINT_TEST_RESULT(arena_alloc(NULL, 10) == NULL);
+}
+void test3_arena_alloc()
+{
+  Arena *a = NULL;
+  char *c = NULL;
+  a = arena_create(64);
+  arena_alloc(a, 10);
+  c = (char *)arena_alloc(a, 1000);
+  if (c)
+  {
+    memset(c, 'x', 1000);
+  }
+  PRINT_TEST_RESULT(c != NULL && arena_get_reserved(a) >= 1064);
+  arena_destroy(a);
+}
+
+/* arena_reset */
+void test1_arena_reset()
+{
+  Arena *a = NULL;
+  size_t reserved;
+  int i;
+  a = arena_create(1024);
+  for (i = 0; i < 100; i++)
+  {
+    arena_alloc(a, 100);
+  }
+  reserved = arena_get_reserved(a);
+  arena_reset(a);
+  for (i = 0; i < 100; i++)
+  {
+    arena_alloc(a, 100);
+  }
+  PRINT_TEST_RESULT(arena_get_reserved(a) == reserved && arena_reset(a) == OK && arena_get_used(a) == 0);
+  arena_destroy(a);
+}
+
+/* arena_get_high_water */
+void test1_arena_get_high_water()
+{
+  Arena *a = NULL;
+  a = arena_create(0);
+  arena_alloc(a, 100);
+  arena_reset(a);
+  arena_alloc(a, 10);
+  PRINT_TEST_RESULT(arena_get_high_water(a) >= 100 && arena_get_used(a) < 100);
+  arena_destroy(a);
+}
+
+/* space_create_in */
+void test1_arena_space()
+{
+  Arena *a = NULL;
+  Space *s = NULL;
+  Id id;
+  BOOL all_in = TRUE;
+  a = arena_create(0);
+  s = space_create_in(11, a);
+  for (id = 300; id < 320; id++)
+  {
+    space_add_objectid(s, id);
+  }
+  for (id = 300; id < 320; id++)
+  {
+    if (space_has_object(s, id) == FALSE)
+    {
+      all_in = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(all_in == TRUE && space_get_id(s) == 11 && space_destroy(s) == OK && space_get_id(s) == 11);
+  arena_destroy(a);
+}
@@ -0,0 +1,68 @@
+/** 
+ * @brief It declares the tests for the arena module
+ * 
+ * @file arena_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ARENA_TEST_H
+#define ARENA_TEST_H
+
+/**
+ * @test Test arena creation
+ * @pre block size = 0
+ * @post Non NULL pointer to arena
+ */
+void test1_arena_create();
+
+/**
+ * @test Test free arena
+ * @pre pointer to arena = NULL
+ * @post Output == ERROR
+ */
+void test1_arena_destroy();
+
+/**
+ * @test Test function for allocating memory
+ * @pre pointer to arena and 10 bytes
+ * @post Non NULL pointer, aligned for a double
+ */
+void test1_arena_alloc();
+/**
+ * @test Test function for allocating memory
+ * @pre pointer to arena = NULL
+ * @post Output == NULL
+ */
+void test2_arena_alloc();
+/**
+ * @test Test function for allocating more than a block
+ * @pre block size = 64, 1000 bytes allocated
+ * @post Non NULL pointer and the 1000 bytes can be written
+ */
+void test3_arena_alloc();
+
+/**
+ * @test Test function for resetting an arena
+ * @pre 100 allocations of 100 bytes, reset and the same allocations again
+ * @post nothing more is reserved and used goes back to 0
+ */
+void test1_arena_reset();
+
+/**
+ * @test Test function for the high-water mark
+ * @pre 100 bytes allocated, reset and 10 bytes allocated
+ * @post high water >= 100 and used < 100
+ */
+void test1_arena_get_high_water();
+
+/**
+ * @test Test function for creating a space, its set and gdesc in an arena
+ * @pre space in an arena with 20 objects
+ * @post the space works and destroying it does not free it
+ */
+void test1_arena_space();
+
+#endif
@@ -0,0 +1,171 @@
+/**
+ * @brief It tests atlas module
+ *
+ * @file atlas_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/atlas.h"
+#include "../include/space.h"
+#include "atlas_test.h"
+#include "test.h"
+
+#define MAX_TESTS 7 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for atlas unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module atlas:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_atlas_add();
+  i++;
+  if (all || test == i) test2_atlas_add();
+  i++;
+  if (all || test == i) test3_atlas_add();
+  i++;
+  if (all || test == i) test4_atlas_add();
+  i++;
+  if (all || test == i) test5_atlas_add();
+  i++;
+  if (all || test == i) test1_atlas_get_count();
+  i++;
+  if (all || test == i) test1_atlas_space();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* atlas_add */
+void test1_atlas_add()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  const char *rows[3] = {"0^0", "/|\\", "/ \\"};
+  const Atlas_row *tile = NULL;
+  tile = atlas_add(atlas, rows, 3, 4);
+  PRINT_TEST_RESULT(tile != NULL && strcmp(tile[0], "0^0") == 0 && strcmp(tile[2], "/ \\") == 0 && tile[3][0] == '\0');
+  arena_destroy(arena);
+}
+void test2_atlas_add()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  PRINT_TEST_RESULT(atlas_add(atlas, NULL, 3, 4) == NULL);
+  arena_destroy(arena);
+}
+void test3_atlas_add()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  char row1[] = "#####", row2[] = "#   #";
+  char row3[] = "#####", row4[] = "#   #";
+  const char *rows1[2], *rows2[2];
+  rows1[0] = row1;
+  rows1[1] = row2;
+  rows2[0] = row3;
+  rows2[1] = row4;
+  PRINT_TEST_RESULT(atlas_add(atlas, rows1, 2, 9) == atlas_add(atlas, rows2, 2, 9) && atlas_get_count(atlas) == 1);
+  arena_destroy(arena);
+}
+void test4_atlas_add()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  const char *rows[2] = {"123456789", "abcdefghi"};
+  const Atlas_row *tile = NULL;
+  tile = atlas_add(atlas, rows, 2, 4);
+  PRINT_TEST_RESULT(tile != NULL && strcmp(tile[0], "1234") == 0 && strcmp(tile[1], "abcd") == 0);
+  arena_destroy(arena);
+}
+void test5_atlas_add()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  const Atlas_row *first[200];
+  char row[10];
+  const char *rows[1];
+  int i;
+  BOOL same = TRUE;
+  rows[0] = row;
+  for (i = 0; i < 200; i++)
+  {
+    sprintf(row, "tile %d", i);
+    first[i] = atlas_add(atlas, rows, 1, 9);
+  }
+  for (i = 0; i < 200; i++)
+  {
+    sprintf(row, "tile %d", i);
+    if (atlas_add(atlas, rows, 1, 9) != first[i] || strcmp(first[i][0], row) != 0)
+    {
+      same = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(same == TRUE && atlas_get_count(atlas) == 200);
+  arena_destroy(arena);
+}
+
+/* atlas_get_count */
+void test1_atlas_get_count()
+{
+  Arena *arena = arena_create(0);
+  Atlas *first = atlas_create(arena), *second = atlas_create(arena);
+  const char *rows[1] = {"~~~~"};
+  atlas_add(first, rows, 1, 9);
+  PRINT_TEST_RESULT(atlas_get_count(first) == 1 && atlas_get_count(second) == 0 && atlas_get_count(NULL) == -1);
+  arena_destroy(arena);
+}
+
+/* space_set_gdesc */
+void test1_atlas_space()
+{
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
+  Space *s1 = NULL, *s2 = NULL;
+  char **gdesc = NULL;
+  s1 = space_create(1);
+  s2 = space_create(2);
+  gdesc = space_create_gdesc();
+  strcpy(gdesc[0], "/\\/\\/\\/\\");
+  space_set_gdesc(s1, atlas, gdesc);
+  space_set_gdesc(s2, atlas, gdesc);
+  space_destroy_gdesc(gdesc);
+  PRINT_TEST_RESULT(space_get_gdesc(s1) == space_get_gdesc(s2) && strcmp(space_get_gdesc(s1)[0], "/\\/\\/\\/\\") == 0);
+  space_destroy(s1);
+  space_destroy(s2);
+  arena_destroy(arena);
+}
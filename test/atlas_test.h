@@ -0,0 +1,59 @@
+/** 
+ * @brief It declares the tests for the atlas module
+ * 
+ * @file atlas_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef ATLAS_TEST_H
+#define ATLAS_TEST_H
+
+/**
+ * @test Test function for adding a drawing
+ * @pre drawing of 3 rows of 4 characters
+ * @post a valid tile with the same rows
+ */
+void test1_atlas_add();
+/**
+ * @test Test function for adding a drawing
+ * @pre rows = NULL
+ * @post Output == NULL
+ */
+void test2_atlas_add();
+/**
+ * @test Test function for adding the same drawing twice
+ * @pre two different arrays with the same rows
+ * @post the same tile and only one tile in the atlas
+ */
+void test3_atlas_add();
+/**
+ * @test Test function for adding a drawing with rows too long
+ * @pre rows of 9 characters, row_len = 4
+ * @post rows are cut to 4 characters
+ */
+void test4_atlas_add();
+/**
+ * @test Test function for adding many drawings
+ * @pre 200 different drawings, added twice
+ * @post 200 tiles and each drawing keeps its tile
+ */
+void test5_atlas_add();
+
+/**
+ * @test Test function for the tiles of two atlases
+ * @pre a drawing added to the first atlas only
+ * @post 1 tile in the first, none in the second and -1 for NULL
+ */
+void test1_atlas_get_count();
+
+/**
+ * @test Test function for spaces sharing their drawing
+ * @pre two spaces with the same gdesc
+ * @post both gdesc are the same tile
+ */
+void test1_atlas_space();
+
+#endif
@@ -0,0 +1,273 @@
+/**
+ * @brief It tests the container library
+ *
+ * @file container_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/container.h"
+#include "container_test.h"
+#include "test.h"
+
+#define MAX_TESTS 12 /*!< It defines the maximun tests in this file */
+
+VECTOR_DECLARE(Int_vector, int);
+VECTOR_DEFINE(Int_vector, int);
+HMAP_DECLARE(Int_map, long, int);
+HMAP_DEFINE(Int_map, long, int, CONTAINER_HASH_INT, -1L);
+RING_DECLARE(Int_ring, int);
+RING_DEFINE(Int_ring, int);
+
+/**
+ * @brief Main function for container unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module container:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_vector_push();
+  i++;
+  if (all || test == i) test1_vector_insert();
+  i++;
+  if (all || test == i) test1_vector_remove();
+  i++;
+  if (all || test == i) test1_vector_remove_swap();
+  i++;
+  if (all || test == i) test1_vector_arena();
+  i++;
+  if (all || test == i) test1_hmap_put();
+  i++;
+  if (all || test == i) test2_hmap_put();
+  i++;
+  if (all || test == i) test1_hmap_get();
+  i++;
+  if (all || test == i) test1_hmap_remove();
+  i++;
+  if (all || test == i) test1_ring_push();
+  i++;
+  if (all || test == i) test1_ring_pop();
+  i++;
+  if (all || test == i) test1_bitset();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* Vectors */
+void test1_vector_push()
+{
+  Int_vector v;
+  int i, ok = 1;
+
+  Int_vector_init(&v, NULL);
+  for (i = 0; i < 100; i++)
+  {
+    Int_vector_push(&v, i);
+  }
+  for (i = 0; i < 100; i++)
+  {
+    if (v.data[i] != i)
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok && v.size == 100 && v.capacity >= 100);
+  Int_vector_free(&v);
+}
+void test1_vector_insert()
+{
+  Int_vector v;
+
+  Int_vector_init(&v, NULL);
+  Int_vector_push(&v, 1);
+  Int_vector_push(&v, 3);
+  Int_vector_insert(&v, 1, 2);
+  PRINT_TEST_RESULT(v.size == 3 && v.data[0] == 1 && v.data[1] == 2 && v.data[2] == 3);
+  Int_vector_free(&v);
+}
+void test1_vector_remove()
+{
+  Int_vector v;
+
+  Int_vector_init(&v, NULL);
+  Int_vector_push(&v, 1);
+  Int_vector_push(&v, 2);
+  Int_vector_push(&v, 3);
+  Int_vector_remove(&v, 0);
+  PRINT_TEST_RESULT(v.size == 2 && v.data[0] == 2 && v.data[1] == 3);
+  Int_vector_free(&v);
+}
+void test1_vector_remove_swap()
+{
+  Int_vector v;
+
+  Int_vector_init(&v, NULL);
+  Int_vector_push(&v, 1);
+  Int_vector_push(&v, 2);
+  Int_vector_push(&v, 3);
+  Int_vector_remove_swap(&v, 0);
+  PRINT_TEST_RESULT(v.size == 2 && v.data[0] == 3 && v.data[1] == 2);
+  Int_vector_free(&v);
+}
+void test1_vector_arena()
+{
+  Arena *arena = arena_create(0);
+  Int_vector v;
+  int i, ok = 1;
+
+  Int_vector_init(&v, arena);
+  for (i = 0; i < 100; i++)
+  {
+    Int_vector_push(&v, i);
+  }
+  for (i = 0; i < 100; i++)
+  {
+    if (v.data[i] != i)
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok && v.size == 100);
+  Int_vector_free(&v);
+  arena_destroy(arena);
+}
+
+/* Hash maps */
+void test1_hmap_put()
+{
+  Int_map m;
+  int *x, i, ok = 1;
+
+  Int_map_init(&m, NULL);
+  for (i = 0; i < 1000; i++)
+  {
+    Int_map_put(&m, 300 + 7 * i, i);
+  }
+  for (i = 0; i < 1000; i++)
+  {
+    x = Int_map_get(&m, 300 + 7 * i);
+    if (!x || *x != i)
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok && m.count == 1000 && 2 * m.count <= m.n_entries);
+  Int_map_free(&m);
+}
+void test2_hmap_put()
+{
+  Int_map m;
+
+  Int_map_init(&m, NULL);
+  PRINT_TEST_RESULT(Int_map_put(&m, -1L, 3) == ERROR);
+  Int_map_free(&m);
+}
+void test1_hmap_get()
+{
+  Int_map m;
+
+  Int_map_init(&m, NULL);
+  Int_map_put(&m, 121, 3);
+  PRINT_TEST_RESULT(Int_map_get(&m, 122) == NULL);
+  Int_map_free(&m);
+}
+void test1_hmap_remove()
+{
+  Int_map m;
+  int *x, i, ok = 1;
+
+  Int_map_init(&m, NULL);
+  /* Multiples of a big power of 2 fall on few entries */
+  for (i = 0; i < 64; i++)
+  {
+    Int_map_put(&m, (long)i << 12, i);
+  }
+  for (i = 0; i < 64; i += 2)
+  {
+    Int_map_remove(&m, (long)i << 12);
+  }
+  for (i = 0; i < 64; i++)
+  {
+    x = Int_map_get(&m, (long)i << 12);
+    if ((i % 2 == 0 && x) || (i % 2 == 1 && (!x || *x != i)))
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok && m.count == 32);
+  Int_map_free(&m);
+}
+
+/* Ring buffers */
+void test1_ring_push()
+{
+  Int_ring r;
+  int i;
+
+  Int_ring_init(&r, 4, NULL);
+  for (i = 1; i <= 6; i++)
+  {
+    Int_ring_push(&r, i);
+  }
+  PRINT_TEST_RESULT(r.count == 4 && *Int_ring_at(&r, 0) == 3 && *Int_ring_at(&r, 3) == 6 && Int_ring_at(&r, 4) == NULL);
+  Int_ring_free(&r);
+}
+void test1_ring_pop()
+{
+  Int_ring r;
+  int a = 0, b = 0;
+
+  Int_ring_init(&r, 4, NULL);
+  Int_ring_push(&r, 1);
+  Int_ring_push(&r, 2);
+  Int_ring_pop(&r, &a);
+  Int_ring_pop(&r, &b);
+  PRINT_TEST_RESULT(a == 1 && b == 2 && Int_ring_pop(&r, &a) == ERROR);
+  Int_ring_free(&r);
+}
+
+/* Bitsets */
+void test1_bitset()
+{
+  unsigned long bits[BITSET_WORDS(200)];
+
+  BITSET_ZERO(bits, 200);
+  BITSET_SET(bits, 0);
+  BITSET_SET(bits, 63);
+  BITSET_SET(bits, 64);
+  BITSET_SET(bits, 199);
+  BITSET_CLEAR(bits, 63);
+  PRINT_TEST_RESULT(BITSET_TEST(bits, 0) && !BITSET_TEST(bits, 63) && BITSET_TEST(bits, 64) && BITSET_TEST(bits, 199) && !BITSET_TEST(bits, 1));
+}
@@ -0,0 +1,90 @@
+/** 
+ * @brief It declares the tests for the container library
+ * 
+ * @file container_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef CONTAINER_TEST_H
+#define CONTAINER_TEST_H
+
+/**
+ * @test Test function for pushing to a vector
+ * @pre 100 ints pushed
+ * @post they are in order and the vector grew
+ */
+void test1_vector_push();
+/**
+ * @test Test function for inserting in a vector
+ * @pre 1, 3 and 2 inserted between them
+ * @post 1, 2, 3
+ */
+void test1_vector_insert();
+/**
+ * @test Test function for removing from a vector
+ * @pre 1, 2, 3 and the first one removed keeping the order
+ * @post 2, 3
+ */
+void test1_vector_remove();
+/**
+ * @test Test function for removing from a vector
+ * @pre 1, 2, 3 and the first one removed by swapping
+ * @post 3, 2
+ */
+void test1_vector_remove_swap();
+/**
+ * @test Test function for a vector made in an arena
+ * @pre 100 ints pushed
+ * @post they are in order
+ */
+void test1_vector_arena();
+
+/**
+ * @test Test function for storing in a hash map
+ * @pre 1000 keys stored
+ * @post each key gives its value
+ */
+void test1_hmap_put();
+/**
+ * @test Test function for storing in a hash map
+ * @pre the empty key
+ * @post Output == ERROR
+ */
+void test2_hmap_put();
+/**
+ * @test Test function for looking up a hash map
+ * @pre key that was never stored
+ * @post Output == NULL
+ */
+void test1_hmap_get();
+/**
+ * @test Test function for removing from a hash map
+ * @pre colliding keys stored and every other one removed
+ * @post the removed ones are gone and the rest are found
+ */
+void test1_hmap_remove();
+
+/**
+ * @test Test function for pushing to a ring buffer
+ * @pre 6 ints pushed in a ring for 4
+ * @post the last 4 are kept, oldest first
+ */
+void test1_ring_push();
+/**
+ * @test Test function for taking out of a ring buffer
+ * @pre 1 and 2 pushed
+ * @post 1 comes out first, then 2, then ERROR
+ */
+void test1_ring_pop();
+
+/**
+ * @test Test function for the bitset macros
+ * @pre bits 0, 63, 64 and 199 set and 63 cleared
+ * @post only 0, 64 and 199 are set
+ */
+void test1_bitset();
+
+#endif
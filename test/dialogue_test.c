@@ -15,7 +15,7 @@
 #include "dialogue_test.h"
 #include "test.h"
 
-#define MAX_TESTS 14  /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 20  /*!< It defines the maximun tests in this file */
 
 int main(int argc, char **argv)
 {
@@ -85,6 +85,11 @@ int main(int argc, char **argv)
   if (all || test == i) test2_dialogue_set_error();
   i++;
 
+  if (all || test == i) test1_dialogue_print();
+  i++;
+  if (all || test == i) test2_dialogue_print();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -256,3 +261,29 @@ void test2_dialogue_set_error()
 	int condition = 4;
 	PRINT_TEST_RESULT(dialogue_set_error(d, condition, NULL, NULL, NULL)==ERROR);
 }
+
+/*dialogue_print*/
+void test1_dialogue_print()
+{
+  Dialogue *d = NULL;
+  FILE *f = NULL;
+  char line[256] = "";
+  d = dialogue_create();
+  f = tmpfile();
+  dialogue_set_error(d, 4, NULL, NULL, NULL);
+  if (f)
+  {
+    dialogue_print(d, f);
+    rewind(f);
+    fgets(line, sizeof(line), f);
+    fclose(f);
+  }
+  PRINT_TEST_RESULT(strncmp(line, dialogue_get_error(d), strlen(dialogue_get_error(d))) == 0 && line[0] != '\0');
+  dialogue_destroy(d);
+}
+
+void test2_dialogue_print()
+{
+  Dialogue *d = NULL;
+  PRINT_TEST_RESULT(dialogue_print(d, stdout) == ERROR);
+}
@@ -137,4 +137,18 @@ void test1_dialogue_set_error();
  */
 void test2_dialogue_set_error();
 
+/**
+ * @test Test dialogue print
+ * @pre pointer to dialogue with an error set
+ * @post the error is the first line written
+ */
+void test1_dialogue_print();
+
+/**
+ * @test Test dialogue print
+ * @pre pointer to dialogue = NULL
+ * @post output == ERROR
+ */
+void test2_dialogue_print();
+
 #endif
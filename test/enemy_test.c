@@ -15,7 +15,7 @@
 #include "enemy_test.h"
 #include "test.h"
 
-#define MAX_TESTS 41  /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 43  /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for enemy unit tests.
@@ -126,6 +126,11 @@ int main(int argc, char **argv)
   if (all || test == i) test2_enemy_set_baseDmg();
   i++;
 
+  if (all || test == i) test1_enemy_copy();
+  i++;
+  if (all || test == i) test2_enemy_copy();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -367,4 +372,26 @@ void   test2_enemy_set_baseDmg()
 {
 	Enemy *s = NULL;
 	PRINT_TEST_RESULT(enemy_set_baseDmg(s, -1)==ERROR);
-}
\ No newline at end of file
+}
+
+/*enemy_copy */
+void test1_enemy_copy()
+{
+  Enemy *model = NULL, *e = NULL;
+  model = enemy_create(46);
+  e = enemy_create(4);
+  enemy_set_name(model, "Rat");
+  enemy_set_health(model, 2);
+  enemy_copy(e, model, 48);
+  PRINT_TEST_RESULT(enemy_get_id(e) == 48 && enemy_get_health(e) == 2 && strcmp(enemy_get_name(e), "Rat") == 0);
+  enemy_destroy(model);
+  enemy_destroy(e);
+}
+
+void test2_enemy_copy()
+{
+  Enemy *e = NULL;
+  e = enemy_create(4);
+  PRINT_TEST_RESULT(enemy_copy(e, NULL, 48) == ERROR);
+  enemy_destroy(e);
+}
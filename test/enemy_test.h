@@ -231,4 +231,18 @@ void test1_enemy_set_baseDmg();
  */
 void test2_enemy_set_baseDmg();
 
+/**
+ * @test Test copying an enemy
+ * @pre model with name and health
+ * @post the copy has them and its own id
+ */
+void test1_enemy_copy();
+
+/**
+ * @test Test copying an enemy
+ * @pre pointer to the model = NULL
+ * @post Output==ERROR
+ */
+void test2_enemy_copy();
+
 #endif
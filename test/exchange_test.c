@@ -0,0 +1,125 @@
+/**
+ * @brief It tests exchange module
+ *
+ * @file exchange_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/exchange.h"
+#include "exchange_test.h"
+#include "test.h"
+
+#define MAX_TESTS 6 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for exchange unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module exchange:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_exchange_create();
+  i++;
+  if (all || test == i) test1_exchange_take();
+  i++;
+  if (all || test == i) test2_exchange_take();
+  i++;
+  if (all || test == i) test1_exchange_publish();
+  i++;
+  if (all || test == i) test2_exchange_publish();
+  i++;
+  if (all || test == i) test3_exchange_publish();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* exchange_create */
+void test1_exchange_create()
+{
+  Exchange *ex = NULL;
+  ex = exchange_create();
+  PRINT_TEST_RESULT(ex != NULL && exchange_get_published(ex) == 0 && exchange_get_dropped(ex) == 0);
+  exchange_destroy(ex);
+}
+
+/* exchange_take */
+void test1_exchange_take()
+{
+  Exchange *ex = NULL;
+  ex = exchange_create();
+  PRINT_TEST_RESULT(exchange_take(ex, EXCHANGE_READER) == -1);
+  exchange_destroy(ex);
+}
+void test2_exchange_take()
+{
+  Exchange *ex = NULL;
+  int first, second;
+  ex = exchange_create();
+  exchange_publish(ex, EXCHANGE_WRITER);
+  first = exchange_take(ex, EXCHANGE_READER);
+  second = exchange_take(ex, first);
+  PRINT_TEST_RESULT(first == EXCHANGE_WRITER && second == -1);
+  exchange_destroy(ex);
+}
+
+/* exchange_publish */
+void test1_exchange_publish()
+{
+  Exchange *ex = NULL;
+  int back;
+  ex = exchange_create();
+  back = exchange_publish(ex, EXCHANGE_WRITER);
+  PRINT_TEST_RESULT(back >= 0 && back < EXCHANGE_BUFFERS && back != EXCHANGE_WRITER && back != EXCHANGE_READER && exchange_get_published(ex) == 1);
+  exchange_destroy(ex);
+}
+void test2_exchange_publish()
+{
+  Exchange *ex = NULL;
+  int back, second;
+  ex = exchange_create();
+  back = exchange_publish(ex, EXCHANGE_WRITER);
+  second = back;
+  back = exchange_publish(ex, back);
+  PRINT_TEST_RESULT(back == EXCHANGE_WRITER && exchange_take(ex, EXCHANGE_READER) == second && exchange_get_dropped(ex) == 1);
+  exchange_destroy(ex);
+}
+void test3_exchange_publish()
+{
+  Exchange *ex = NULL;
+  ex = exchange_create();
+  PRINT_TEST_RESULT(exchange_publish(ex, EXCHANGE_BUFFERS) == -1);
+  exchange_destroy(ex);
+}
@@ -0,0 +1,51 @@
+/** 
+ * @brief It declares the tests for the exchange module
+ * 
+ * @file exchange_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef EXCHANGE_TEST_H
+#define EXCHANGE_TEST_H
+
+/**
+ * @test Test function for creating an exchange
+ * @pre nothing
+ * @post nothing published or dropped
+ */
+void test1_exchange_create();
+/**
+ * @test Test function for taking a buffer
+ * @pre nothing published
+ * @post Output == -1
+ */
+void test1_exchange_take();
+/**
+ * @test Test function for taking a buffer
+ * @pre a buffer published
+ * @post the reader gets that buffer, and nothing the second time
+ */
+void test2_exchange_take();
+/**
+ * @test Test function for publishing a buffer
+ * @pre nothing published
+ * @post the writer gets a buffer that is neither its old one nor the reader's
+ */
+void test1_exchange_publish();
+/**
+ * @test Test function for publishing a buffer
+ * @pre two buffers published before a take
+ * @post the first one is dropped and the reader gets the second one
+ */
+void test2_exchange_publish();
+/**
+ * @test Test function for publishing a buffer
+ * @pre buffer out of range
+ * @post Output == -1
+ */
+void test3_exchange_publish();
+
+#endif
@@ -0,0 +1,177 @@
+/**
+ * @brief It tests frame module
+ *
+ * @file frame_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/frame.h"
+#include "frame_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Counts the times a text appears in an output
+ *
+ * @param out output of frame_render
+ * @param len bytes of the output
+ * @param text text to look for
+ * @return number of times text appears
+ */
+int count_text(const char *out, size_t len, const char *text)
+{
+  size_t i, n = strlen(text);
+  int count = 0;
+
+  for (i = 0; i + n <= len; i++)
+  {
+    if (memcmp(out + i, text, n) == 0)
+    {
+      count++;
+    }
+  }
+
+  return count;
+}
+
+/**
+ * @brief Main function for frame unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module frame:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_frame_create();
+  i++;
+  if (all || test == i) test2_frame_create();
+  i++;
+  if (all || test == i) test1_frame_load();
+  i++;
+  if (all || test == i) test1_frame_render();
+  i++;
+  if (all || test == i) test2_frame_render();
+  i++;
+  if (all || test == i) test3_frame_render();
+  i++;
+  if (all || test == i) test4_frame_render();
+  i++;
+  if (all || test == i) test1_frame_invalidate();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* frame_create */
+void test1_frame_create()
+{
+  Frame *f = NULL;
+  f = frame_create(4, 10);
+  PRINT_TEST_RESULT(f != NULL && frame_get_cells(f)[0] == FRAME_BG_CHAR && frame_get_cells(f)[39] == FRAME_BG_CHAR);
+  frame_destroy(f);
+}
+void test2_frame_create()
+{
+  PRINT_TEST_RESULT(frame_create(0, 10) == NULL);
+}
+
+/* frame_load */
+void test1_frame_load()
+{
+  PRINT_TEST_RESULT(frame_load(NULL, "~~~~") == ERROR);
+}
+
+/* frame_render */
+void test1_frame_render()
+{
+  Frame *f = NULL;
+  const char *out = NULL;
+  size_t len = 0;
+  f = frame_create(4, 10);
+  out = frame_render(f, &len);
+  PRINT_TEST_RESULT(out != NULL && count_text(out, len, "\033[2J") == 1 && count_text(out, len, "~") == 40);
+  frame_destroy(f);
+}
+void test2_frame_render()
+{
+  Frame *f = NULL;
+  const char *out = NULL;
+  size_t len = 0;
+  f = frame_create(4, 10);
+  frame_render(f, &len);
+  out = frame_render(f, &len);
+  PRINT_TEST_RESULT(out != NULL && count_text(out, len, "~") == 0 && count_text(out, len, "\033[5;1H") == 1 && len == frame_get_last_bytes(f));
+  frame_destroy(f);
+}
+void test3_frame_render()
+{
+  Frame *f = NULL;
+  const char *out = NULL;
+  size_t len = 0;
+  f = frame_create(4, 10);
+  frame_render(f, &len);
+  frame_get_cells(f)[2 * 10 + 5] = 'X';
+  out = frame_render(f, &len);
+  PRINT_TEST_RESULT(out != NULL && count_text(out, len, "\033[3;6H") == 1 && count_text(out, len, "X") == 1 && count_text(out, len, "H") == 2);
+  frame_destroy(f);
+}
+void test4_frame_render()
+{
+  Frame *f = NULL;
+  const char *out = NULL;
+  size_t len = 0;
+  f = frame_create(4, 10);
+  frame_render(f, &len);
+  frame_get_cells(f)[10 + 1] = 'A';
+  frame_get_cells(f)[10 + 5] = 'B';
+  out = frame_render(f, &len);
+  PRINT_TEST_RESULT(out != NULL && count_text(out, len, "\033[2;2H") == 1 && count_text(out, len, "A") == 1 && count_text(out, len, "B") == 1 && count_text(out, len, "~") == 3 && count_text(out, len, "H") == 2);
+  frame_destroy(f);
+}
+
+/* frame_invalidate */
+void test1_frame_invalidate()
+{
+  Frame *f = NULL;
+  const char *out = NULL;
+  size_t len = 0;
+  f = frame_create(4, 10);
+  frame_render(f, &len);
+  frame_invalidate(f);
+  out = frame_render(f, &len);
+  PRINT_TEST_RESULT(out != NULL && count_text(out, len, "\033[2J") == 1 && count_text(out, len, "~") == 40);
+  frame_destroy(f);
+}
@@ -0,0 +1,63 @@
+/** 
+ * @brief It declares the tests for the frame module
+ * 
+ * @file frame_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef FRAME_TEST_H
+#define FRAME_TEST_H
+
+/**
+ * @test Test function for creating a frame
+ * @pre rows = 4, columns = 10
+ * @post a frame full of background cells
+ */
+void test1_frame_create();
+/**
+ * @test Test function for creating a frame
+ * @pre rows = 0
+ * @post Output == NULL
+ */
+void test2_frame_create();
+/**
+ * @test Test function for loading a screen
+ * @pre frame = NULL
+ * @post Output == ERROR
+ */
+void test1_frame_load();
+/**
+ * @test Test function for rendering the first frame
+ * @pre a new frame
+ * @post the terminal is cleared and every cell is sent
+ */
+void test1_frame_render();
+/**
+ * @test Test function for rendering a frame without changes
+ * @pre the same screen rendered twice
+ * @post only the move to the prompt line is sent
+ */
+void test2_frame_render();
+/**
+ * @test Test function for rendering one changed cell
+ * @pre a cell of the third row changed
+ * @post a cursor move to that cell and the cell
+ */
+void test3_frame_render();
+/**
+ * @test Test function for rendering changes close to each other
+ * @pre two cells of a row changed, 3 cells apart
+ * @post both are sent with a single cursor move
+ */
+void test4_frame_render();
+/**
+ * @test Test function for rendering after invalidating
+ * @pre a frame already rendered, then invalidated
+ * @post the terminal is cleared again
+ */
+void test1_frame_invalidate();
+
+#endif
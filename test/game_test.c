@@ -15,7 +15,7 @@
 #include "game_test.h"
 #include "test.h"
 
-#define MAX_TESTS 46 /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 55 /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for inventory unit tests.
@@ -165,6 +165,25 @@ int main(int argc, char **argv)
   if (all || test == i) test2_game_get_enemyWithPlayer();
   i++;
 
+  if (all || test == i) test1_game_spawn_enemy();
+  i++;
+  if (all || test == i) test2_game_spawn_enemy();
+  i++;
+  if (all || test == i) test1_game_despawn_enemy();
+  i++;
+  if (all || test == i) test1_game_get_enemy_in_space_at();
+  i++;
+  if (all || test == i) test1_game_count_enemies_in_space();
+  i++;
+  if (all || test == i) test1_game_update_enemy();
+  i++;
+  if (all || test == i) test1_game_is_boss_dead();
+  i++;
+  if (all || test == i) test2_game_is_boss_dead();
+  i++;
+  if (all || test == i) test3_game_is_boss_dead();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -637,3 +656,145 @@ void test2_game_get_enemyWithPlayer(){
 	Game *g = NULL;
 	PRINT_TEST_RESULT(game_get_enemyWithPlayer(g, 20) == NULL);
 }
+
+/*game_spawn_enemy*/
+void test1_game_spawn_enemy(){
+	Game *g = NULL;
+	Enemy *model, *e;
+	g = game_alloc2();
+	game_create(g);
+
+	model = enemy_create(46);
+	enemy_set_location(model, -2);
+	game_add_enemy(g, model);
+
+	e = game_spawn_enemy(g, model, 48, 12);
+	PRINT_TEST_RESULT(e != NULL && game_get_enemy(g, 48) == e && enemy_get_location(e) == 12);
+	game_destroy(g);
+}
+
+void test2_game_spawn_enemy(){
+	Game *g = NULL;
+	Enemy *model;
+	g = game_alloc2();
+	game_create(g);
+
+	model = enemy_create(46);
+	game_add_enemy(g, model);
+
+	/* The id is in use */
+	PRINT_TEST_RESULT(game_spawn_enemy(g, model, 46, 12) == NULL);
+	game_destroy(g);
+}
+
+/*game_despawn_enemy*/
+void test1_game_despawn_enemy(){
+	Game *g = NULL;
+	Enemy *model, *e;
+	g = game_alloc2();
+	game_create(g);
+
+	model = enemy_create(46);
+	game_add_enemy(g, model);
+	e = game_spawn_enemy(g, model, 48, 12);
+	game_despawn_enemy(g, 48);
+
+	/* The record is used again by the next spawn */
+	PRINT_TEST_RESULT(game_get_enemy(g, 48) == NULL && game_spawn_enemy(g, model, 49, 12) == e);
+	game_destroy(g);
+}
+
+/*game_get_enemy_in_space_at*/
+void test1_game_get_enemy_in_space_at(){
+	Game *g = NULL;
+	Enemy *e1, *e2, *e3;
+	g = game_alloc2();
+	game_create(g);
+
+	e1 = enemy_create(41);
+	e2 = enemy_create(42);
+	e3 = enemy_create(43);
+	enemy_set_location(e1, 12);
+	enemy_set_location(e2, 12);
+	enemy_set_location(e3, 12);
+	game_add_enemy(g, e1);
+	game_add_enemy(g, e2);
+	game_add_enemy(g, e3);
+	game_despawn_enemy(g, 41);
+
+	/* The despawned one took the slot of the last one, the room keeps the order */
+	PRINT_TEST_RESULT(game_get_enemy_in_space_at(g, 12, 0) == e2 && game_get_enemy_in_space_at(g, 12, 1) == e3 && game_get_enemy_in_space_at(g, 12, 2) == NULL);
+	game_destroy(g);
+}
+
+/*game_count_enemies_in_space*/
+void test1_game_count_enemies_in_space(){
+	Game *g = NULL;
+	Enemy *e1, *e2;
+	g = game_alloc2();
+	game_create(g);
+
+	e1 = enemy_create(41);
+	e2 = enemy_create(42);
+	enemy_set_location(e1, 12);
+	enemy_set_location(e2, 12);
+	game_add_enemy(g, e1);
+	game_add_enemy(g, e2);
+	game_set_enemy_location(g, 42, 13);
+
+	PRINT_TEST_RESULT(game_count_enemies_in_space(g, 12) == 1 && game_count_enemies_in_space(g, 13) == 1 && game_get_enemy_in_space(g, 13) == e2 && game_count_enemies_in_space(NULL, 12) == 0);
+	game_destroy(g);
+}
+
+/*game_update_enemy*/
+void test1_game_update_enemy(){
+	Game *g = NULL;
+	Enemy *e1, *e2;
+	g = game_alloc2();
+	game_create(g);
+
+	e1 = enemy_create(41);
+	e2 = enemy_create(42);
+	game_add_enemy(g, e1);
+	game_add_enemy(g, e2);
+	enemy_set_health(e1, 0);
+	game_update_enemy(g);
+
+	PRINT_TEST_RESULT(game_get_enemy(g, 41) == NULL && game_get_enemy(g, 42) == e2 && game_get_enemy_id(g, 0) == 42);
+	game_destroy(g);
+}
+
+/*game_is_boss_dead*/
+void test1_game_is_boss_dead(){
+	Game *g = NULL;
+	Enemy *boss;
+	g = game_alloc2();
+	game_create(g);
+
+	boss = enemy_create(GAME_BOSS);
+	enemy_set_health(boss, 5);
+	game_add_enemy(g, boss);
+
+	PRINT_TEST_RESULT(game_is_boss_dead(g) == FALSE);
+	game_destroy(g);
+}
+
+void test2_game_is_boss_dead(){
+	Game *g = NULL;
+	Enemy *boss;
+	g = game_alloc2();
+	game_create(g);
+
+	boss = enemy_create(GAME_BOSS);
+	enemy_set_health(boss, 0);
+	game_add_enemy(g, boss);
+	game_update_enemy(g);
+
+	/* Once dead it is despawned, it is still dead */
+	PRINT_TEST_RESULT(game_get_enemy(g, GAME_BOSS) == NULL && game_is_boss_dead(g) == TRUE);
+	game_destroy(g);
+}
+
+void test3_game_is_boss_dead(){
+	PRINT_TEST_RESULT(game_is_boss_dead(NULL) == FALSE);
+}
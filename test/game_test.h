@@ -340,4 +340,67 @@ void test1_game_get_enemyWithPlayer();
  */
 void test2_game_get_enemyWithPlayer();
 
+/**
+ * @test Test spawning an enemy
+ * @pre memory-allocated game with a model enemy
+ * @post the new enemy is found by its id in its space
+ */
+void test1_game_spawn_enemy();
+
+/**
+ * @test Test spawning an enemy
+ * @pre id of the new enemy already in use
+ * @post return NULL
+ */
+void test2_game_spawn_enemy();
+
+/**
+ * @test Test despawning an enemy
+ * @pre spawned enemy despawned
+ * @post its id is not found and the next spawn uses its record
+ */
+void test1_game_despawn_enemy();
+
+/**
+ * @test Test the enemies of a space by their order of arrival
+ * @pre three enemies in a space, the first one despawned
+ * @post the other two keep their order
+ */
+void test1_game_get_enemy_in_space_at();
+
+/**
+ * @test Test counting the enemies of a space
+ * @pre two enemies in a space, one of them moved to another one
+ * @post one enemy in each space, 0 with no game
+ */
+void test1_game_count_enemies_in_space();
+
+/**
+ * @test Test the update of dead enemies
+ * @pre two enemies, the first one with 0 health
+ * @post the dead one is despawned and the other one takes its slot
+ */
+void test1_game_update_enemy();
+
+/**
+ * @test Test if the boss is dead
+ * @pre the boss alive in the game
+ * @post Output==FALSE
+ */
+void test1_game_is_boss_dead();
+
+/**
+ * @test Test if the boss is dead
+ * @pre the boss killed and despawned
+ * @post Output==TRUE
+ */
+void test2_game_is_boss_dead();
+
+/**
+ * @test Test if the boss is dead
+ * @pre pointer to game = NULL
+ * @post Output==FALSE
+ */
+void test3_game_is_boss_dead();
+
 #endif
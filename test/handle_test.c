@@ -0,0 +1,159 @@
+/**
+ * @brief It tests handle module
+ *
+ * @file handle_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/handle.h"
+#include "handle_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for handle unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module handle:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_handle_make();
+  i++;
+  if (all || test == i) test1_handle_table_add();
+  i++;
+  if (all || test == i) test2_handle_table_add();
+  i++;
+  if (all || test == i) test3_handle_table_add();
+  i++;
+  if (all || test == i) test1_handle_table_find();
+  i++;
+  if (all || test == i) test2_handle_table_find();
+  i++;
+  if (all || test == i) test1_handle_table_release();
+  i++;
+  if (all || test == i) test2_handle_table_release();
+  i++;
+  if (all || test == i) test1_handle_table_reset();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* HANDLE_MAKE */
+void test1_handle_make()
+{
+  Handle h = HANDLE_MAKE(HANDLE_ENEMY, 7, 3);
+  PRINT_TEST_RESULT(HANDLE_KIND(h) == HANDLE_ENEMY && HANDLE_GEN(h) == 7 && HANDLE_INDEX(h) == 3);
+}
+
+/* handle_table_add */
+void test1_handle_table_add()
+{
+  Handle_table *t = handle_table_create();
+  Handle h = handle_table_add(t, 121, HANDLE_SPACE, 4);
+  PRINT_TEST_RESULT(HANDLE_KIND(h) == HANDLE_SPACE && HANDLE_INDEX(h) == 4);
+  handle_table_destroy(t);
+}
+void test2_handle_table_add()
+{
+  Handle_table *t = handle_table_create();
+  PRINT_TEST_RESULT(handle_table_add(t, 121, HANDLE_NONE, 4) == NO_HANDLE);
+  handle_table_destroy(t);
+}
+void test3_handle_table_add()
+{
+  PRINT_TEST_RESULT(handle_table_add(NULL, 121, HANDLE_SPACE, 4) == NO_HANDLE);
+}
+
+/* handle_table_find */
+void test1_handle_table_find()
+{
+  Handle_table *t = handle_table_create();
+  int i, ok = 1;
+
+  /* More ids than the first hash table holds */
+  for (i = 0; i < 200; i++)
+  {
+    handle_table_add(t, 100 + i, HANDLE_SPACE, i);
+    handle_table_add(t, 300 + i, HANDLE_OBJECT, i);
+  }
+  for (i = 0; i < 200; i++)
+  {
+    if (handle_table_find(t, 100 + i) != HANDLE_MAKE(HANDLE_SPACE, 0, i) ||
+        handle_table_find(t, 300 + i) != HANDLE_MAKE(HANDLE_OBJECT, 0, i))
+    {
+      ok = 0;
+    }
+  }
+  PRINT_TEST_RESULT(ok);
+  handle_table_destroy(t);
+}
+void test2_handle_table_find()
+{
+  Handle_table *t = handle_table_create();
+  handle_table_add(t, 121, HANDLE_SPACE, 0);
+  PRINT_TEST_RESULT(handle_table_find(t, 122) == NO_HANDLE);
+  handle_table_destroy(t);
+}
+
+/* handle_table_release */
+void test1_handle_table_release()
+{
+  Handle_table *t = handle_table_create();
+  Handle h = handle_table_add(t, 41, HANDLE_ENEMY, 0);
+  handle_table_release(t, h);
+  PRINT_TEST_RESULT(handle_table_is_valid(t, h) == FALSE && handle_table_find(t, 41) == NO_HANDLE);
+  handle_table_destroy(t);
+}
+void test2_handle_table_release()
+{
+  Handle_table *t = handle_table_create();
+  Handle old = handle_table_add(t, 41, HANDLE_ENEMY, 0), h;
+  handle_table_release(t, old);
+  h = handle_table_add(t, 42, HANDLE_ENEMY, 0);
+  PRINT_TEST_RESULT(h != old && HANDLE_INDEX(h) == HANDLE_INDEX(old) && handle_table_is_valid(t, h) == TRUE);
+  handle_table_destroy(t);
+}
+
+/* handle_table_reset */
+void test1_handle_table_reset()
+{
+  Handle_table *t = handle_table_create();
+  Handle h = handle_table_add(t, 21, HANDLE_PLAYER, 0);
+  handle_table_reset(t);
+  PRINT_TEST_RESULT(handle_table_is_valid(t, h) == FALSE && handle_table_find(t, 21) == NO_HANDLE);
+  handle_table_destroy(t);
+}
@@ -0,0 +1,73 @@
+/** 
+ * @brief It declares the tests for the handle module
+ * 
+ * @file handle_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef HANDLE_TEST_H
+#define HANDLE_TEST_H
+
+/**
+ * @test Test function for building a handle
+ * @pre kind HANDLE_ENEMY, generation 7, index 3
+ * @post the same kind, generation and index are read back
+ */
+void test1_handle_make();
+
+/**
+ * @test Test function for adding an id
+ * @pre id 121 added as the space of index 4
+ * @post the handle is a space with index 4
+ */
+void test1_handle_table_add();
+/**
+ * @test Test function for adding an id
+ * @pre kind HANDLE_NONE
+ * @post Output == NO_HANDLE
+ */
+void test2_handle_table_add();
+/**
+ * @test Test function for adding an id
+ * @pre pointer to table = NULL
+ * @post Output == NO_HANDLE
+ */
+void test3_handle_table_add();
+
+/**
+ * @test Test function for translating an id
+ * @pre many ids added
+ * @post each id gives back its own handle
+ */
+void test1_handle_table_find();
+/**
+ * @test Test function for translating an id
+ * @pre id that was never added
+ * @post Output == NO_HANDLE
+ */
+void test2_handle_table_find();
+
+/**
+ * @test Test function for releasing a handle
+ * @pre handle released
+ * @post the handle is stale and its id gives NO_HANDLE
+ */
+void test1_handle_table_release();
+/**
+ * @test Test function for releasing a handle
+ * @pre slot released and given to another id
+ * @post the new handle is different from the old one
+ */
+void test2_handle_table_release();
+
+/**
+ * @test Test function for resetting the table
+ * @pre table with ids
+ * @post every handle is stale and no id is found
+ */
+void test1_handle_table_reset();
+
+#endif
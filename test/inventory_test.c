@@ -15,7 +15,7 @@
 #include "inventory_test.h"
 #include "test.h"
 
-#define MAX_TESTS 23 /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 34 /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for inventory unit tests.
@@ -105,6 +105,31 @@ int main(int argc, char **argv)
 	if (all || test == i) test3_inventory_has_id();
   i++;
 
+  if (all || test == i) test1_inventory_count_type();
+  i++;
+  if (all || test == i) test2_inventory_count_type();
+  i++;
+
+  if (all || test == i) test1_inventory_get_type_object();
+  i++;
+
+  if (all || test == i) test1_inventory_get_weapon();
+  i++;
+  if (all || test == i) test2_inventory_get_weapon();
+  i++;
+  if (all || test == i) test3_inventory_get_weapon();
+  i++;
+
+  if (all || test == i) test1_inventory_get_crit_bonus();
+  i++;
+  if (all || test == i) test2_inventory_get_crit_bonus();
+  i++;
+
+  if (all || test == i) test1_inventory_wear_weapon();
+  i++;
+  if (all || test == i) test2_inventory_wear_weapon();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -238,24 +263,33 @@ void   test3_inventory_get_maxObjs()
 void test1_inventory_add_object()
 {
   Inventory *s = NULL;
+  Object *o = NULL;
   s = inventory_create(4);
+  o = obj_create(9);
   inventory_set_maxObjs(s, 5);
-  PRINT_TEST_RESULT(inventory_add_object(s, 9) == OK);
+  PRINT_TEST_RESULT(inventory_add_object(s, o) == OK);
   inventory_destroy(s);
+  obj_destroy(o);
 }
 
 void test2_inventory_add_object()
 {
   Inventory *s = NULL;
+  Object *o = NULL;
   s = inventory_create(4);
-  PRINT_TEST_RESULT(inventory_add_object(s, 9) == ERROR);
+  o = obj_create(9);
+  PRINT_TEST_RESULT(inventory_add_object(s, o) == ERROR);
   inventory_destroy(s);
+  obj_destroy(o);
 }
 
 void test3_inventory_add_object()
 {
   Inventory *s = NULL;
-  PRINT_TEST_RESULT(inventory_add_object(s, 9) == ERROR);
+  Object *o = NULL;
+  o = obj_create(9);
+  PRINT_TEST_RESULT(inventory_add_object(s, o) == ERROR);
+  obj_destroy(o);
 }
 
 /* inventory_remove_object */
@@ -263,11 +297,14 @@ void test1_inventory_remove_object()
 {
   Inventory *s = NULL;
   Id id = 9;
+  Object *o = NULL;
   s = inventory_create();
+  o = obj_create(id);
   inventory_set_maxObjs(s, 5);
-  inventory_add_object(s, id);
+  inventory_add_object(s, o);
   PRINT_TEST_RESULT(inventory_remove_object(s, id) == OK);
   inventory_destroy(s);
+  obj_destroy(o);
 }
 
 void test2_inventory_remove_object()
@@ -288,20 +325,26 @@ void test3_inventory_remove_object()
 void test1_inventory_has_id()
 {
   Inventory *s = NULL;
+  Object *o = NULL;
   s = inventory_create(4);
+  o = obj_create(9);
   inventory_set_maxObjs(s, 5);
-  inventory_add_object(s, 9);
+  inventory_add_object(s, o);
   PRINT_TEST_RESULT(inventory_has_id(s, 9) == TRUE);
   inventory_destroy(s);
+  obj_destroy(o);
 }
 
 void test2_inventory_has_id()
 {
   Inventory *s = NULL;
+  Object *o = NULL;
   s = inventory_create(4);
-  inventory_add_object(s, 9);
+  o = obj_create(9);
+  inventory_add_object(s, o);
   PRINT_TEST_RESULT(inventory_has_id(s, 8) == FALSE);
   inventory_destroy(s);
+  obj_destroy(o);
 }
 
 void test3_inventory_has_id()
@@ -309,3 +352,172 @@ void test3_inventory_has_id()
   Inventory *s = NULL;
   PRINT_TEST_RESULT(inventory_has_id(s, 9) == FALSE);
 }
+
+/* inventory_count_type */
+void test1_inventory_count_type()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL, *o3 = NULL;
+  s = inventory_create();
+  o1 = obj_create(301);
+  obj_set_type(o1, APPLE);
+  o2 = obj_create(392);
+  obj_set_type(o2, SWORD);
+  o3 = obj_create(302);
+  obj_set_type(o3, APPLE);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  inventory_add_object(s, o3);
+  PRINT_TEST_RESULT(inventory_count_type(s, APPLE) == 2 && inventory_count_type(s, SWORD) == 1 && inventory_count_type(s, BED) == 0);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+  obj_destroy(o3);
+}
+
+void test2_inventory_count_type()
+{
+  Inventory *s = NULL;
+  PRINT_TEST_RESULT(inventory_count_type(s, APPLE) == -1);
+}
+
+/* inventory_get_type_object */
+void test1_inventory_get_type_object()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL, *o3 = NULL;
+  s = inventory_create();
+  o1 = obj_create(301);
+  obj_set_type(o1, APPLE);
+  o2 = obj_create(392);
+  obj_set_type(o2, SWORD);
+  o3 = obj_create(302);
+  obj_set_type(o3, APPLE);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  inventory_add_object(s, o3);
+  inventory_remove_object(s, 301);
+  PRINT_TEST_RESULT(inventory_get_type_object(s, APPLE, 0) == o3 && inventory_get_type_object(s, SWORD, 0) == o2 && inventory_get_type_object(s, APPLE, 1) == NULL);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+  obj_destroy(o3);
+}
+
+/* inventory_get_weapon */
+void test1_inventory_get_weapon()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL;
+  s = inventory_create();
+  o1 = obj_create(393);
+  obj_set_type(o1, SWORD);
+  o2 = obj_create(392);
+  obj_set_type(o2, SWORD);
+  object_set_durability(o2, 3);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  PRINT_TEST_RESULT(inventory_get_weapon(s) == o2 && inventory_get_weapon_durability(s) == 3);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+}
+
+void test2_inventory_get_weapon()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL;
+  s = inventory_create();
+  o1 = obj_create(393);
+  obj_set_type(o1, SWORD);
+  o2 = obj_create(392);
+  obj_set_type(o2, SWORD);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  inventory_remove_object(s, 392);
+  PRINT_TEST_RESULT(inventory_get_weapon(s) == o1);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+}
+
+void test3_inventory_get_weapon()
+{
+  Inventory *s = NULL;
+  Object *o = NULL;
+  s = inventory_create();
+  o = obj_create(301);
+  obj_set_type(o, APPLE);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o);
+  PRINT_TEST_RESULT(inventory_get_weapon(s) == NULL);
+  inventory_destroy(s);
+  obj_destroy(o);
+}
+
+/* inventory_get_crit_bonus */
+void test1_inventory_get_crit_bonus()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL;
+  s = inventory_create();
+  o1 = obj_create(380);
+  o2 = obj_create(381);
+  object_set_crit(o1, 5);
+  object_set_crit(o2, 2);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  PRINT_TEST_RESULT(inventory_get_crit_bonus(s) == 5);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+}
+
+void test2_inventory_get_crit_bonus()
+{
+  Inventory *s = NULL;
+  Object *o1 = NULL, *o2 = NULL;
+  s = inventory_create();
+  o1 = obj_create(380);
+  o2 = obj_create(381);
+  object_set_crit(o1, 5);
+  object_set_crit(o2, 2);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o1);
+  inventory_add_object(s, o2);
+  inventory_remove_object(s, 380);
+  PRINT_TEST_RESULT(inventory_get_crit_bonus(s) == 2);
+  inventory_destroy(s);
+  obj_destroy(o1);
+  obj_destroy(o2);
+}
+
+/* inventory_wear_weapon */
+void test1_inventory_wear_weapon()
+{
+  Inventory *s = NULL;
+  Object *o = NULL;
+  s = inventory_create();
+  o = obj_create(392);
+  obj_set_type(o, SWORD);
+  object_set_durability(o, 3);
+  inventory_set_maxObjs(s, 5);
+  inventory_add_object(s, o);
+  inventory_wear_weapon(s);
+  PRINT_TEST_RESULT(inventory_wear_weapon(s) == 1 && object_get_durability(o) == 1 && inventory_get_weapon_durability(s) == 1);
+  inventory_destroy(s);
+  obj_destroy(o);
+}
+
+void test2_inventory_wear_weapon()
+{
+  Inventory *s = NULL;
+  s = inventory_create();
+  PRINT_TEST_RESULT(inventory_wear_weapon(s) == -1);
+  inventory_destroy(s);
+}
@@ -176,4 +176,74 @@ void test2_inventory_has_id();
  */
 void test3_inventory_has_id();
 
+/**
+ * @test Test inventory
+ * @pre two apples and a sword
+ * @post 2 apples, 1 sword and 0 beds
+ */
+void test1_inventory_count_type();
+
+/**
+ * @test Test inventory
+ * @pre inventory NULL pointer
+ * @post output == -1
+ */
+void test2_inventory_count_type();
+
+/**
+ * @test Test inventory
+ * @pre two apples and a sword, the first apple removed
+ * @post each bucket has its object
+ */
+void test1_inventory_get_type_object();
+
+/**
+ * @test Test inventory
+ * @pre Sword2 and Sword1 added
+ * @post the weapon is Sword1 with its durability
+ */
+void test1_inventory_get_weapon();
+
+/**
+ * @test Test inventory
+ * @pre Sword2 and Sword1 added, Sword1 removed
+ * @post the weapon is Sword2
+ */
+void test2_inventory_get_weapon();
+
+/**
+ * @test Test inventory
+ * @pre only an apple
+ * @post output == NULL
+ */
+void test3_inventory_get_weapon();
+
+/**
+ * @test Test inventory
+ * @pre objects with crit 5 and 2
+ * @post output == 5
+ */
+void test1_inventory_get_crit_bonus();
+
+/**
+ * @test Test inventory
+ * @pre objects with crit 5 and 2, the first one removed
+ * @post output == 2
+ */
+void test2_inventory_get_crit_bonus();
+
+/**
+ * @test Test inventory
+ * @pre sword with durability 3 worn twice
+ * @post output == 1 in the inventory and in the object
+ */
+void test1_inventory_wear_weapon();
+
+/**
+ * @test Test inventory
+ * @pre inventory without weapon
+ * @post output == -1
+ */
+void test2_inventory_wear_weapon();
+
 #endif
@@ -0,0 +1,170 @@
+/**
+ * @brief It tests layout module
+ *
+ * @file layout_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/layout.h"
+#include "layout_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for layout unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module layout:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_layout_cache_create();
+  i++;
+  if (all || test == i) test1_layout_cache_get();
+  i++;
+  if (all || test == i) test2_layout_cache_get();
+  i++;
+  if (all || test == i) test3_layout_cache_get();
+  i++;
+  if (all || test == i) test4_layout_cache_get();
+  i++;
+  if (all || test == i) test5_layout_cache_get();
+  i++;
+  if (all || test == i) test6_layout_cache_get();
+  i++;
+  if (all || test == i) test7_layout_cache_get();
+  i++;
+  if (all || test == i) test8_layout_cache_get();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* layout_cache_create */
+void test1_layout_cache_create()
+{
+  Layout_cache *cache = NULL;
+  cache = layout_cache_create();
+  PRINT_TEST_RESULT(cache != NULL && layout_cache_get_layouts(cache) == 0 && layout_cache_get_hits(cache) == 0);
+  layout_cache_destroy(cache);
+}
+
+/* layout_cache_get */
+void test1_layout_cache_get()
+{
+  PRINT_TEST_RESULT(layout_cache_get(NULL, "text", 2, 10, NULL) == NULL);
+}
+void test2_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  cache = layout_cache_create();
+  PRINT_TEST_RESULT(layout_cache_get(cache, NULL, 2, 10, NULL) == NULL);
+  layout_cache_destroy(cache);
+}
+void test3_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  char *rows = NULL;
+  int n_rows = 0;
+  cache = layout_cache_create();
+  rows = layout_cache_get(cache, "abcdefghij", 2, 5, &n_rows);
+  PRINT_TEST_RESULT(rows != NULL && n_rows == 3 && strcmp(rows, "  abcdefghij   ") == 0);
+  layout_cache_destroy(cache);
+}
+void test4_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  char *rows = NULL;
+  int n_rows = -1;
+  cache = layout_cache_create();
+  rows = layout_cache_get(cache, "", 0, 5, &n_rows);
+  PRINT_TEST_RESULT(rows != NULL && n_rows == 0 && rows[0] == '\0');
+  layout_cache_destroy(cache);
+}
+void test5_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  char *first = NULL, *second = NULL;
+  char text[16];
+  cache = layout_cache_create();
+  strcpy(text, "A long dialogue");
+  first = layout_cache_get(cache, "A long dialogue", 2, 8, NULL);
+  second = layout_cache_get(cache, text, 2, 8, NULL);
+  PRINT_TEST_RESULT(first == second && layout_cache_get_layouts(cache) == 1 && layout_cache_get_hits(cache) == 1);
+  layout_cache_destroy(cache);
+}
+void test6_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  int narrow = 0, wide = 0;
+  cache = layout_cache_create();
+  layout_cache_get(cache, "A long dialogue", 2, 5, &narrow);
+  layout_cache_get(cache, "A long dialogue", 2, 20, &wide);
+  PRINT_TEST_RESULT(narrow == 4 && wide == 1 && layout_cache_get_layouts(cache) == 2 && layout_cache_get_hits(cache) == 0);
+  layout_cache_destroy(cache);
+}
+void test7_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  char text[16];
+  long layouts;
+  int i;
+  cache = layout_cache_create();
+  for (i = 0; i < LAYOUT_ENTRIES; i++)
+  {
+    sprintf(text, "text %d", i);
+    layout_cache_get(cache, text, 2, 10, NULL);
+  }
+  layout_cache_get(cache, "text 0", 2, 10, NULL);
+  layout_cache_get(cache, "one more", 2, 10, NULL);
+  layouts = layout_cache_get_layouts(cache);
+  layout_cache_get(cache, "text 0", 2, 10, NULL);
+  layout_cache_get(cache, "text 1", 2, 10, NULL);
+  PRINT_TEST_RESULT(layouts == LAYOUT_ENTRIES + 1 && layout_cache_get_layouts(cache) == LAYOUT_ENTRIES + 2);
+  layout_cache_destroy(cache);
+}
+void test8_layout_cache_get()
+{
+  Layout_cache *cache = NULL;
+  char text[16], *rows = NULL;
+  cache = layout_cache_create();
+  strcpy(text, "first");
+  layout_cache_get(cache, text, 0, 10, NULL);
+  strcpy(text, "other");
+  rows = layout_cache_get(cache, text, 0, 10, NULL);
+  PRINT_TEST_RESULT(rows != NULL && strcmp(rows, "other     ") == 0 && layout_cache_get_layouts(cache) == 2);
+  layout_cache_destroy(cache);
+}
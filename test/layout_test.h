@@ -0,0 +1,69 @@
+/** 
+ * @brief It declares the tests for the layout module
+ * 
+ * @file layout_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef LAYOUT_TEST_H
+#define LAYOUT_TEST_H
+
+/**
+ * @test Test function for creating a layout cache
+ * @pre nothing
+ * @post nothing laid out yet
+ */
+void test1_layout_cache_create();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre cache = NULL
+ * @post Output == NULL
+ */
+void test1_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre text = NULL
+ * @post Output == NULL
+ */
+void test2_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre a text of 10 characters, indent 2, width 5
+ * @post 3 rows, the last one filled with spaces
+ */
+void test3_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre an empty text without indent
+ * @post no rows
+ */
+void test4_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre the same text twice, from two buffers
+ * @post the second time it is taken from the cache
+ */
+void test5_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre the same text with two widths
+ * @post it is laid out for each width
+ */
+void test6_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre LAYOUT_ENTRIES + 1 texts, the first one got again before the last
+ * @post the first one is still cached, the second one is not
+ */
+void test7_layout_cache_get();
+/**
+ * @test Test function for getting the rows of a text
+ * @pre a buffer laid out, then rewritten with another text
+ * @post the new text is laid out, not the old rows got
+ */
+void test8_layout_cache_get();
+
+#endif
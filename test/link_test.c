@@ -7,7 +7,6 @@
 #include "link_test.h"
 
 #define MAX_TESTS 30  /*!< It defines the maximun tests in this file */
-#define FD_ID_LINK 5 /*!< It defines the a valid link id, first digit must be 5 */
 
 /**
  * @brief Main function for Link unit tests.
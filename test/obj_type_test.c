@@ -0,0 +1,159 @@
+/**
+ * @brief It tests obj_type module
+ *
+ * @file obj_type_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/obj_type.h"
+#include "../include/object.h"
+#include "obj_type_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for obj_type unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module obj_type:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_obj_type_add();
+  i++;
+  if (all || test == i) test2_obj_type_add();
+  i++;
+  if (all || test == i) test3_obj_type_add();
+  i++;
+  if (all || test == i) test4_obj_type_add();
+  i++;
+  if (all || test == i) test1_obj_type_of();
+  i++;
+  if (all || test == i) test2_obj_type_of();
+  i++;
+  if (all || test == i) test3_obj_type_of();
+  i++;
+  if (all || test == i) test1_obj_type_get_param();
+  i++;
+  if (all || test == i) test1_obj_type_object();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* obj_type_add */
+void test1_obj_type_add()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  PRINT_TEST_RESULT(obj_type_add(types, 0, "Apple", 300, 309, 1, 1, -1) == OK && strcmp(obj_type_get_name(types, 0), "Apple") == 0);
+  arena_destroy(arena);
+}
+void test2_obj_type_add()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  PRINT_TEST_RESULT(obj_type_add(types, MAX_OBJ_TYPES, "Apple", 300, 309, 1, 1, -1) == ERROR);
+  arena_destroy(arena);
+}
+void test3_obj_type_add()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  PRINT_TEST_RESULT(obj_type_add(types, 0, "Apple", 309, 300, 1, 1, -1) == ERROR);
+  arena_destroy(arena);
+}
+void test4_obj_type_add()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  obj_type_add(types, 0, "Apple", 300, 309, 1, 1, -1);
+  obj_type_add(types, 0, "Apple", 500, 509, 1, 1, -1);
+  PRINT_TEST_RESULT(obj_type_of(types, 305) == UNKNOWN_TYPE && obj_type_of(types, 505) == 0);
+  arena_destroy(arena);
+}
+
+/* obj_type_of */
+void test1_obj_type_of()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  obj_type_add(types, 0, "Apple", 300, 309, 1, 1, -1);
+  obj_type_add(types, 1, "Elixir", 310, 319, 1, 2, -1);
+  PRINT_TEST_RESULT(obj_type_of(types, 309) == 0 && obj_type_of(types, 310) == 1);
+  arena_destroy(arena);
+}
+void test2_obj_type_of()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  obj_type_add(types, 0, "Apple", 300, 309, 1, 1, -1);
+  PRINT_TEST_RESULT(obj_type_of(types, 42) == UNKNOWN_TYPE);
+  arena_destroy(arena);
+}
+void test3_obj_type_of()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *first = obj_type_create(arena, strpool_create(arena));
+  Obj_types *second = obj_type_create(arena, strpool_create(arena));
+  obj_type_add(first, 0, "Apple", 300, 309, 1, 1, -1);
+  PRINT_TEST_RESULT(obj_type_of(first, 305) == 0 && obj_type_of(second, 305) == UNKNOWN_TYPE);
+  arena_destroy(arena);
+}
+
+/* obj_type_get_param */
+void test1_obj_type_get_param()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  obj_type_add(types, 3, "Hook", 330, 339, 3, 125, 398);
+  PRINT_TEST_RESULT(obj_type_get_param(types, 3, 1) == 125 && obj_type_get_param(types, 3, 2) == 398 && obj_type_get_param(types, 3, 3) == -1);
+  arena_destroy(arena);
+}
+
+/* obj_get_type */
+void test1_obj_type_object()
+{
+  Arena *arena = arena_create(0);
+  Obj_types *types = obj_type_create(arena, strpool_create(arena));
+  Object *o = NULL;
+  o = obj_create(392);
+  obj_type_add(types, SWORD, "Sword", 392, 393, OBJ_TYPE_NO_EFFECT, -1, -1);
+  obj_set_type(o, obj_type_of(types, obj_get_id(o)));
+  PRINT_TEST_RESULT(obj_get_type(o) == SWORD);
+  obj_destroy(o);
+  arena_destroy(arena);
+}
@@ -0,0 +1,72 @@
+/** 
+ * @brief It declares the tests for the obj_type module
+ * 
+ * @file obj_type_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef OBJ_TYPE_TEST_H
+#define OBJ_TYPE_TEST_H
+
+/**
+ * @test Test function for adding a type
+ * @pre type 0, ids 300 to 309
+ * @post Output == OK
+ */
+void test1_obj_type_add();
+/**
+ * @test Test function for adding a type
+ * @pre type = MAX_OBJ_TYPES
+ * @post Output == ERROR
+ */
+void test2_obj_type_add();
+/**
+ * @test Test function for adding a type
+ * @pre last id lower than the first one
+ * @post Output == ERROR
+ */
+void test3_obj_type_add();
+/**
+ * @test Test function for adding a type twice
+ * @pre type 0 added with two different ranges
+ * @post the second range is the one used
+ */
+void test4_obj_type_add();
+
+/**
+ * @test Test function for the type of an object
+ * @pre types 0 (300 to 309) and 1 (310 to 319)
+ * @post 309 is of type 0 and 310 of type 1
+ */
+void test1_obj_type_of();
+/**
+ * @test Test function for the type of an object
+ * @pre id out of every range
+ * @post Output == UNKNOWN_TYPE
+ */
+void test2_obj_type_of();
+/**
+ * @test Test function for the type of an object
+ * @pre two registries, only the first one with type 0
+ * @post the second registry does not know the id
+ */
+void test3_obj_type_of();
+
+/**
+ * @test Test function for the parameters of a type
+ * @pre type with parameters 125 and 398
+ * @post both parameters and -1 for a third one
+ */
+void test1_obj_type_get_param();
+
+/**
+ * @test Test function for the type of an object
+ * @pre registry with the sword type, set on the object
+ * @post obj_get_type gives the sword type
+ */
+void test1_obj_type_object();
+
+#endif
@@ -524,12 +524,14 @@ void test1_obj_get_type()
 {
   Object *obj = NULL;
   obj = obj_create(305);
-  PRINT_TEST_RESULT(obj_get_type(305) == APPLE);
+  obj_set_type(obj, APPLE);
+  PRINT_TEST_RESULT(obj_get_type(obj) == APPLE);
   obj_destroy(obj);
 }
 void test2_obj_get_type()
 {
-  PRINT_TEST_RESULT(obj_get_type(1) == UNKNOWN_TYPE);
+  Object *obj = NULL;
+  PRINT_TEST_RESULT(obj_get_type(obj) == UNKNOWN_TYPE);
 }
 
 /* obj_get_crit */
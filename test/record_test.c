@@ -0,0 +1,232 @@
+/**
+ * @brief It tests record module
+ *
+ * @file record_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/record.h"
+#include "record_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9                 /*!< It defines the maximun tests in this file */
+#define TEST_RECORD "record_test.rec" /*!< Record of the tests */
+#define TEST_ROWS 4                 /*!< Rows of the screens tested */
+#define TEST_COLUMNS 10             /*!< Columns of the screens tested */
+#define TEST_CELLS (TEST_ROWS * TEST_COLUMNS) /*!< Cells of the screens tested */
+
+/**
+ * @brief Draws the frame number n of the records tested
+ *
+ * @param cells where it is drawn (TEST_CELLS characters)
+ * @param n the frame
+ */
+void draw_frame(char *cells, long n)
+{
+  memset(cells, RECORD_BG_CHAR, TEST_CELLS);
+  sprintf(cells + (n % TEST_ROWS) * TEST_COLUMNS, "f%ld", n);
+  cells[strlen(cells)] = RECORD_BG_CHAR;
+  cells[(n * 7) % TEST_CELLS] = 'a' + n % 26;
+}
+
+/**
+ * @brief Records frames 0 to n - 1 and closes the record
+ *
+ * @param n frames recorded
+ * @return bytes of the frames
+ */
+long write_record(long n)
+{
+  Record *r = NULL;
+  char cells[TEST_CELLS + 1];
+  long i, bytes;
+
+  r = record_create(TEST_RECORD, TEST_ROWS, TEST_COLUMNS);
+  for (i = 0; i < n; i++)
+  {
+    draw_frame(cells, i);
+    record_frame(r, cells);
+  }
+  bytes = record_get_bytes(r);
+  record_close(r);
+
+  return bytes;
+}
+
+/**
+ * @brief Main function for record unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module record:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_record_create();
+  i++;
+  if (all || test == i) test1_record_open();
+  i++;
+  if (all || test == i) test2_record_open();
+  i++;
+  if (all || test == i) test3_record_open();
+  i++;
+  if (all || test == i) test1_record_frame();
+  i++;
+  if (all || test == i) test2_record_frame();
+  i++;
+  if (all || test == i) test1_record_seek();
+  i++;
+  if (all || test == i) test2_record_seek();
+  i++;
+  if (all || test == i) test3_record_seek();
+  i++;
+
+  remove(TEST_RECORD);
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* record_create */
+void test1_record_create()
+{
+  PRINT_TEST_RESULT(record_create(NULL, TEST_ROWS, TEST_COLUMNS) == NULL);
+}
+
+/* record_open */
+void test1_record_open()
+{
+  PRINT_TEST_RESULT(record_open("record_test.missing") == NULL);
+}
+void test2_record_open()
+{
+  Record *r = NULL;
+  write_record(3);
+  r = record_open(TEST_RECORD);
+  PRINT_TEST_RESULT(r != NULL && record_get_frames(r) == 3 && record_get_rows(r) == TEST_ROWS && record_get_columns(r) == TEST_COLUMNS);
+  record_close(r);
+}
+void test3_record_open()
+{
+  Record *r = NULL;
+  FILE *f = NULL;
+  char *bytes = NULL, cells[TEST_CELLS + 1];
+  long n, size;
+  BOOL same = TRUE;
+  int i;
+
+  /* The header of a 4x10 record takes 8 bytes */
+  size = 8 + write_record(40) - 1;
+  bytes = (char *)malloc(size);
+  f = fopen(TEST_RECORD, "rb");
+  n = (long)fread(bytes, 1, size, f);
+  fclose(f);
+  f = fopen(TEST_RECORD, "wb");
+  fwrite(bytes, 1, n, f);
+  fclose(f);
+  free(bytes);
+
+  r = record_open(TEST_RECORD);
+  for (i = 0; r && i < 39; i++)
+  {
+    draw_frame(cells, i);
+    same = (same && record_seek(r, i) == OK && memcmp(record_get_cells(r), cells, TEST_CELLS) == 0) ? TRUE : FALSE;
+  }
+  PRINT_TEST_RESULT(r != NULL && record_get_frames(r) == 39 && same == TRUE);
+  record_close(r);
+}
+
+/* record_frame */
+void test1_record_frame()
+{
+  Record *r = NULL;
+  char cells[TEST_CELLS + 1];
+  long before;
+  r = record_create(TEST_RECORD, TEST_ROWS, TEST_COLUMNS);
+  draw_frame(cells, 1);
+  record_frame(r, cells);
+  before = record_get_bytes(r);
+  PRINT_TEST_RESULT(record_frame(r, cells) == OK && record_get_bytes(r) == before + 2 && record_get_frames(r) == 2);
+  record_close(r);
+}
+void test2_record_frame()
+{
+  Record *r = NULL;
+  char cells[TEST_CELLS + 1];
+  write_record(3);
+  r = record_open(TEST_RECORD);
+  draw_frame(cells, 1);
+  PRINT_TEST_RESULT(record_frame(r, cells) == ERROR);
+  record_close(r);
+}
+
+/* record_seek */
+void test1_record_seek()
+{
+  Record *r = NULL;
+  char cells[TEST_CELLS + 1];
+  BOOL same = TRUE;
+  long i, n;
+  write_record(100);
+  r = record_open(TEST_RECORD);
+  for (i = 0; i < 100; i++)
+  {
+    n = (i * 37) % 100;
+    draw_frame(cells, n);
+    same = (same && record_seek(r, n) == OK && memcmp(record_get_cells(r), cells, TEST_CELLS) == 0) ? TRUE : FALSE;
+  }
+  PRINT_TEST_RESULT(same == TRUE);
+  record_close(r);
+}
+void test2_record_seek()
+{
+  Record *r = NULL;
+  long d70, d71, d5;
+  write_record(100);
+  r = record_open(TEST_RECORD);
+  record_seek(r, 70);
+  d70 = record_get_decoded(r);
+  record_seek(r, 71);
+  d71 = record_get_decoded(r);
+  record_seek(r, 5);
+  d5 = record_get_decoded(r);
+  PRINT_TEST_RESULT(d70 == 70 % RECORD_KEY_EVERY + 1 && d71 == 1 && d5 == 6);
+  record_close(r);
+}
+void test3_record_seek()
+{
+  Record *r = NULL;
+  write_record(3);
+  r = record_open(TEST_RECORD);
+  PRINT_TEST_RESULT(record_seek(r, 3) == ERROR && record_seek(r, 2) == OK);
+  record_close(r);
+}
@@ -0,0 +1,69 @@
+/** 
+ * @brief It declares the tests for the record module
+ * 
+ * @file record_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef RECORD_TEST_H
+#define RECORD_TEST_H
+
+/**
+ * @test Test function for creating a record
+ * @pre path = NULL
+ * @post Output == NULL
+ */
+void test1_record_create();
+/**
+ * @test Test function for opening a record
+ * @pre a file that does not exist
+ * @post Output == NULL
+ */
+void test1_record_open();
+/**
+ * @test Test function for opening a record
+ * @pre a record of 3 frames, closed
+ * @post its frames and the size of its screen
+ */
+void test2_record_open();
+/**
+ * @test Test function for opening a record that was not closed
+ * @pre a record cut in the middle of its last frame
+ * @post every frame before it can be read
+ */
+void test3_record_open();
+/**
+ * @test Test function for recording a frame
+ * @pre the same frame twice
+ * @post the second one takes 2 bytes
+ */
+void test1_record_frame();
+/**
+ * @test Test function for recording a frame
+ * @pre a record opened to be read
+ * @post Output == ERROR
+ */
+void test2_record_frame();
+/**
+ * @test Test function for seeking frames
+ * @pre a record of 100 frames, read in any order
+ * @post every frame is the one recorded
+ */
+void test1_record_seek();
+/**
+ * @test Test function for the cost of seeking
+ * @pre seeks to frames 70, 71 and 5
+ * @post only the frames from the keyframe before (or from the frame decoded) are decoded
+ */
+void test2_record_seek();
+/**
+ * @test Test function for seeking a frame that is not there
+ * @pre frame = number of frames
+ * @post Output == ERROR
+ */
+void test3_record_seek();
+
+#endif
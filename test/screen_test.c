@@ -0,0 +1,200 @@
+/**
+ * @brief It tests screen module
+ *
+ * @file screen_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include "../include/screen.h"
+#include "screen_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9 /*!< It defines the maximun tests in this file */
+
+extern char *__data; /*!< Cells of the screen */
+
+/**
+ * @brief Paints the screen with the standard output sent to /dev/null
+ */
+void quiet_paint()
+{
+  int fd, saved;
+
+  fflush(stdout);
+  saved = dup(STDOUT_FILENO);
+  fd = open("/dev/null", O_WRONLY);
+  dup2(fd, STDOUT_FILENO);
+  close(fd);
+
+  screen_paint();
+
+  dup2(saved, STDOUT_FILENO);
+  close(saved);
+}
+
+/**
+ * @brief Main function for screen unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module screen:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_screen_init();
+  i++;
+  if (all || test == i) test1_screen_area_init();
+  i++;
+  if (all || test == i) test1_screen_area_puts();
+  i++;
+  if (all || test == i) test2_screen_area_puts();
+  i++;
+  if (all || test == i) test3_screen_area_puts();
+  i++;
+  if (all || test == i) test4_screen_area_puts();
+  i++;
+  if (all || test == i) test1_screen_area_clear();
+  i++;
+  if (all || test == i) test1_screen_paint();
+  i++;
+  if (all || test == i) test2_screen_paint();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* screen_init */
+void test1_screen_init()
+{
+  screen_init(4, 10);
+  PRINT_TEST_RESULT(__data != NULL && __data[0] == SCREEN_BG_CHAR && __data[39] == SCREEN_BG_CHAR && __data[40] == '\0');
+  screen_destroy();
+}
+
+/* screen_area_init */
+void test1_screen_area_init()
+{
+  Area *a = NULL;
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  PRINT_TEST_RESULT(a != NULL && strncmp(__data + 10, "~   ~", 5) == 0 && strncmp(__data + 20, "~   ~", 5) == 0 && __data[31] == SCREEN_BG_CHAR);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+/* screen_area_puts */
+void test1_screen_area_puts()
+{
+  Area *a = NULL;
+  char l1[] = "ab", l2[] = "cdefg";
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  screen_area_puts(a, l1);
+  screen_area_puts(a, l2);
+  PRINT_TEST_RESULT(strncmp(__data + 10, "~ab ~", 5) == 0 && strncmp(__data + 20, "~cde~", 5) == 0);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+void test2_screen_area_puts()
+{
+  Area *a = NULL;
+  char l1[] = "abcdef";
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  screen_area_puts(a, l1);
+  PRINT_TEST_RESULT(strncmp(__data + 10, "~abc~", 5) == 0 && strncmp(__data + 20, "~def~", 5) == 0);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+void test3_screen_area_puts()
+{
+  Area *a = NULL;
+  char l1[] = "aa", l2[] = "bb", l3[] = "cc";
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  screen_area_puts(a, l1);
+  screen_area_puts(a, l2);
+  screen_area_puts(a, l3);
+  PRINT_TEST_RESULT(strncmp(__data + 10, "~bb ~", 5) == 0 && strncmp(__data + 20, "~cc ~", 5) == 0 && __data[31] == SCREEN_BG_CHAR);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+void test4_screen_area_puts()
+{
+  Area *a = NULL;
+  char l1[] = "\xc3\xb1o";
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  screen_area_puts(a, l1);
+  PRINT_TEST_RESULT(strncmp(__data + 10, "~??o~", 5) == 0);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+/* screen_area_clear */
+void test1_screen_area_clear()
+{
+  Area *a = NULL;
+  char l1[] = "ab", l2[] = "c";
+  screen_init(4, 10);
+  a = screen_area_init(1, 1, 3, 2);
+  screen_area_puts(a, l1);
+  screen_area_puts(a, l1);
+  screen_area_clear(a);
+  screen_area_puts(a, l2);
+  PRINT_TEST_RESULT(strncmp(__data + 10, "~c  ~", 5) == 0 && strncmp(__data + 20, "~   ~", 5) == 0);
+  screen_area_destroy(a);
+  screen_destroy();
+}
+
+/* screen_paint */
+void test1_screen_paint()
+{
+  screen_init(4, 10);
+  screen_reset_stats();
+  quiet_paint();
+  /* The clear, 15 bytes for each cell (colour, character, reset) and 4 new lines */
+  PRINT_TEST_RESULT(screen_get_paints() == 1 && screen_get_bytes() == (long)strlen("\033[2J\n") + 40 * 15 + 4 && screen_get_paint_time() >= 0);
+  screen_destroy();
+}
+void test2_screen_paint()
+{
+  screen_init(4, 10);
+  screen_destroy();
+  screen_reset_stats();
+  quiet_paint();
+  PRINT_TEST_RESULT(screen_get_paints() == 0 && screen_get_bytes() == 0);
+}
@@ -0,0 +1,69 @@
+/** 
+ * @brief It declares the tests for the screen module
+ * 
+ * @file screen_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SCREEN_TEST_H
+#define SCREEN_TEST_H
+
+/**
+ * @test Test function for creating a screen
+ * @pre rows = 4, columns = 10
+ * @post every cell is background and the screen ends with '\0'
+ */
+void test1_screen_init();
+/**
+ * @test Test function for creating an area
+ * @pre an area of 3x2 at (1, 1)
+ * @post its cells are blank and the rest is background
+ */
+void test1_screen_area_init();
+/**
+ * @test Test function for writing lines in an area
+ * @pre two lines written
+ * @post each one in a row of the area, cut to its width
+ */
+void test1_screen_area_puts();
+/**
+ * @test Test function for writing a long line in an area
+ * @pre a line twice as long as the area is wide
+ * @post it takes two rows
+ */
+void test2_screen_area_puts();
+/**
+ * @test Test function for writing in a full area
+ * @pre an area of 2 rows with 3 lines written
+ * @post the first line scrolls out
+ */
+void test3_screen_area_puts();
+/**
+ * @test Test function for writing special characters
+ * @pre a line with an accented letter
+ * @post the letter is written as "??"
+ */
+void test4_screen_area_puts();
+/**
+ * @test Test function for clearing an area
+ * @pre an area with a line written, then cleared
+ * @post its cells are blank and the next line goes to its first row
+ */
+void test1_screen_area_clear();
+/**
+ * @test Test function for painting a screen
+ * @pre rows = 4, columns = 10
+ * @post a paint of every cell, counted with its bytes
+ */
+void test1_screen_paint();
+/**
+ * @test Test function for painting without a screen
+ * @pre the screen destroyed
+ * @post nothing is painted nor counted
+ */
+void test2_screen_paint();
+
+#endif
@@ -15,7 +15,9 @@
 #include "set_test.h"
 #include "test.h"
 
-#define MAX_TESTS 33 /*!< It defines the maximun tests in this file */
+BOOL test_id_is_odd(Id id, void *data);
+
+#define MAX_TESTS 49 /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for set unit tests.
@@ -81,6 +83,39 @@ int main(int argc, char **argv)
   if (all || test == i) test2_set_get_ids();
   i++;
 
+  if (all || test == i) test4_set_add();
+  i++;
+  if (all || test == i) test4_set_del_id();
+  i++;
+  if (all || test == i) test1_set_test();
+  i++;
+  if (all || test == i) test1_set_get_ids_by_number();
+  i++;
+  if (all || test == i) test5_set_add();
+  i++;
+  if (all || test == i) test1_set_idInSet();
+  i++;
+  if (all || test == i) test2_set_idInSet();
+  i++;
+  if (all || test == i) test1_set_union();
+  i++;
+  if (all || test == i) test2_set_union();
+  i++;
+  if (all || test == i) test1_set_intersect();
+  i++;
+  if (all || test == i) test1_set_difference();
+  i++;
+  if (all || test == i) test1_set_count_if();
+  i++;
+  if (all || test == i) test5_set_del_id();
+  i++;
+  if (all || test == i) test1_set_add_handle();
+  i++;
+  if (all || test == i) test1_set_del_handle();
+  i++;
+  if (all || test == i) test2_set_del_handle();
+  i++;
+
   PRINT_PASSED_PERCENTAGE;
 
   return 1;
@@ -191,3 +226,286 @@ void test2_set_get_ids()
   PRINT_TEST_RESULT(set_get_ids(s) == NULL);
 }
 
+/* capacity growth */
+void test4_set_add()
+{
+  Set *s = NULL;
+  Id id;
+  BOOL all_in = TRUE;
+  s = set_create();
+  for (id = 300; id < 310; id++)
+  {
+    set_add(s, id);
+  }
+  for (id = 300; id < 310; id++)
+  {
+    if (set_idInSet(s, id) == FALSE)
+    {
+      all_in = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(set_get_nids(s) == 10 && all_in == TRUE);
+  set_destroy(s);
+}
+void test4_set_del_id()
+{
+  Set *s = NULL;
+  Id id;
+  BOOL none_in = TRUE;
+  s = set_create();
+  for (id = 300; id < 310; id++)
+  {
+    set_add(s, id);
+  }
+  for (id = 300; id < 310; id += 2)
+  {
+    set_del_id(s, id);
+  }
+  for (id = 300; id < 310; id += 2)
+  {
+    if (set_idInSet(s, id) == TRUE)
+    {
+      none_in = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(set_get_nids(s) == 5 && none_in == TRUE);
+  set_destroy(s);
+}
+
+/* set_test */
+void test1_set_test()
+{
+  Set *s = NULL;
+  Id id;
+  s = set_create();
+  for (id = 300; id < 310; id++)
+  {
+    set_add(s, id);
+  }
+  PRINT_TEST_RESULT(set_test(s) == OK);
+  set_destroy(s);
+}
+
+/* set_get_ids_by_number */
+void test1_set_get_ids_by_number()
+{
+  Set *s = NULL;
+  s = set_create();
+  set_add(s, 31);
+  PRINT_TEST_RESULT(set_get_ids_by_number(s, 0) == 31 && set_get_ids_by_number(s, 1) == -1);
+  set_destroy(s);
+}
+
+void test5_set_add()
+{
+  Set *s = NULL;
+  s = set_create();
+  set_add(s, 31);
+  PRINT_TEST_RESULT(set_add(s, 31) == ERROR && set_get_nids(s) == 1);
+  set_destroy(s);
+}
+
+/* set_idInSet */
+void test1_set_idInSet()
+{
+  Set *s = NULL;
+  Id id;
+  BOOL ok = TRUE;
+  s = set_create();
+  for (id = 300; id < 400; id++)
+  {
+    set_add(s, id);
+  }
+  for (id = 300; id < 400; id += 2)
+  {
+    set_del_id(s, id);
+  }
+  for (id = 290; id < 410; id++)
+  {
+    if (set_idInSet(s, id) != ((id >= 300 && id < 400 && id % 2 == 1) ? TRUE : FALSE))
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(ok == TRUE && set_get_nids(s) == 50 && set_test(s) == OK);
+  set_destroy(s);
+}
+void test2_set_idInSet()
+{
+  Set *s = NULL;
+  Id id;
+  BOOL ok = TRUE;
+  s = set_create();
+  for (id = 0; id < 200; id++)
+  {
+    set_add(s, id * 1000 + 7);
+  }
+  for (id = 0; id < 200; id += 2)
+  {
+    set_del_id(s, id * 1000 + 7);
+  }
+  for (id = 0; id < 200; id++)
+  {
+    if (set_idInSet(s, id * 1000 + 7) != ((id % 2 == 1) ? TRUE : FALSE) || set_idInSet(s, id * 1000 + 8) == TRUE)
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(ok == TRUE && set_get_nids(s) == 100 && set_test(s) == OK);
+  set_destroy(s);
+}
+
+/* set_union */
+void test1_set_union()
+{
+  Set *a = NULL, *b = NULL, *dest = NULL;
+  Id id;
+  BOOL ok = TRUE;
+  a = set_create();
+  b = set_create();
+  dest = set_create();
+  for (id = 300; id < 400; id++)
+  {
+    set_add(a, id);
+    set_add(b, id + 50);
+  }
+  set_union(dest, a, b);
+  for (id = 290; id < 460; id++)
+  {
+    if (set_idInSet(dest, id) != ((id >= 300 && id < 450) ? TRUE : FALSE))
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(ok == TRUE && set_get_nids(dest) == 150 && set_test(dest) == OK);
+  set_destroy(a);
+  set_destroy(b);
+  set_destroy(dest);
+}
+void test2_set_union()
+{
+  Set *a = NULL, *b = NULL;
+  a = set_create();
+  b = set_create();
+  set_add(a, 1);
+  PRINT_TEST_RESULT(set_union(a, a, b) == ERROR);
+  set_destroy(a);
+  set_destroy(b);
+}
+
+/* set_intersect */
+void test1_set_intersect()
+{
+  Set *a = NULL, *b = NULL, *dest = NULL;
+  Id id;
+  BOOL ok = TRUE;
+  a = set_create();
+  b = set_create();
+  dest = set_create();
+  for (id = 300; id < 400; id++)
+  {
+    set_add(a, id);
+  }
+  for (id = 7; id <= 7000; id += 7)
+  {
+    set_add(b, id);
+  }
+  set_intersect(dest, a, b);
+  for (id = 290; id < 410; id++)
+  {
+    if (set_idInSet(dest, id) != ((id >= 300 && id < 400 && id % 7 == 0) ? TRUE : FALSE))
+    {
+      ok = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(ok == TRUE && set_get_nids(dest) == 15 && set_test(dest) == OK);
+  set_destroy(a);
+  set_destroy(b);
+  set_destroy(dest);
+}
+
+/* set_difference */
+void test1_set_difference()
+{
+  Set *a = NULL, *b = NULL, *dest = NULL;
+  a = set_create();
+  b = set_create();
+  dest = set_create();
+  set_add(a, 1);
+  set_add(a, 2);
+  set_add(a, 3);
+  set_add(b, 2);
+  set_difference(dest, a, b);
+  PRINT_TEST_RESULT(set_get_nids(dest) == 2 && set_idInSet(dest, 1) == TRUE && set_idInSet(dest, 2) == FALSE && set_idInSet(dest, 3) == TRUE);
+  set_destroy(a);
+  set_destroy(b);
+  set_destroy(dest);
+}
+
+/* set_count_if */
+BOOL test_id_is_odd(Id id, void *data)
+{
+  return id % 2 == 1 ? TRUE : FALSE;
+}
+void test1_set_count_if()
+{
+  Set *s = NULL;
+  Id id;
+  s = set_create();
+  for (id = 300; id < 400; id++)
+  {
+    set_add(s, id);
+  }
+  PRINT_TEST_RESULT(set_count_if(s, test_id_is_odd, NULL) == 50);
+  set_destroy(s);
+}
+
+void test5_set_del_id()
+{
+  Set *s = NULL;
+  Id id;
+  s = set_create();
+  for (id = 300; id < 320; id++)
+  {
+    set_add(s, id);
+  }
+  set_del_id(s, 305);
+  set_add(s, 305);
+  PRINT_TEST_RESULT(set_get_ids_by_number(s, 4) == 304 && set_get_ids_by_number(s, 5) == 306 && set_get_ids_by_number(s, 18) == 319 && set_get_ids_by_number(s, 19) == 305 && set_test(s) == OK);
+  set_destroy(s);
+}
+
+/* set_add_handle */
+void test1_set_add_handle()
+{
+  Set *s = NULL;
+  Set_handle h;
+  s = set_create();
+  h = set_add_handle(s, 31);
+  PRINT_TEST_RESULT(h != SET_NO_HANDLE && set_get_handle(s, 31) == h && set_get_id_by_handle(s, h) == 31);
+  set_destroy(s);
+}
+
+/* set_del_handle */
+void test1_set_del_handle()
+{
+  Set *s = NULL;
+  Set_handle h;
+  s = set_create();
+  set_add(s, 30);
+  h = set_add_handle(s, 31);
+  set_add(s, 32);
+  PRINT_TEST_RESULT(set_del_handle(s, h) == OK && set_idInSet(s, 31) == FALSE && set_get_ids_by_number(s, 1) == 32);
+  set_destroy(s);
+}
+void test2_set_del_handle()
+{
+  Set *s = NULL;
+  Set_handle h;
+  s = set_create();
+  h = set_add_handle(s, 31);
+  set_del_handle(s, h);
+  set_add(s, 31);
+  PRINT_TEST_RESULT(set_del_handle(s, h) == ERROR && set_get_id_by_handle(s, h) == NO_ID && set_idInSet(s, 31) == TRUE);
+  set_destroy(s);
+}
@@ -99,4 +99,103 @@ void test1_set_get_ids();
  */
 void test2_set_get_ids();
 
+/**
+ * @test Test function for adding more ids than the inline buffer holds
+ * @pre added 10 ids
+ * @post Output==10 and every id is in the set
+ */
+void test4_set_add();
+/**
+ * @test Test function for deleting after the set has grown
+ * @pre added 10 ids and deleted 5 of them
+ * @post Output==5 and the deleted ids are not in the set
+ */
+void test4_set_del_id();
+/**
+ * @test Test function for checking a set
+ * @pre added 10 ids
+ * @post Output==OK
+ */
+void test1_set_test();
+/**
+ * @test Test function for getting an id by position
+ * @pre added 1 id
+ * @post Output==-1 for a position out of the set
+ */
+void test1_set_get_ids_by_number();
+
+/**
+ * @test Test function for adding an id twice
+ * @pre id already in set
+ * @post Output==ERROR
+ */
+void test5_set_add();
+/**
+ * @test Test function for finding ids in a set of close ids
+ * @pre added ids 300-399 and deleted the even ones
+ * @post only the odd ids are in the set
+ */
+void test1_set_idInSet();
+/**
+ * @test Test function for finding ids in a set of sparse ids
+ * @pre added 200 ids far from each other and deleted half of them
+ * @post only the ones left are in the set and set_test==OK
+ */
+void test2_set_idInSet();
+
+/**
+ * @test Test function for the union of two sets of close ids
+ * @pre a = 300-399, b = 350-449
+ * @post dest = 300-449
+ */
+void test1_set_union();
+/**
+ * @test Test function for the union of a set with itself as dest
+ * @pre dest == a
+ * @post Output==ERROR
+ */
+void test2_set_union();
+/**
+ * @test Test function for the intersection of a set of close ids and a set of sparse ids
+ * @pre a = 300-399, b = multiples of 7 up to 7000
+ * @post dest = multiples of 7 in 300-399
+ */
+void test1_set_intersect();
+/**
+ * @test Test function for the difference of two small sets
+ * @pre a = {1, 2, 3}, b = {2}
+ * @post dest = {1, 3}
+ */
+void test1_set_difference();
+/**
+ * @test Test function for counting ids that satisfy a condition
+ * @pre added ids 300-399
+ * @post Output==50 for the odd ids
+ */
+void test1_set_count_if();
+/**
+ * @test Test function for the order of the ids after deleting one in the middle
+ * @pre added ids 300-319, deleted 305 and added again
+ * @post the other ids keep their order and 305 is the last one
+ */
+void test5_set_del_id();
+/**
+ * @test Test function for adding an id and getting its handle
+ * @pre added id 31
+ * @post the handle refers to id 31
+ */
+void test1_set_add_handle();
+/**
+ * @test Test function for deleting an id by its handle
+ * @pre ids 30, 31, 32 and the handle of 31
+ * @post Output==OK and 32 is the second id
+ */
+void test1_set_del_handle();
+/**
+ * @test Test function for deleting with a stale handle
+ * @pre handle of 31, deleted and 31 added again
+ * @post Output==ERROR
+ */
+void test2_set_del_handle();
+
 #endif
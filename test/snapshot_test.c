@@ -0,0 +1,284 @@
+/**
+ * @brief It tests snapshot module
+ *
+ * @file snapshot_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/snapshot.h"
+#include "snapshot_test.h"
+#include "test.h"
+
+#define MAX_TESTS 9 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Creates a game with the player 21 in the bright space 11, named "Cell"
+ *
+ * @return the game
+ */
+Game *snapshot_game()
+{
+  Game *g = NULL;
+  Space *s = NULL;
+  Player *p = NULL;
+  g = game_alloc2();
+  game_create(g);
+  s = space_create(11);
+  space_set_name(s, game_get_strpool(g), "Cell");
+  space_set_light_status(s, BRIGHT);
+  game_add_space(g, s);
+  p = player_create(21);
+  player_set_location(p, 11);
+  game_add_player(g, p);
+  return g;
+}
+
+/**
+ * @brief Links space 11 with another space
+ *
+ * @param g the game
+ * @param id id of the link
+ * @param dest space at the other end
+ * @param dir direction from space 11
+ * @param st status of the link
+ */
+void snapshot_link(Game *g, Id id, Id dest, DIRECTION dir, LINK_STATUS st)
+{
+  Link *l = NULL;
+  l = link_create(id);
+  link_set_name(l, "Door");
+  link_set_start(l, 11);
+  link_set_destination(l, dest);
+  link_set_direction(l, dir);
+  link_set_status(l, st);
+  game_add_link(g, l);
+  space_set_link(game_get_space(g, 11), id, dir);
+}
+
+/**
+ * @brief Main function for snapshot unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module snapshot:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_snapshot_take();
+  i++;
+  if (all || test == i) test2_snapshot_take();
+  i++;
+  if (all || test == i) test3_snapshot_take();
+  i++;
+  if (all || test == i) test4_snapshot_take();
+  i++;
+  if (all || test == i) test5_snapshot_take();
+  i++;
+  if (all || test == i) test6_snapshot_take();
+  i++;
+  if (all || test == i) test7_snapshot_take();
+  i++;
+  if (all || test == i) test8_snapshot_take();
+  i++;
+  if (all || test == i) test9_snapshot_take();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* snapshot_take */
+void test1_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  tc = tile_cache_create();
+  PRINT_TEST_RESULT(snapshot_take(&snap, NULL, tc, NULL, NULL, 1) == ERROR);
+  tile_cache_destroy(tc);
+}
+void test2_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Game *g = NULL;
+  g = snapshot_game();
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, NULL, 1);
+  PRINT_TEST_RESULT(snap.location == 11 && snap.rooms[SNAP_HERE].id == 11 && strcmp(snap.rooms[SNAP_HERE].tile[1], "| Cell            |") == 0 && snap.rooms[SNAP_NORTH].id == NO_ID && snap.rooms[SNAP_EAST].id == NO_ID && snap.st == 1);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test3_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Game *g = NULL;
+  g = snapshot_game();
+  game_add_space(g, space_create(12));
+  snapshot_link(g, 51, 12, E, OPEN_L);
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, NULL, 1);
+  PRINT_TEST_RESULT(snap.rooms[SNAP_EAST].id == 12 && snap.rooms[SNAP_EAST].link == '>' && snap.rooms[SNAP_WEST].id == NO_ID);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test4_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Object *o = NULL;
+  Game *g = NULL;
+  g = snapshot_game();
+  o = obj_create(31);
+  obj_set_name(o, "Key");
+  object_set_light_visible(o, BRIGHT);
+  game_add_object(g, o);
+  space_add_objectid(game_get_space(g, 11), 31);
+  o = obj_create(32);
+  obj_set_name(o, "Ghost");
+  object_set_light_visible(o, DARK);
+  game_add_object(g, o);
+  space_add_objectid(game_get_space(g, 11), 32);
+  o = obj_create(33);
+  obj_set_name(o, "Torch");
+  game_add_object(g, o);
+  player_set_max_inventory(game_get_player(g, 21), 2);
+  player_add_object(game_get_player(g, 21), o);
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, NULL, 1);
+  PRINT_TEST_RESULT(snap.n_objects == 1 && strcmp(snap.objects[0], "Key") == 0 && snap.n_inventory == 1 && strcmp(snap.inventory[0], "Torch") == 0);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test5_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Enemy *e = NULL;
+  Game *g = NULL;
+  g = snapshot_game();
+  e = enemy_create(41);
+  enemy_set_name(e, "Rat");
+  enemy_set_location(e, 11);
+  enemy_set_health(e, 3);
+  game_add_enemy(g, e);
+  e = enemy_create(42);
+  enemy_set_location(e, 12);
+  game_add_enemy(g, e);
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, NULL, 1);
+  PRINT_TEST_RESULT(snap.panel == TRUE && snap.n_enemies == 1 && strcmp(snap.enemies[0].name, "Rat") == 0 && snap.enemies[0].health == 3);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test6_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Game *g = NULL;
+  g = snapshot_game();
+  game_add_space(g, space_create(12));
+  snapshot_link(g, 51, 12, S, CLOSE);
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, NULL, 1);
+  PRINT_TEST_RESULT(snap.n_closed == 1 && strcmp(snap.closed[0].name, "Door") == 0 && snap.closed[0].dir == S && snap.rooms[SNAP_SOUTH].link == ' ');
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test7_snapshot_take()
+{
+  Snapshot snap;
+  Tile_cache *tc = NULL;
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  int y = SNAPSHOT_MAP_Y / 2, x = SNAPSHOT_MAP_X / 2;
+  g = snapshot_game();
+  game_add_space(g, space_create(12));
+  game_add_space(g, space_create(13));
+  snapshot_link(g, 51, 12, E, OPEN_L);
+  snapshot_link(g, 52, 13, S, CLOSE);
+  tc = tile_cache_create();
+  vp = viewport_create(SNAPSHOT_MAP_W, SNAPSHOT_MAP_H, VIEWPORT_FLOOR);
+  snapshot_take(&snap, g, tc, vp, NULL, 1);
+  PRINT_TEST_RESULT(snap.minimap[y][x] == '@' && snap.minimap[y][x + 1] == '-' && snap.minimap[y][x + 2] == 'o' && snap.minimap[y + 1][x] == 'x' && snap.minimap[y + 2][x] == 'o' && snap.minimap[0][0] == ' ');
+  viewport_destroy(vp);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test8_snapshot_take()
+{
+  Snapshot snap;
+  Snapshot_scroll scroll = {SNAPSHOT_INVENTORY_PAGE, 0};
+  Tile_cache *tc = NULL;
+  Object *o = NULL;
+  Game *g = NULL;
+  char name[8];
+  int i;
+  g = snapshot_game();
+  player_set_max_inventory(game_get_player(g, 21), 7);
+  for (i = 0; i < 7; i++)
+  {
+    o = obj_create(31 + i);
+    sprintf(name, "Obj%d", i);
+    obj_set_name(o, name);
+    game_add_object(g, o);
+    player_add_object(game_get_player(g, 21), o);
+  }
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, &scroll, 1);
+  PRINT_TEST_RESULT(snap.n_inventory == 2 && snap.inventory_first == 5 && snap.inventory_total == 7 && strcmp(snap.inventory[0], "Obj5") == 0 && scroll.inventory == 5);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test9_snapshot_take()
+{
+  Snapshot snap;
+  Snapshot_scroll scroll = {0, 2 * SNAPSHOT_ENEMIES_PAGE};
+  Tile_cache *tc = NULL;
+  Enemy *e = NULL;
+  Game *g = NULL;
+  int i;
+  g = snapshot_game();
+  for (i = 0; i < 4; i++)
+  {
+    e = enemy_create(41 + i);
+    enemy_set_name(e, i == 0 ? "Rat" : "Slime");
+    enemy_set_location(e, 11);
+    game_add_enemy(g, e);
+  }
+  tc = tile_cache_create();
+  snapshot_take(&snap, g, tc, NULL, &scroll, 1);
+  PRINT_TEST_RESULT(snap.n_enemies == SNAPSHOT_ENEMIES_PAGE && snap.enemies_first == 0 && snap.enemies_total == 4 && strcmp(snap.enemies[0].name, "Rat") == 0 && scroll.enemies == 0);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
@@ -0,0 +1,69 @@
+/** 
+ * @brief It declares the tests for the snapshot module
+ * 
+ * @file snapshot_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef SNAPSHOT_TEST_H
+#define SNAPSHOT_TEST_H
+
+/**
+ * @test Test function for taking a snapshot
+ * @pre game = NULL
+ * @post Output == ERROR
+ */
+void test1_snapshot_take();
+/**
+ * @test Test function for taking a snapshot
+ * @pre player in space 11, with no neighbours
+ * @post the room of the player is taken and the others are empty
+ */
+void test2_snapshot_take();
+/**
+ * @test Test function for taking a snapshot
+ * @pre space 12 to the east of space 11, the link open
+ * @post the east room is taken with its arrow
+ */
+void test3_snapshot_take();
+/**
+ * @test Test function for taking a snapshot
+ * @pre a visible and a hidden object in the room, one carried by the player
+ * @post only the visible object is in the room and the carried one in the inventory
+ */
+void test4_snapshot_take();
+/**
+ * @test Test function for taking a snapshot
+ * @pre an enemy in the room and another one elsewhere
+ * @post only the enemy in the room is taken
+ */
+void test5_snapshot_take();
+/**
+ * @test Test function for taking a snapshot
+ * @pre a closed link with a name
+ * @post the link is in the closed links
+ */
+void test6_snapshot_take();
+/**
+ * @test Test function for taking a snapshot with its minimap
+ * @pre an open link to the east and a closed one to the south
+ * @post the player in the middle, a room on each side and the links between
+ */
+void test7_snapshot_take();
+/**
+ * @test Test function for taking a snapshot of a page of the inventory
+ * @pre 7 objects carried, scrolled to the second page
+ * @post only the last 2 are taken, the 7 are counted
+ */
+void test8_snapshot_take();
+/**
+ * @test Test function for taking a snapshot of a page of the enemies
+ * @pre 4 enemies in the room, scrolled past the last page
+ * @post the first page is taken and the scroll goes back to it
+ */
+void test9_snapshot_take();
+
+#endif
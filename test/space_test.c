@@ -15,7 +15,7 @@
 #include "space_test.h"
 #include "test.h"
 
-#define MAX_TESTS 46 /*!< It defines the maximun tests in this file */
+#define MAX_TESTS 48 /*!< It defines the maximun tests in this file */
 
 /**
  * @brief Main function for SPACE unit tests.
@@ -169,6 +169,10 @@ int main(int argc, char **argv)
   i++;
   if (all || test == i) test2_space_get_floor();
   i++;
+  if (all || test == i) test1_space_borrow_texts();
+  i++;
+  if (all || test == i) test2_space_borrow_texts();
+  i++;
 
 
   PRINT_PASSED_PERCENTAGE;
@@ -210,22 +214,31 @@ void test2_space_destroy()
 /*  space_set_name*/
 void test1_space_set_name()
 {
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
   Space *s;
   s = space_create(5);
-  PRINT_TEST_RESULT(space_set_name(s, "hola") == OK);
+  PRINT_TEST_RESULT(space_set_name(s, pool, "hola") == OK);
   space_destroy(s);
+  arena_destroy(arena);
 }
 void test2_space_set_name()
 {
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
   Space *s = NULL;
-  PRINT_TEST_RESULT(space_set_name(s, "hola") == ERROR);
+  PRINT_TEST_RESULT(space_set_name(s, pool, "hola") == ERROR);
+  arena_destroy(arena);
 }
 void test3_space_set_name()
 {
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
   Space *s;
   s = space_create(5);
-  PRINT_TEST_RESULT(space_set_name(s, NULL) == ERROR);
+  PRINT_TEST_RESULT(space_set_name(s, pool, NULL) == ERROR);
   space_destroy(s);
+  arena_destroy(arena);
 }
 
 /*  space_set_link */
@@ -396,11 +409,14 @@ void test3_space_get_object()
 /*  space_get_name*/
 void test1_space_get_name()
 {
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
   Space *s;
   s = space_create(1);
-  space_set_name(s, "adios");
+  space_set_name(s, pool, "adios");
   PRINT_TEST_RESULT(strcmp(space_get_name(s), "adios") == 0);
   space_destroy(s);
+  arena_destroy(arena);
 }
 void test2_space_get_name()
 {
@@ -477,38 +493,52 @@ void test2_space_get_link_west()
 /*  space_set_gdesc*/
 void test1_space_set_gdesc()
 {
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
   Space *s = NULL;
   char **gdesc;
   s = space_create(5);
   gdesc = space_create_gdesc();
-  PRINT_TEST_RESULT(space_set_gdesc(s, gdesc) == OK);
+  PRINT_TEST_RESULT(space_set_gdesc(s, atlas, gdesc) == OK);
+  space_destroy_gdesc(gdesc);
   space_destroy(s);
+  arena_destroy(arena);
 }
 void test2_space_set_gdesc()
 {
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
   Space *s = NULL;
   char *gdesc[TAM_GDESC_X] = {"123456789", "123456789", "123456789", "123456789", "123456789"};
-  PRINT_TEST_RESULT(space_set_gdesc(s, gdesc) == ERROR);
+  PRINT_TEST_RESULT(space_set_gdesc(s, atlas, gdesc) == ERROR);
+  arena_destroy(arena);
 }
 void test3_space_set_gdesc()
 {
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
   Space *s = NULL;
   char **gdesc = NULL;
   s = space_create(5);
-  PRINT_TEST_RESULT(space_set_gdesc(s, gdesc) == ERROR);
+  PRINT_TEST_RESULT(space_set_gdesc(s, atlas, gdesc) == ERROR);
   space_destroy(s);
+  arena_destroy(arena);
 }
 
 /*  space_get_desc*/
 void test1_space_get_gdesc()
 {
+  Arena *arena = arena_create(0);
+  Atlas *atlas = atlas_create(arena);
   Space *s = NULL;
   char **gdesc;
   s = space_create(5);
   gdesc = space_create_gdesc();
   
-  PRINT_TEST_RESULT(space_set_gdesc(s, gdesc) == OK);
+  PRINT_TEST_RESULT(space_set_gdesc(s, atlas, gdesc) == OK);
+  space_destroy_gdesc(gdesc);
   space_destroy(s);
+  arena_destroy(arena);
 }
 void test2_space_get_gdesc()
 {
@@ -574,3 +604,21 @@ void test2_space_get_floor()
   Space *s = NULL;
   PRINT_TEST_RESULT(space_get_floor(s) == UNKNOWN_FLOOR);
 }
+
+/* space_borrow_texts */
+void test1_space_borrow_texts()
+{
+  Space *s;
+  const char *name = "Cell", *brief = "Starting position", *detail = "Cell has a hungry cellmate";
+  s = space_create(5);
+  space_borrow_texts(s, name, brief, detail);
+  PRINT_TEST_RESULT(space_get_name(s) == name && space_get_brief_description(s) == brief && space_get_long_description(s) == detail);
+  space_destroy(s);
+}
+void test2_space_borrow_texts()
+{
+  Space *s;
+  s = space_create(5);
+  PRINT_TEST_RESULT(space_borrow_texts(s, "Cell", NULL, "") == ERROR);
+  space_destroy(s);
+}
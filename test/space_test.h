@@ -390,5 +390,17 @@ void test1_space_get_floor();
  * @post Output==UNKNOWN_FLOOR
  */
 void test2_space_get_floor();
+/**
+ * @test Test function for borrowing the texts of a space
+ * @pre pointer to space != NULL and three texts
+ * @post the space gets the same pointers, not copies
+ */
+void test1_space_borrow_texts();
+/**
+ * @test Test function for borrowing the texts of a space
+ * @pre one of the texts = NULL
+ * @post Output==ERROR
+ */
+void test2_space_borrow_texts();
 
 #endif
@@ -0,0 +1,231 @@
+/**
+ * @brief It tests stream module
+ *
+ * @file stream_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include "../include/stream.h"
+#include "stream_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8                     /*!< It defines the maximun tests in this file */
+#define TEST_SOCKET "stream_test.sock"  /*!< Socket of the streams tested */
+#define TEST_CELLS "~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~" /*!< A screen of 4x10 */
+#define TEST_BIG (64 * 1024)            /*!< Bytes of the changes of a big frame */
+
+/**
+ * @brief Connects a viewer to the socket
+ *
+ * @return the socket of the viewer, or -1 on error
+ */
+int viewer_connect()
+{
+  struct sockaddr_un addr;
+  int fd;
+
+  fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  strcpy(addr.sun_path, TEST_SOCKET);
+  if (fd < 0 || connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)
+  {
+    return -1;
+  }
+
+  return fd;
+}
+
+/**
+ * @brief Reads what a viewer got, without waiting
+ *
+ * @param fd socket of the viewer
+ * @param buf where it is read, ended by '\0'
+ * @param max bytes of buf
+ * @return bytes read
+ */
+long viewer_read(int fd, char *buf, long max)
+{
+  long n, total = 0;
+
+  while (total < max - 1 && (n = (long)recv(fd, buf + total, max - 1 - total, MSG_DONTWAIT)) > 0)
+  {
+    total += n;
+  }
+  buf[total] = '\0';
+
+  return total;
+}
+
+/**
+ * @brief Main function for stream unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module stream:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_stream_create();
+  i++;
+  if (all || test == i) test2_stream_create();
+  i++;
+  if (all || test == i) test3_stream_create();
+  i++;
+  if (all || test == i) test1_stream_publish();
+  i++;
+  if (all || test == i) test2_stream_publish();
+  i++;
+  if (all || test == i) test3_stream_publish();
+  i++;
+  if (all || test == i) test4_stream_publish();
+  i++;
+  if (all || test == i) test1_stream_get_dropped();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* stream_create */
+void test1_stream_create()
+{
+  PRINT_TEST_RESULT(stream_create(NULL, 4, 10) == NULL);
+}
+void test2_stream_create()
+{
+  Stream *s = NULL;
+  s = stream_create(TEST_SOCKET, 4, 10);
+  PRINT_TEST_RESULT(s != NULL && stream_get_viewers(s) == 0 && stream_publish(s, TEST_CELLS, "AB", 2) == 0);
+  stream_destroy(s);
+}
+void test3_stream_create()
+{
+  Stream *s = NULL;
+  FILE *f = NULL;
+  BOOL kept = FALSE;
+
+  f = fopen(TEST_SOCKET, "w");
+  if (f)
+  {
+    fprintf(f, "not a socket\n");
+    fclose(f);
+  }
+  s = stream_create(TEST_SOCKET, 4, 10);
+  f = fopen(TEST_SOCKET, "r");
+  if (f)
+  {
+    kept = TRUE;
+    fclose(f);
+  }
+  PRINT_TEST_RESULT(s == NULL && kept == TRUE);
+  stream_destroy(s);
+  remove(TEST_SOCKET);
+}
+
+/* stream_publish */
+void test1_stream_publish()
+{
+  Stream *s = NULL;
+  char buf[1024];
+  int fd;
+  s = stream_create(TEST_SOCKET, 4, 10);
+  fd = viewer_connect();
+  PRINT_TEST_RESULT(fd >= 0 && stream_publish(s, TEST_CELLS, "AB", 2) == 1 && viewer_read(fd, buf, sizeof(buf)) > 0 && strstr(buf, "\033[2J") != NULL && strstr(buf, "AB") == NULL && stream_get_keyframes(s) == 1);
+  close(fd);
+  stream_destroy(s);
+}
+void test2_stream_publish()
+{
+  Stream *s = NULL;
+  char buf[1024];
+  int fd;
+  s = stream_create(TEST_SOCKET, 4, 10);
+  fd = viewer_connect();
+  stream_publish(s, TEST_CELLS, "AB", 2);
+  viewer_read(fd, buf, sizeof(buf));
+  stream_publish(s, TEST_CELLS, "CD", 2);
+  PRINT_TEST_RESULT(viewer_read(fd, buf, sizeof(buf)) == 2 && strcmp(buf, "CD") == 0 && stream_get_dropped(s) == 0);
+  close(fd);
+  stream_destroy(s);
+}
+void test3_stream_publish()
+{
+  Stream *s = NULL;
+  char *big = NULL, *buf = NULL;
+  BOOL key = FALSE;
+  int fd, i;
+  big = (char *)malloc(TEST_BIG);
+  buf = (char *)malloc(4 * TEST_BIG);
+  memset(big, 'x', TEST_BIG);
+  s = stream_create(TEST_SOCKET, 4, 10);
+  fd = viewer_connect();
+  stream_publish(s, TEST_CELLS, "AB", 2);
+  for (i = 0; i < 40; i++)
+  {
+    stream_publish(s, TEST_CELLS, big, TEST_BIG);
+  }
+  /* Once it reads again, a keyframe comes after the changes queued */
+  for (i = 0; i < 40 && !key; i++)
+  {
+    viewer_read(fd, buf, 4 * TEST_BIG);
+    stream_publish(s, TEST_CELLS, "EF", 2);
+    key = (viewer_read(fd, buf, 4 * TEST_BIG) > 0 && strstr(buf, "\033[2J") != NULL) ? TRUE : FALSE;
+  }
+  PRINT_TEST_RESULT(stream_get_dropped(s) > 0 && key == TRUE && stream_get_keyframes(s) > 1);
+  close(fd);
+  stream_destroy(s);
+  free(big);
+  free(buf);
+}
+void test4_stream_publish()
+{
+  Stream *s = NULL;
+  int fd;
+  s = stream_create(TEST_SOCKET, 4, 10);
+  fd = viewer_connect();
+  stream_publish(s, TEST_CELLS, "AB", 2);
+  close(fd);
+  stream_publish(s, TEST_CELLS, "CD", 2);
+  PRINT_TEST_RESULT(stream_get_viewers(s) == 0);
+  stream_destroy(s);
+}
+
+/* stream_get_dropped */
+void test1_stream_get_dropped()
+{
+  PRINT_TEST_RESULT(stream_get_dropped(NULL) == -1);
+}
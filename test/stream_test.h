@@ -0,0 +1,63 @@
+/** 
+ * @brief It declares the tests for the stream module
+ * 
+ * @file stream_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STREAM_TEST_H
+#define STREAM_TEST_H
+
+/**
+ * @test Test function for creating a stream
+ * @pre path = NULL
+ * @post Output == NULL
+ */
+void test1_stream_create();
+/**
+ * @test Test function for creating a stream
+ * @pre a socket in the working directory
+ * @post a stream without viewers
+ */
+void test2_stream_create();
+/**
+ * @test Test function for creating a stream over a regular file
+ * @pre a regular file at the path of the socket
+ * @post Output == NULL and the file is still there
+ */
+void test3_stream_create();
+/**
+ * @test Test function for publishing to a viewer that just joined
+ * @pre a viewer connected before the frame
+ * @post it gets a keyframe, not the changes
+ */
+void test1_stream_publish();
+/**
+ * @test Test function for publishing to a viewer that has the frame before
+ * @pre a second frame published
+ * @post the viewer gets only its changes
+ */
+void test2_stream_publish();
+/**
+ * @test Test function for publishing to a slow viewer
+ * @pre a viewer that reads nothing while many big frames are published
+ * @post frames are dropped, and it gets a keyframe after them
+ */
+void test3_stream_publish();
+/**
+ * @test Test function for publishing after a viewer leaves
+ * @pre the socket of the viewer closed
+ * @post the viewer is closed by the stream
+ */
+void test4_stream_publish();
+/**
+ * @test Test function for getting the frames dropped
+ * @pre stream = NULL
+ * @post Output == -1
+ */
+void test1_stream_get_dropped();
+
+#endif
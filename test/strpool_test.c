@@ -0,0 +1,157 @@
+/**
+ * @brief It tests strpool module
+ *
+ * @file strpool_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/strpool.h"
+#include "../include/space.h"
+#include "strpool_test.h"
+#include "test.h"
+
+#define MAX_TESTS 7 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Main function for strpool unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module strpool:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_strpool_intern();
+  i++;
+  if (all || test == i) test2_strpool_intern();
+  i++;
+  if (all || test == i) test3_strpool_intern();
+  i++;
+  if (all || test == i) test4_strpool_intern();
+  i++;
+  if (all || test == i) test5_strpool_intern();
+  i++;
+  if (all || test == i) test1_strpool_get_bytes();
+  i++;
+  if (all || test == i) test1_strpool_space();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* strpool_intern */
+void test1_strpool_intern()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  char str[] = "hola";
+  const char *pooled = NULL;
+  pooled = strpool_intern(pool, str);
+  PRINT_TEST_RESULT(pooled != NULL && pooled != str && strcmp(pooled, "hola") == 0);
+  arena_destroy(arena);
+}
+void test2_strpool_intern()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  PRINT_TEST_RESULT(strpool_intern(pool, NULL) == NULL);
+  arena_destroy(arena);
+}
+void test3_strpool_intern()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  char str1[] = "Recovers 3 health when used", str2[] = "Recovers 3 health when used";
+  PRINT_TEST_RESULT(strpool_intern(pool, str1) == strpool_intern(pool, str2) && strpool_get_count(pool) == 1);
+  arena_destroy(arena);
+}
+void test4_strpool_intern()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  const char *first[1000];
+  char str[20];
+  int i;
+  BOOL same = TRUE;
+  for (i = 0; i < 1000; i++)
+  {
+    sprintf(str, "string %d", i);
+    first[i] = strpool_intern(pool, str);
+  }
+  for (i = 0; i < 1000; i++)
+  {
+    sprintf(str, "string %d", i);
+    if (strpool_intern(pool, str) != first[i] || strcmp(first[i], str) != 0)
+    {
+      same = FALSE;
+    }
+  }
+  PRINT_TEST_RESULT(same == TRUE && strpool_get_count(pool) == 1000);
+  arena_destroy(arena);
+}
+void test5_strpool_intern()
+{
+  Arena *arena = arena_create(0);
+  Strpool *first = strpool_create(arena), *second = strpool_create(arena);
+  PRINT_TEST_RESULT(strpool_intern(first, "Entry") != strpool_intern(second, "Entry") && strpool_get_count(first) == 1 && strpool_get_count(second) == 1);
+  arena_destroy(arena);
+}
+
+/* strpool_get_bytes */
+void test1_strpool_get_bytes()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  strpool_intern(pool, "abc");
+  strpool_intern(pool, "de");
+  strpool_intern(pool, "abc");
+  PRINT_TEST_RESULT(strpool_get_bytes(pool) == 7);
+  arena_destroy(arena);
+}
+
+/* space_set_name */
+void test1_strpool_space()
+{
+  Arena *arena = arena_create(0);
+  Strpool *pool = strpool_create(arena);
+  Space *s1 = NULL, *s2 = NULL;
+  s1 = space_create(1);
+  s2 = space_create(2);
+  space_set_name(s1, pool, "Entry");
+  space_set_name(s2, pool, "Entry");
+  PRINT_TEST_RESULT(space_get_name(s1) == space_get_name(s2) && strcmp(space_get_name(s1), "Entry") == 0);
+  space_destroy(s1);
+  space_destroy(s2);
+  arena_destroy(arena);
+}
@@ -0,0 +1,59 @@
+/** 
+ * @brief It declares the tests for the strpool module
+ * 
+ * @file strpool_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef STRPOOL_TEST_H
+#define STRPOOL_TEST_H
+
+/**
+ * @test Test function for interning a string
+ * @pre string "hola"
+ * @post a different pointer with the same text
+ */
+void test1_strpool_intern();
+/**
+ * @test Test function for interning a string
+ * @pre string = NULL
+ * @post Output == NULL
+ */
+void test2_strpool_intern();
+/**
+ * @test Test function for interning the same text twice
+ * @pre two buffers with the same text
+ * @post the same pointer and only one string in the pool
+ */
+void test3_strpool_intern();
+/**
+ * @test Test function for interning many strings
+ * @pre 1000 different strings, interned twice
+ * @post 1000 strings in the pool and each text gets its own pointer
+ */
+void test4_strpool_intern();
+/**
+ * @test Test function for two pools
+ * @pre the same text interned in two pools
+ * @post a pointer of each pool and one string in each
+ */
+void test5_strpool_intern();
+
+/**
+ * @test Test function for the bytes of the pool
+ * @pre "abc" and "de" interned
+ * @post Output == 7
+ */
+void test1_strpool_get_bytes();
+
+/**
+ * @test Test function for spaces sharing their texts
+ * @pre two spaces with the same name
+ * @post both names are the same pointer
+ */
+void test1_strpool_space();
+
+#endif
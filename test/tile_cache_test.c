@@ -0,0 +1,203 @@
+/**
+ * @brief It tests tile cache module
+ *
+ * @file tile_cache_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../include/tile_cache.h"
+#include "tile_cache_test.h"
+#include "test.h"
+
+#define MAX_TESTS 8 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Creates a game with the bright space 11, named "Cell"
+ *
+ * @return the game
+ */
+Game *tile_game()
+{
+  Game *g = NULL;
+  Space *s = NULL;
+  g = game_alloc2();
+  game_create(g);
+  s = space_create(11);
+  space_set_name(s, game_get_strpool(g), "Cell");
+  space_set_light_status(s, BRIGHT);
+  game_add_space(g, s);
+  return g;
+}
+
+/**
+ * @brief Main function for tile cache unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module tile cache:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_tile_cache_create();
+  i++;
+  if (all || test == i) test1_tile_cache_get();
+  i++;
+  if (all || test == i) test2_tile_cache_get();
+  i++;
+  if (all || test == i) test3_tile_cache_get();
+  i++;
+  if (all || test == i) test4_tile_cache_get();
+  i++;
+  if (all || test == i) test5_tile_cache_get();
+  i++;
+  if (all || test == i) test6_tile_cache_get();
+  i++;
+  if (all || test == i) test1_tile_cache_clear();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* tile_cache_create */
+void test1_tile_cache_create()
+{
+  Tile_cache *tc = NULL;
+  tc = tile_cache_create();
+  PRINT_TEST_RESULT(tc != NULL && tile_cache_get_draws(tc) == 0 && tile_cache_get_hits(tc) == 0);
+  tile_cache_destroy(tc);
+}
+
+/* tile_cache_get */
+void test1_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile_row *tile = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  tile = tile_cache_get(tc, g, 11, FALSE, FALSE);
+  PRINT_TEST_RESULT(tile != NULL && strcmp(tile[1], "| Cell            |") == 0 && strcmp(tile[10], "|                 |") == 0 && tile_cache_get_draws(tc) == 1);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test2_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  PRINT_TEST_RESULT(tile_cache_get(tc, g, 12, FALSE, FALSE) == NULL);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test3_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile_row *tile = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  tile_cache_get(tc, g, 11, FALSE, FALSE);
+  tile = tile_cache_get(tc, g, 11, FALSE, FALSE);
+  PRINT_TEST_RESULT(tile != NULL && tile_cache_get_draws(tc) == 1 && tile_cache_get_hits(tc) == 1);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test4_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile_row *tile = NULL;
+  Object *o = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  tile_cache_get(tc, g, 11, FALSE, FALSE);
+  o = obj_create(31);
+  object_set_light_visible(o, BRIGHT);
+  game_add_object(g, o);
+  space_add_objectid(game_get_space(g, 11), 31);
+  tile = tile_cache_get(tc, g, 11, FALSE, FALSE);
+  PRINT_TEST_RESULT(tile != NULL && strcmp(tile[10], "|        *        |") == 0 && tile_cache_get_draws(tc) == 2);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test5_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile_row *tile = NULL;
+  char *rows[ENEMY_GDESC_Y] = {"abc", "def", "ghi"};
+  Enemy *e = NULL;
+  Game *g = NULL;
+  BOOL with, without;
+  g = tile_game();
+  tc = tile_cache_create();
+  e = enemy_create(41);
+  enemy_set_location(e, 11);
+  enemy_set_gdesc(e, game_get_atlas(g), rows);
+  game_add_enemy(g, e);
+  tile = tile_cache_get(tc, g, 11, TRUE, FALSE);
+  with = tile != NULL && strncmp(tile[4], "| abc", 5) == 0;
+  tile = tile_cache_get(tc, g, 11, FALSE, FALSE);
+  without = tile != NULL && strncmp(tile[4], "| abc", 5) != 0;
+  PRINT_TEST_RESULT(with && without && tile_cache_get_draws(tc) == 2);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+void test6_tile_cache_get()
+{
+  Tile_cache *tc = NULL;
+  const Tile_row *tile = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  tile = tile_cache_get(tc, g, 11, FALSE, TRUE);
+  PRINT_TEST_RESULT(tile != NULL && strstr(tile[1], "Cell") == NULL);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
+
+/* tile_cache_clear */
+void test1_tile_cache_clear()
+{
+  Tile_cache *tc = NULL;
+  Game *g = NULL;
+  g = tile_game();
+  tc = tile_cache_create();
+  tile_cache_get(tc, g, 11, FALSE, FALSE);
+  tile_cache_clear(tc);
+  tile_cache_get(tc, g, 11, FALSE, FALSE);
+  PRINT_TEST_RESULT(tile_cache_get_draws(tc) == 2 && tile_cache_get_hits(tc) == 0);
+  tile_cache_destroy(tc);
+  game_destroy(g);
+}
@@ -0,0 +1,63 @@
+/** 
+ * @brief It declares the tests for the tile cache module
+ * 
+ * @file tile_cache_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef TILE_CACHE_TEST_H
+#define TILE_CACHE_TEST_H
+
+/**
+ * @test Test function for creating a tile cache
+ * @pre nothing
+ * @post a cache with nothing drawn
+ */
+void test1_tile_cache_create();
+/**
+ * @test Test function for getting a tile
+ * @pre space 11 named "Cell"
+ * @post a tile with its name and no object mark
+ */
+void test1_tile_cache_get();
+/**
+ * @test Test function for getting a tile
+ * @pre space that is not in the game
+ * @post Output == NULL
+ */
+void test2_tile_cache_get();
+/**
+ * @test Test function for getting a tile twice
+ * @pre the space does not change between both
+ * @post the second time it is taken from the cache
+ */
+void test3_tile_cache_get();
+/**
+ * @test Test function for getting a tile after the space changes
+ * @pre a visible object is added to the space
+ * @post the tile is drawn again with the object mark
+ */
+void test4_tile_cache_get();
+/**
+ * @test Test function for getting a tile with its enemy
+ * @pre an enemy in the space, the tile asked with and without it
+ * @post the tile is drawn again each time and only shows the enemy when asked
+ */
+void test5_tile_cache_get();
+/**
+ * @test Test function for getting a tile behind the fog
+ * @pre fog = TRUE
+ * @post the name is hidden
+ */
+void test6_tile_cache_get();
+/**
+ * @test Test function for clearing the cache
+ * @pre a tile already drawn
+ * @post the tile is drawn again
+ */
+void test1_tile_cache_clear();
+
+#endif
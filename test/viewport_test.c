@@ -0,0 +1,181 @@
+/**
+ * @brief It tests viewport module
+ *
+ * @file viewport_test.c
+ * @author Miguel Soto
+ * @version 1.0
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "../include/viewport.h"
+#include "viewport_test.h"
+#include "test.h"
+
+#define MAX_TESTS 7 /*!< It defines the maximun tests in this file */
+
+/**
+ * @brief Links two spaces one way
+ *
+ * @param g the game
+ * @param id id of the link
+ * @param from space where the link starts
+ * @param to space at the other end
+ * @param dir direction from the first space
+ * @param st status of the link
+ */
+void viewport_link(Game *g, Id id, Id from, Id to, DIRECTION dir, LINK_STATUS st)
+{
+  Link *l = NULL;
+  l = link_create(id);
+  link_set_start(l, from);
+  link_set_destination(l, to);
+  link_set_direction(l, dir);
+  link_set_status(l, st);
+  game_add_link(g, l);
+  space_set_link(game_get_space(g, from), id, dir);
+}
+
+/**
+ * @brief Creates a game with the rooms 11-12-13 from west to east and 14 south of 11
+ *
+ * @return the game
+ */
+Game *viewport_game()
+{
+  Game *g = NULL;
+  Id id;
+  g = game_alloc2();
+  game_create(g);
+  for (id = 11; id <= 14; id++)
+  {
+    game_add_space(g, space_create(id));
+  }
+  viewport_link(g, 51, 11, 12, E, OPEN_L);
+  viewport_link(g, 52, 12, 11, W, OPEN_L);
+  viewport_link(g, 53, 12, 13, E, OPEN_L);
+  viewport_link(g, 54, 11, 14, S, CLOSE);
+  return g;
+}
+
+/**
+ * @brief Main function for viewport unit tests.
+ *
+ * You may execute ALL or a SINGLE test
+ *   1.- No parameter -> ALL test are executed
+ *   2.- A number means a particular test (the one identified by that number)
+ *       is executed
+ *
+ */
+int main(int argc, char **argv)
+{
+
+  int test = 0;
+  int all = 1, i;
+
+  if (argc < 2)
+  {
+    printf("Running all test for module viewport:\n");
+  }
+  else
+  {
+    test = atoi(argv[1]);
+    all = 0;
+    printf("Running test %d:\t", test);
+    if (test < 1 && test > MAX_TESTS)
+    {
+      printf("Error: unknown test %d\t", test);
+      exit(EXIT_SUCCESS);
+    }
+  }
+
+  i = 1;
+  if (all || test == i) test1_viewport_create();
+  i++;
+  if (all || test == i) test2_viewport_create();
+  i++;
+  if (all || test == i) test1_viewport_layout();
+  i++;
+  if (all || test == i) test2_viewport_layout();
+  i++;
+  if (all || test == i) test3_viewport_layout();
+  i++;
+  if (all || test == i) test4_viewport_layout();
+  i++;
+  if (all || test == i) test1_viewport_get_link();
+  i++;
+
+  PRINT_PASSED_PERCENTAGE;
+
+  return 1;
+}
+
+/* viewport_create */
+void test1_viewport_create()
+{
+  Viewport *vp = NULL;
+  vp = viewport_create(3, 3, 1);
+  PRINT_TEST_RESULT(vp != NULL && viewport_get_width(vp) == 3 && viewport_get_height(vp) == 3 && viewport_get_room(vp, 1, 1) == NO_ID);
+  viewport_destroy(vp);
+}
+void test2_viewport_create()
+{
+  PRINT_TEST_RESULT(viewport_create(0, 3, 1) == NULL);
+}
+
+/* viewport_layout */
+void test1_viewport_layout()
+{
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  g = viewport_game();
+  vp = viewport_create(5, 3, 1);
+  PRINT_TEST_RESULT(viewport_layout(vp, g, 11) == 3 && viewport_get_room(vp, 2, 1) == 11 && viewport_get_room(vp, 3, 1) == 12 && viewport_get_room(vp, 2, 2) == 14 && viewport_get_room(vp, 4, 1) == NO_ID);
+  viewport_destroy(vp);
+  game_destroy(g);
+}
+void test2_viewport_layout()
+{
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  g = viewport_game();
+  vp = viewport_create(5, 3, VIEWPORT_FLOOR);
+  PRINT_TEST_RESULT(viewport_layout(vp, g, 11) == 4 && viewport_get_room(vp, 4, 1) == 13);
+  viewport_destroy(vp);
+  game_destroy(g);
+}
+void test3_viewport_layout()
+{
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  g = viewport_game();
+  vp = viewport_create(3, 3, VIEWPORT_FLOOR);
+  PRINT_TEST_RESULT(viewport_layout(vp, g, 11) == 3 && viewport_get_room(vp, 2, 1) == 12);
+  viewport_destroy(vp);
+  game_destroy(g);
+}
+void test4_viewport_layout()
+{
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  g = viewport_game();
+  vp = viewport_create(3, 3, VIEWPORT_FLOOR);
+  PRINT_TEST_RESULT(viewport_layout(vp, g, 99) == 0 && viewport_get_room(vp, 1, 1) == NO_ID);
+  viewport_destroy(vp);
+  game_destroy(g);
+}
+
+/* viewport_get_link */
+void test1_viewport_get_link()
+{
+  Viewport *vp = NULL;
+  Game *g = NULL;
+  g = viewport_game();
+  vp = viewport_create(3, 3, VIEWPORT_FLOOR);
+  viewport_layout(vp, g, 11);
+  PRINT_TEST_RESULT(viewport_get_link(vp, 1, 1, E) == VIEWPORT_OPEN && viewport_get_link(vp, 2, 1, W) == VIEWPORT_OPEN && viewport_get_link(vp, 1, 1, S) == VIEWPORT_CLOSED && viewport_get_link(vp, 1, 2, N) == VIEWPORT_CLOSED && viewport_get_link(vp, 1, 1, W) == VIEWPORT_NONE);
+  viewport_destroy(vp);
+  game_destroy(g);
+}
@@ -0,0 +1,57 @@
+/** 
+ * @brief It declares the tests for the viewport module
+ * 
+ * @file viewport_test.h
+ * @author Miguel Soto
+ * @version 1.0 
+ * @date 19-10-2026
+ * @copyright GNU Public License
+ */
+
+#ifndef VIEWPORT_TEST_H
+#define VIEWPORT_TEST_H
+
+/**
+ * @test Test function for creating a viewport
+ * @pre width = 3, height = 3
+ * @post an empty 3 by 3 grid
+ */
+void test1_viewport_create();
+/**
+ * @test Test function for creating a viewport
+ * @pre width = 0
+ * @post Output == NULL
+ */
+void test2_viewport_create();
+/**
+ * @test Test function for laying out the rooms
+ * @pre radius 1, a row of rooms 11-12-13 and room 14 south of 11
+ * @post only the rooms one link away from 11 are placed
+ */
+void test1_viewport_layout();
+/**
+ * @test Test function for laying out the rooms
+ * @pre VIEWPORT_FLOOR on a 5 by 3 grid
+ * @post every room of the floor is placed in its cell
+ */
+void test2_viewport_layout();
+/**
+ * @test Test function for laying out the rooms
+ * @pre VIEWPORT_FLOOR on a 3 by 3 grid
+ * @post room 13 is beyond the border and is left out
+ */
+void test3_viewport_layout();
+/**
+ * @test Test function for laying out the rooms
+ * @pre space that is not in the game
+ * @post no room is placed
+ */
+void test4_viewport_layout();
+/**
+ * @test Test function for getting the links of a cell
+ * @pre link 11-12 open and 11-14 closed
+ * @post the same link from both of its cells
+ */
+void test1_viewport_get_link();
+
+#endif